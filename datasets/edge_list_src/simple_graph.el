@@ -0,0 +1,6 @@
+# simple_graph.txt as zero-based "source target weight" triples
+0 1 5
+1 0 5
+1 2 10
+2 3 5
+3 1 20
@@ -0,0 +1,49 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+static int alt_query(void *index, int from, int to) {
+  return get_shortest_path_alt((alt_landmarks_t *)index, from, to);
+}
+
+/**
+ * @brief selects the landmarks, prints preprocessing time and table size,
+ * then compares the query latency with Dijkstra
+ */
+static void measure_graph(const csr_graph_t *graph, int landmark_count,
+                          const char *name) {
+  char label[64];
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  alt_landmarks_t *landmarks = alt_landmarks_create(graph, landmark_count);
+  snprintf(label, sizeof(label), "%s preprocessing, %d landmarks", name,
+           landmark_count);
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+  if (!landmarks) return;
+  printf("%s: %d landmarks, %zu KiB of distances\n", name, landmarks->count,
+         (size_t)2 * (size_t)landmarks->count * (size_t)graph->size *
+             sizeof(int) / 1024);
+  const benchmark_engine_t engine = {"alt", alt_query, landmarks, false};
+  benchmark_point_to_point(graph, &engine, 1, name);
+  alt_landmarks_delete(landmarks);
+}
+
+/**
+ * @brief ALT point-to-point queries on a weighted grid and a sparse random
+ * graph with 4 and ALT_DEFAULT_LANDMARKS landmarks
+ * @param max_size the grid has about max_size * 4 vertices, the random
+ * graph max_size
+ */
+void run_alt_benchmark(int max_size) {
+  print_benchmark_header("Point-to-point: ALT landmarks");
+  int side = 1;
+  while ((side + 1) * (side + 1) <= max_size * 4) side++;
+  csr_graph_t *grid = benchmark_grid_graph(side, 71u);
+  csr_graph_t *random = benchmark_random_csr_graph(max_size, 3, 29u);
+  for (int count = 4; count <= ALT_DEFAULT_LANDMARKS; count *= 4) {
+    if (grid) measure_graph(grid, count, "grid");
+    if (random) measure_graph(random, count, "random");
+  }
+  csr_graph_delete(grid);
+  csr_graph_delete(random);
+}
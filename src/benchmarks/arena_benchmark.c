@@ -0,0 +1,70 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define ARENA_BENCHMARK_QUERIES 50000
+
+static const int kArenaSizes[] = {32, 128, 512, 2048};
+
+/**
+ * @brief one query as a service would run it: result allocated, BFS and a
+ * shortest path computed, everything freed
+ */
+static int heap_query(graph_t *graph, int start) {
+  const int size = graph->adjacency->size;
+  graph_traversal_result_t *result = traversal_result_create(size);
+  breadth_first_search(graph, start, result);
+  const int reached = result->size;
+  traversal_result_delete(result);
+  return reached + get_shortest_path_between_vertices(
+                       graph, start, (start + size / 2) % size);
+}
+
+static int arena_query(graph_t *graph, int start, arena_t *arena) {
+  const int size = graph->adjacency->size;
+  graph_traversal_result_t *result =
+      traversal_result_create_arena(size, arena);
+  breadth_first_search_arena(graph, start, result, arena);
+  const int reached = result->size;
+  arena_reset(arena);
+  return reached + get_shortest_path_between_vertices_arena(
+                       graph, start, (start + size / 2) % size, arena);
+}
+
+static void measure_queries(int size) {
+  graph_t *graph = benchmark_random_graph(size, 10, 21u);
+  arena_t *arena = arena_create(0);
+  if (graph && arena) {
+    // dijkstra is O(V^2), keep the total work roughly constant
+    const int queries = ARENA_BENCHMARK_QUERIES * 32 / size * 32 / size + 20;
+    long long checksum = 0;
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    for (int q = 0; q < queries; q++) checksum += heap_query(graph, q % size);
+    print_benchmark_line("bfs + dijkstra queries, malloc", size,
+                         bench_timer_stop(&timer));
+
+    long long arena_checksum = 0;
+    bench_timer_start(&timer);
+    for (int q = 0; q < queries; q++) {
+      arena_checksum += arena_query(graph, q % size, arena);
+    }
+    print_benchmark_line("bfs + dijkstra queries, arena", size,
+                         bench_timer_stop(&timer));
+    if (checksum != arena_checksum) printf("arena results differ\n");
+  }
+  arena_delete(arena);
+  graph_delete(graph);
+}
+
+/**
+ * @brief compares repeated small queries allocating their scratch with
+ * malloc against the same queries served from a reset arena
+ * @param max_size largest graph size to measure
+ */
+void run_arena_benchmark(int max_size) {
+  print_benchmark_header("Per-query scratch: malloc vs arena");
+  for (size_t i = 0; i < sizeof(kArenaSizes) / sizeof(kArenaSizes[0]); i++) {
+    if (kArenaSizes[i] <= max_size) measure_queries(kArenaSizes[i]);
+  }
+}
@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmark.h"
+
+#define BATCH_BENCHMARK_QUERIES 100000
+#define BATCH_BENCHMARK_SAMPLED 200
+
+static const int kThreadCounts[] = {1, 2, 4, 8};
+
+/**
+ * @brief queries whose sources come from source_count distinct vertices,
+ * every source repeats about BATCH_BENCHMARK_QUERIES / source_count times
+ */
+static void fill_queries(shortest_path_query_t *queries, int size,
+                         int source_count) {
+  unsigned state = 11u;
+  for (int q = 0; q < BATCH_BENCHMARK_QUERIES; q++) {
+    const unsigned pick = bench_random_next(&state) % (unsigned)source_count;
+    queries[q].source = (int)(pick * 2654435761u % (unsigned)size);
+    queries[q].target = (int)(bench_random_next(&state) % (unsigned)size);
+  }
+}
+
+static void print_throughput(const char *label, int size, double seconds) {
+  print_benchmark_line(label, size, seconds);
+  printf("%s: %.0f queries per second\n", label,
+         seconds > 0 ? BATCH_BENCHMARK_QUERIES / seconds : 0.0);
+}
+
+/**
+ * @brief one query loop (timed on a sample, scaled to the batch) against the
+ * batch API for 1..8 threads
+ */
+static void measure_batch(const csr_graph_t *graph,
+                          const shortest_path_query_t *queries,
+                          int source_count, int *results) {
+  char label[64];
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  for (int q = 0; q < BATCH_BENCHMARK_SAMPLED; q++) {
+    results[q] = get_shortest_path_between_vertices_engine(
+        graph, queries[q].source, queries[q].target,
+        SHORTEST_PATH_ENGINE_AUTO);
+  }
+  snprintf(label, sizeof(label), "%d sources, query loop", source_count);
+  print_throughput(label, graph->size,
+                   bench_timer_stop(&timer) * BATCH_BENCHMARK_QUERIES /
+                       BATCH_BENCHMARK_SAMPLED);
+  for (size_t t = 0; t < sizeof(kThreadCounts) / sizeof(kThreadCounts[0]);
+       t++) {
+    thread_pool_t *pool = thread_pool_create(kThreadCounts[t]);
+    if (!pool) continue;
+    bench_timer_start(&timer);
+    const bool ok = get_shortest_paths_batch(
+        graph, queries, BATCH_BENCHMARK_QUERIES, pool, results);
+    const double seconds = bench_timer_stop(&timer);
+    snprintf(label, sizeof(label), "%d sources, batch %d threads",
+             source_count, kThreadCounts[t]);
+    if (ok) print_throughput(label, graph->size, seconds);
+    thread_pool_delete(pool);
+  }
+}
+
+/**
+ * @brief BATCH_BENCHMARK_QUERIES random queries on a sparse random graph,
+ * answered one by one and with get_shortest_paths_batch, for batches whose
+ * sources repeat about 1000 and 100 times
+ * @param max_size the graph has max_size * 4 vertices
+ */
+void run_batch_benchmark(int max_size) {
+  print_benchmark_header("Batched shortest-path queries");
+  csr_graph_t *graph = benchmark_random_csr_graph(max_size * 4, 4, 37u);
+  shortest_path_query_t *queries = (shortest_path_query_t *)malloc(
+      BATCH_BENCHMARK_QUERIES * sizeof(shortest_path_query_t));
+  int *results = (int *)malloc(BATCH_BENCHMARK_QUERIES * sizeof(int));
+  if (graph && queries && results) {
+    for (int source_count = 100; source_count <= 1000; source_count *= 10) {
+      fill_queries(queries, graph->size, source_count);
+      measure_batch(graph, queries, source_count, results);
+    }
+  }
+  free(results);
+  free(queries);
+  csr_graph_delete(graph);
+}
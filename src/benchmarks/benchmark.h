@@ -0,0 +1,94 @@
+#ifndef S21_BENCHMARK_H
+#define S21_BENCHMARK_H
+
+#include <time.h>
+
+#include "../graph/s21_graph.h"
+#include "../graph_algorithms/s21_graph_algorithms.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief default upper bound of graph sizes measured by the suites
+ */
+#define BENCHMARK_DEFAULT_MAX_SIZE 4000
+
+/**
+ * @brief random pairs timed by benchmark_point_to_point
+ */
+#define BENCHMARK_POINT_TO_POINT_QUERIES 1000
+
+/**
+ * @brief point-to-point engine timed against the heap Dijkstra
+ * @param name engine name in the output lines
+ * @param query distance from one vertex to another on index, -1 if
+ * unreachable
+ * @param index engine data passed to query
+ * @param tight_loop also time all pairs in one loop, for queries close to
+ * the timer resolution
+ */
+typedef struct {
+  const char *name;
+  int (*query)(void *index, int from, int to);
+  void *index;
+  bool tight_loop;
+} benchmark_engine_t;
+
+/**
+ * @brief wall clock timer for benchmarks
+ * @param start moment the measurement started
+ */
+typedef struct {
+  struct timespec start;
+} bench_timer_t;
+
+void bench_timer_start(bench_timer_t *timer);
+double bench_timer_stop(const bench_timer_t *timer);
+unsigned bench_random_next(unsigned *state);
+graph_t *benchmark_random_graph(int size, int density_percent, unsigned seed);
+csr_graph_t *benchmark_random_csr_graph(int size, int average_degree,
+                                        unsigned seed);
+csr_graph_t *benchmark_rmat_graph(int scale, int edge_factor, unsigned seed);
+csr_graph_t *benchmark_grid_graph(int side, unsigned seed);
+int benchmark_connected_vertex(const csr_graph_t *graph, int index);
+double benchmark_percentile(double *times, int count, int percent);
+void benchmark_point_to_point(const csr_graph_t *graph,
+                              const benchmark_engine_t *engines,
+                              int engine_count, const char *name);
+bool benchmark_write_matrix_file(const graph_t *graph, const char *filename);
+bool benchmark_write_edge_list_file(const csr_graph_t *graph,
+                                    const char *filename);
+void print_benchmark_header(const char *title);
+void print_benchmark_line(const char *name, int size, double seconds);
+
+void run_matrix_benchmark(int max_size);
+void run_csr_benchmark(int max_size);
+void run_binary_benchmark(int max_size);
+void run_parser_benchmark(int max_size);
+void run_formats_benchmark(int max_size);
+void run_bits_benchmark(int max_size);
+void run_dot_benchmark(int max_size);
+void run_arena_benchmark(int max_size);
+void run_workspace_benchmark(int max_size);
+void run_containers_benchmark(int max_size);
+void run_direction_benchmark(int max_size);
+void run_parallel_bfs_benchmark(int max_size);
+void run_multi_source_benchmark(int max_size);
+void run_bounded_benchmark(int max_size);
+void run_dijkstra_benchmark(int max_size);
+void run_engines_benchmark(int max_size);
+void run_delta_stepping_benchmark(int max_size);
+void run_sssp_tree_benchmark(int max_size);
+void run_bidirectional_benchmark(int max_size);
+void run_contraction_benchmark(int max_size);
+void run_alt_benchmark(int max_size);
+void run_labeling_benchmark(int max_size);
+void run_batch_benchmark(int max_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_BENCHMARK_H
@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "benchmark.h"
+
+/**
+ * @brief benchmark suite entry
+ * @param name suite name accepted on the command line
+ * @param run suite function, receives the largest graph size to measure
+ */
+typedef struct {
+  const char *name;
+  void (*run)(int max_size);
+} benchmark_suite_t;
+
+static const benchmark_suite_t kSuites[] = {
+    {"matrix", run_matrix_benchmark},
+    {"csr", run_csr_benchmark},
+    {"binary", run_binary_benchmark},
+    {"parser", run_parser_benchmark},
+    {"formats", run_formats_benchmark},
+    {"bits", run_bits_benchmark},
+    {"dot", run_dot_benchmark},
+    {"arena", run_arena_benchmark},
+    {"workspace", run_workspace_benchmark},
+    {"containers", run_containers_benchmark},
+    {"direction", run_direction_benchmark},
+    {"parallel_bfs", run_parallel_bfs_benchmark},
+    {"multi_source", run_multi_source_benchmark},
+    {"bounded", run_bounded_benchmark},
+    {"dijkstra", run_dijkstra_benchmark},
+    {"engines", run_engines_benchmark},
+    {"delta_stepping", run_delta_stepping_benchmark},
+    {"sssp_tree", run_sssp_tree_benchmark},
+    {"bidirectional", run_bidirectional_benchmark},
+    {"contraction", run_contraction_benchmark},
+    {"alt", run_alt_benchmark},
+    {"labeling", run_labeling_benchmark},
+    {"batch", run_batch_benchmark},
+};
+
+static void print_usage(const char *program) {
+  printf("Usage: %s [suite|all] [max_size]\n", program);
+  printf("Suites:");
+  for (size_t i = 0; i < sizeof(kSuites) / sizeof(kSuites[0]); i++) {
+    printf(" %s", kSuites[i].name);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  const char *suite = argc > 1 ? argv[1] : "all";
+  int max_size = argc > 2 ? atoi(argv[2]) : BENCHMARK_DEFAULT_MAX_SIZE;
+  if (max_size <= 0) {
+    print_usage(argv[0]);
+    return 1;
+  }
+  bool found = false;
+  for (size_t i = 0; i < sizeof(kSuites) / sizeof(kSuites[0]); i++) {
+    if (strcmp(suite, "all") == 0 || strcmp(suite, kSuites[i].name) == 0) {
+      kSuites[i].run(max_size);
+      found = true;
+    }
+  }
+  if (!found) {
+    print_usage(argv[0]);
+    return 1;
+  }
+  return 0;
+}
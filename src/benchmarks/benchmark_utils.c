@@ -0,0 +1,326 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmark.h"
+
+void bench_timer_start(bench_timer_t *timer) {
+  timespec_get(&timer->start, TIME_UTC);
+}
+
+/**
+ * @brief stops the timer
+ * @param timer started timer
+ * @return elapsed wall time in seconds
+ */
+double bench_timer_stop(const bench_timer_t *timer) {
+  struct timespec end;
+  timespec_get(&end, TIME_UTC);
+  return (double)(end.tv_sec - timer->start.tv_sec) +
+         (double)(end.tv_nsec - timer->start.tv_nsec) / 1e9;
+}
+
+/**
+ * @brief xorshift32 step, deterministic and cheap enough for huge matrices
+ * @param state generator state, must not be zero
+ * @return next pseudo random value
+ */
+unsigned bench_random_next(unsigned *state) {
+  unsigned x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+/**
+ * @brief creates a random weighted graph
+ * @param size number of vertices
+ * @param density_percent probability (0-100) that a cell holds an edge
+ * @param seed generator seed
+ * @return graph or NULL if error
+ */
+graph_t *benchmark_random_graph(int size, int density_percent, unsigned seed) {
+  graph_t *graph = graph_create(size);
+  if (!graph) return NULL;
+  unsigned state = seed ? seed : 1u;
+  for (int i = 0; i < size; i++) {
+    int *row = matrix_row(graph->adjacency, i);
+    for (int j = 0; j < size; j++) {
+      if (i != j && (int)(bench_random_next(&state) % 100) < density_percent) {
+        row[j] = 1 + (int)(bench_random_next(&state) % 100);
+      }
+    }
+  }
+  return graph;
+}
+
+/**
+ * @brief creates a random sparse weighted graph
+ * @param size number of vertices
+ * @param average_degree number of outgoing edges generated per vertex
+ * @param seed generator seed
+ * @return csr graph or NULL if error
+ */
+csr_graph_t *benchmark_random_csr_graph(int size, int average_degree,
+                                        unsigned seed) {
+  const int edge_count = size * average_degree;
+  int *sources = (int *)malloc(((size_t)edge_count + 1) * sizeof(int));
+  int *targets = (int *)malloc(((size_t)edge_count + 1) * sizeof(int));
+  int *weights = (int *)malloc(((size_t)edge_count + 1) * sizeof(int));
+  csr_graph_t *graph = NULL;
+  if (sources && targets && weights) {
+    unsigned state = seed ? seed : 1u;
+    for (int e = 0; e < edge_count; e++) {
+      sources[e] = e / average_degree;
+      targets[e] = (int)(bench_random_next(&state) % (unsigned)size);
+      weights[e] = 1 + (int)(bench_random_next(&state) % 100);
+    }
+    graph = csr_graph_from_edges(size, edge_count, sources, targets, weights);
+  }
+  free(sources);
+  free(targets);
+  free(weights);
+  return graph;
+}
+
+/**
+ * @brief creates an undirected R-MAT graph (a = 0.57, b = c = 0.19), the
+ * Graph500 power-law generator, every edge is stored in both directions
+ * @param scale the graph has 2^scale vertices
+ * @param edge_factor undirected edges generated per vertex
+ * @param seed generator seed
+ * @return csr graph with unit weights or NULL if error
+ */
+csr_graph_t *benchmark_rmat_graph(int scale, int edge_factor, unsigned seed) {
+  const int size = 1 << scale;
+  const int edges = size * edge_factor;
+  int *sources = (int *)malloc(((size_t)edges * 2 + 1) * sizeof(int));
+  int *targets = (int *)malloc(((size_t)edges * 2 + 1) * sizeof(int));
+  int *weights = (int *)malloc(((size_t)edges * 2 + 1) * sizeof(int));
+  csr_graph_t *graph = NULL;
+  if (sources && targets && weights) {
+    unsigned state = seed ? seed : 1u;
+    for (int e = 0; e < edges; e++) {
+      int u = 0, v = 0;
+      for (int bit = 0; bit < scale; bit++) {
+        const unsigned r = bench_random_next(&state) % 100u;
+        u |= (r >= 76u) << bit;
+        v |= ((r >= 57u && r < 76u) || r >= 95u) << bit;
+      }
+      sources[2 * e] = targets[2 * e + 1] = u;
+      targets[2 * e] = sources[2 * e + 1] = v;
+      weights[2 * e] = weights[2 * e + 1] = 1;
+    }
+    graph = csr_graph_from_edges(size, edges * 2, sources, targets, weights);
+  }
+  free(sources);
+  free(targets);
+  free(weights);
+  return graph;
+}
+
+/**
+ * @brief side x side grid, every cell linked both ways to its right and
+ * lower neighbours with weights in [1, 20], a road-network stand-in
+ * @param side cells per row and column
+ * @param seed generator seed
+ * @return csr graph or NULL if error
+ */
+csr_graph_t *benchmark_grid_graph(int side, unsigned seed) {
+  const int edge_count = 4 * side * side;
+  int *sources = (int *)malloc(((size_t)edge_count + 1) * sizeof(int));
+  int *targets = (int *)malloc(((size_t)edge_count + 1) * sizeof(int));
+  int *weights = (int *)malloc(((size_t)edge_count + 1) * sizeof(int));
+  csr_graph_t *graph = NULL;
+  if (sources && targets && weights) {
+    unsigned state = seed ? seed : 1u;
+    int count = 0;
+    for (int v = 0; v < side * side; v++) {
+      const int neighbours[2] = {v % side + 1 < side ? v + 1 : -1,
+                                 v + side < side * side ? v + side : -1};
+      for (int k = 0; k < 2; k++) {
+        if (neighbours[k] < 0) continue;
+        const int weight = 1 + (int)(bench_random_next(&state) % 20);
+        sources[count] = v;
+        targets[count] = neighbours[k];
+        weights[count++] = weight;
+        sources[count] = neighbours[k];
+        targets[count] = v;
+        weights[count++] = weight;
+      }
+    }
+    graph = csr_graph_from_edges(side * side, count, sources, targets,
+                                 weights);
+  }
+  free(sources);
+  free(targets);
+  free(weights);
+  return graph;
+}
+
+/**
+ * @brief picks a vertex with edges, R-MAT leaves many vertices isolated
+ * @param graph csr graph with at least one edge
+ * @param index selects a different vertex for different values
+ */
+int benchmark_connected_vertex(const csr_graph_t *graph, int index) {
+  int v = (int)((unsigned)index * 2654435761u % (unsigned)graph->size);
+  while (csr_degree(graph, v) == 0) v = (v + 1) % graph->size;
+  return v;
+}
+
+static int compare_times(const void *a, const void *b) {
+  const double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief sorts the measured times and picks one percentile
+ * @param times per-query times, sorted in place
+ * @param count number of times
+ * @param percent 50 for the median, 99 for the tail
+ * @return time below which percent of the measurements fall
+ */
+double benchmark_percentile(double *times, int count, int percent) {
+  qsort(times, (size_t)count, sizeof(double), compare_times);
+  return times[(long long)count * percent / 100];
+}
+
+/**
+ * @brief prints the median and the 99th percentile of every column
+ * @param times column k holds the times of engine k, dijkstra first
+ */
+static void print_point_to_point_percentiles(
+    const csr_graph_t *graph, double *times, const benchmark_engine_t *engines,
+    int engine_count, const char *name) {
+  const int count = BENCHMARK_POINT_TO_POINT_QUERIES;
+  char label[64];
+  for (int percent = 50; percent <= 99; percent += 49) {
+    for (int k = 0; k <= engine_count; k++) {
+      snprintf(label, sizeof(label), "%s p%d, %s", name, percent,
+               k == 0 ? "dijkstra" : engines[k - 1].name);
+      print_benchmark_line(
+          label, graph->size,
+          benchmark_percentile(times + (size_t)k * count, count, percent));
+    }
+  }
+}
+
+/**
+ * @brief times the same random (from, to) pairs with the heap Dijkstra and
+ * every engine, prints the median and the 99th percentile of each and the
+ * number of answers that differ from Dijkstra. Engines with tight_loop are
+ * timed once more over all pairs in one loop, whose answers must add up to
+ * the same checksum as the timed ones.
+ * @param graph csr graph the engines were built on
+ * @param engines engines to measure
+ * @param engine_count number of engines
+ * @param name graph name in the output lines
+ */
+void benchmark_point_to_point(const csr_graph_t *graph,
+                              const benchmark_engine_t *engines,
+                              int engine_count, const char *name) {
+  const int count = BENCHMARK_POINT_TO_POINT_QUERIES;
+  double *times =
+      (double *)malloc((size_t)(engine_count + 1) * count * sizeof(double));
+  int *pairs = (int *)malloc((size_t)count * 2 * sizeof(int));
+  long long *checksums =
+      (long long *)calloc((size_t)engine_count + 1, sizeof(long long));
+  int *mismatches = (int *)calloc((size_t)engine_count + 1, sizeof(int));
+  if (times && pairs && checksums && mismatches) {
+    unsigned state = 5u;
+    for (int i = 0; i < count; i++) {
+      const int from = (int)(bench_random_next(&state) % (unsigned)graph->size);
+      const int to = (int)(bench_random_next(&state) % (unsigned)graph->size);
+      pairs[2 * i] = from;
+      pairs[2 * i + 1] = to;
+      bench_timer_t timer;
+      bench_timer_start(&timer);
+      const int expected = get_shortest_path_between_vertices_engine(
+          graph, from, to, SHORTEST_PATH_ENGINE_HEAP);
+      times[i] = bench_timer_stop(&timer);
+      for (int k = 0; k < engine_count; k++) {
+        bench_timer_start(&timer);
+        const int actual = engines[k].query(engines[k].index, from, to);
+        times[(size_t)(k + 1) * count + i] = bench_timer_stop(&timer);
+        checksums[k] += actual;
+        mismatches[k] += actual != expected;
+      }
+    }
+    print_point_to_point_percentiles(graph, times, engines, engine_count,
+                                     name);
+    for (int k = 0; k < engine_count; k++) {
+      if (!engines[k].tight_loop) continue;
+      long long checksum = 0;
+      bench_timer_t timer;
+      bench_timer_start(&timer);
+      for (int i = 0; i < count; i++) {
+        checksum +=
+            engines[k].query(engines[k].index, pairs[2 * i], pairs[2 * i + 1]);
+      }
+      printf("%s: %.0f ns per %s query in a tight loop\n", name,
+             bench_timer_stop(&timer) * 1e9 / count, engines[k].name);
+      if (checksum != checksums[k]) {
+        printf("%s tight loop answers differ\n", engines[k].name);
+      }
+    }
+    for (int k = 0; k < engine_count; k++) {
+      if (mismatches[k] > 0) {
+        printf("%d %s answers differ\n", mismatches[k], engines[k].name);
+      }
+    }
+  }
+  free(times);
+  free(pairs);
+  free(checksums);
+  free(mismatches);
+}
+
+/**
+ * @brief writes the graph in the text adjacency matrix format
+ * @param graph source graph
+ * @param filename destination file
+ * @return true if success false if error
+ */
+bool benchmark_write_matrix_file(const graph_t *graph, const char *filename) {
+  FILE *file = fopen(filename, "w");
+  if (!file) return false;
+  const int size = graph->adjacency->size;
+  fprintf(file, "%d\n", size);
+  for (int i = 0; i < size; i++) {
+    const int *row = matrix_row(graph->adjacency, i);
+    for (int j = 0; j < size; j++) {
+      fprintf(file, j + 1 < size ? "%d " : "%d\n", row[j]);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+/**
+ * @brief writes the graph as zero-based "source target weight" lines
+ * @param graph source graph
+ * @param filename destination file
+ * @return true if success false if error
+ */
+bool benchmark_write_edge_list_file(const csr_graph_t *graph,
+                                    const char *filename) {
+  FILE *file = fopen(filename, "w");
+  if (!file) return false;
+  for (int v = 0; v < graph->size; v++) {
+    for (int e = graph->offsets[v]; e < graph->offsets[v + 1]; e++) {
+      fprintf(file, "%d %d %d\n", v, graph->targets[e], graph->weights[e]);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+void print_benchmark_header(const char *title) {
+  printf("________________________________________________\n");
+  printf("%s\n", title);
+  printf("________________________________________________\n");
+}
+
+void print_benchmark_line(const char *name, int size, double seconds) {
+  printf("%-36s V=%-6d %12.6f s\n", name, size, seconds);
+}
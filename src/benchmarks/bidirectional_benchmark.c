@@ -0,0 +1,73 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define BIDIRECTIONAL_BENCHMARK_QUERIES 200
+
+/**
+ * @brief times the same random queries one way and both ways, prints the
+ * median and the 99th percentile of each
+ */
+static void measure_graph(const csr_graph_t *graph, const csr_graph_t *reverse,
+                          const char *name) {
+  double forward[BIDIRECTIONAL_BENCHMARK_QUERIES];
+  double both[BIDIRECTIONAL_BENCHMARK_QUERIES];
+  unsigned state = 3u;
+  for (int i = 0; i < BIDIRECTIONAL_BENCHMARK_QUERIES; i++) {
+    const int from = (int)(bench_random_next(&state) % (unsigned)graph->size);
+    const int to = (int)(bench_random_next(&state) % (unsigned)graph->size);
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    get_shortest_path_between_vertices_engine(graph, from, to,
+                                              SHORTEST_PATH_ENGINE_HEAP);
+    forward[i] = bench_timer_stop(&timer);
+    bench_timer_start(&timer);
+    get_shortest_path_bidirectional(graph, reverse, from, to);
+    both[i] = bench_timer_stop(&timer);
+  }
+  char label[64];
+  snprintf(label, sizeof(label), "%s p50, forward", name);
+  print_benchmark_line(
+      label, graph->size,
+      benchmark_percentile(forward, BIDIRECTIONAL_BENCHMARK_QUERIES, 50));
+  snprintf(label, sizeof(label), "%s p50, bidirectional", name);
+  print_benchmark_line(
+      label, graph->size,
+      benchmark_percentile(both, BIDIRECTIONAL_BENCHMARK_QUERIES, 50));
+  snprintf(label, sizeof(label), "%s p99, forward", name);
+  print_benchmark_line(
+      label, graph->size,
+      benchmark_percentile(forward, BIDIRECTIONAL_BENCHMARK_QUERIES, 99));
+  snprintf(label, sizeof(label), "%s p99, bidirectional", name);
+  print_benchmark_line(
+      label, graph->size,
+      benchmark_percentile(both, BIDIRECTIONAL_BENCHMARK_QUERIES, 99));
+}
+
+/**
+ * @brief compares forward and bidirectional Dijkstra (both on the indexed
+ * heap) on a weighted grid and on a power-law R-MAT graph
+ * @param max_size the grid has about max_size * 64 vertices, the R-MAT
+ * graph 2^16
+ */
+void run_bidirectional_benchmark(int max_size) {
+  print_benchmark_header("Point-to-point: forward vs bidirectional Dijkstra");
+  int side = 1;
+  while ((side + 1) * (side + 1) <= max_size * 64) side++;
+  csr_graph_t *grid = benchmark_grid_graph(side, 71u);
+  if (grid) measure_graph(grid, NULL, "grid");
+  csr_graph_delete(grid);
+  csr_graph_t *random = benchmark_rmat_graph(16, 4, 19u);
+  if (random) {
+    unsigned state = 23u;
+    for (int e = 0; e < random->edge_count; e++) {
+      random->weights[e] = 1 + (int)(bench_random_next(&state) % 100);
+    }
+    random->max_weight = csr_graph_scan_max_weight(random);
+  }
+  // the new weights differ per direction, the backward search needs reverse
+  csr_graph_t *reverse = random ? csr_graph_transpose(random) : NULL;
+  if (reverse) measure_graph(random, reverse, "r-mat");
+  csr_graph_delete(reverse);
+  csr_graph_delete(random);
+}
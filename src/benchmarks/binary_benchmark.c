@@ -0,0 +1,71 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define BINARY_BENCHMARK_TEXT_FILE "graph_benchmark_matrix.txt"
+#define BINARY_BENCHMARK_BINARY_FILE "graph_benchmark_matrix.s21g"
+
+/**
+ * @brief touches one cell per page so that lazy mappings are paid for
+ * @return sum of the touched cells
+ */
+static long touch_matrix(const graph_t *graph) {
+  long sum = 0;
+  const int size = graph->adjacency->size;
+  for (int i = 0; i < size; i++) {
+    const int *row = matrix_row(graph->adjacency, i);
+    for (int j = 0; j < size; j += 1024) sum += row[j];
+  }
+  return sum;
+}
+
+static void measure_load(int size) {
+  graph_t *source = benchmark_random_graph(size, 2, 7u);
+  if (!source ||
+      !benchmark_write_matrix_file(source, BINARY_BENCHMARK_TEXT_FILE) ||
+      !save_graph_to_binary_file(source, BINARY_BENCHMARK_BINARY_FILE)) {
+    graph_delete(source);
+    return;
+  }
+  graph_delete(source);
+
+  bench_timer_t timer;
+  graph_t *graph = graph_create(0);
+  bench_timer_start(&timer);
+  if (graph && load_graph_from_file(graph, BINARY_BENCHMARK_TEXT_FILE)) {
+    touch_matrix(graph);
+    print_benchmark_line("load, text matrix", size, bench_timer_stop(&timer));
+  }
+  graph_delete(graph);
+
+  bench_timer_start(&timer);
+  graph = map_graph_from_binary_file(BINARY_BENCHMARK_BINARY_FILE, true);
+  if (graph) {
+    touch_matrix(graph);
+    print_benchmark_line("map binary, checksum", size,
+                         bench_timer_stop(&timer));
+  }
+  graph_delete(graph);
+
+  bench_timer_start(&timer);
+  graph = map_graph_from_binary_file(BINARY_BENCHMARK_BINARY_FILE, false);
+  if (graph) {
+    touch_matrix(graph);
+    print_benchmark_line("map binary, no checksum", size,
+                         bench_timer_stop(&timer));
+  }
+  graph_delete(graph);
+  remove(BINARY_BENCHMARK_TEXT_FILE);
+  remove(BINARY_BENCHMARK_BINARY_FILE);
+}
+
+/**
+ * @brief compares text parsing with mapping the binary container
+ * @param max_size largest graph size to measure
+ */
+void run_binary_benchmark(int max_size) {
+  print_benchmark_header("Graph loading: text matrix vs binary mapping");
+  for (int size = 1000; size <= max_size; size *= 2) {
+    measure_load(size);
+  }
+}
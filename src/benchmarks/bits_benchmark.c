@@ -0,0 +1,48 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+static void measure_density(int size, int density_percent) {
+  graph_t *graph = benchmark_random_graph(size, density_percent, 3u);
+  bit_matrix_t *bits = graph_to_bit_matrix(graph);
+  graph_traversal_result_t *result = traversal_result_create(size);
+  if (graph && bits && result) {
+    char name[64];
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    breadth_first_search(graph, 0, result);
+    snprintf(name, sizeof(name), "bfs %d%%, int matrix", density_percent);
+    print_benchmark_line(name, size, bench_timer_stop(&timer));
+
+    bench_timer_start(&timer);
+    breadth_first_search_bits(bits, 0, result);
+    snprintf(name, sizeof(name), "bfs %d%%, bit matrix", density_percent);
+    print_benchmark_line(name, size, bench_timer_stop(&timer));
+
+    bench_timer_start(&timer);
+    depth_first_search(graph, 0, result);
+    snprintf(name, sizeof(name), "dfs %d%%, int matrix", density_percent);
+    print_benchmark_line(name, size, bench_timer_stop(&timer));
+
+    bench_timer_start(&timer);
+    depth_first_search_bits(bits, 0, result);
+    snprintf(name, sizeof(name), "dfs %d%%, bit matrix", density_percent);
+    print_benchmark_line(name, size, bench_timer_stop(&timer));
+  }
+  traversal_result_delete(result);
+  bit_matrix_delete(bits);
+  graph_delete(graph);
+}
+
+/**
+ * @brief compares traversal over int cells with word-parallel traversal over
+ * one bit per cell
+ * @param max_size largest graph size to measure
+ */
+void run_bits_benchmark(int max_size) {
+  print_benchmark_header("Dense traversal: int matrix vs bit matrix");
+  for (int size = 1000; size <= max_size; size *= 2) {
+    measure_density(size, 2);
+    measure_density(size, 50);
+  }
+}
@@ -0,0 +1,62 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define BOUNDED_BENCHMARK_QUERIES 64
+
+/**
+ * @brief times hop queries from the same starts, the target of query i is the
+ * vertex visited at position distance of a full search, or none if distance
+ * is 0
+ */
+static double time_queries(const csr_graph_t *graph,
+                           graph_levels_result_t *levels,
+                           graph_levels_result_t *full, int distance) {
+  double seconds = 0;
+  for (int i = 0; i < BOUNDED_BENCHMARK_QUERIES; i++) {
+    const int start = benchmark_connected_vertex(graph, i);
+    breadth_first_search_levels_csr(graph, start, NULL, full);
+    traversal_limits_t limits = {-1, 0};
+    if (distance > 0) {
+      limits.target_vertex = full->order[distance < full->reached
+                                             ? distance
+                                             : full->reached - 1];
+    }
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    breadth_first_search_levels_csr(graph, start, &limits, levels);
+    seconds += bench_timer_stop(&timer);
+  }
+  return seconds / BOUNDED_BENCHMARK_QUERIES;
+}
+
+static void measure_size(int size) {
+  csr_graph_t *graph = benchmark_random_csr_graph(size, 8, 21u);
+  graph_levels_result_t *levels =
+      graph ? levels_result_create(graph->size) : NULL;
+  graph_levels_result_t *full =
+      graph ? levels_result_create(graph->size) : NULL;
+  if (graph && levels && full) {
+    print_benchmark_line("hop query csr, full traversal", size,
+                         time_queries(graph, levels, full, 0));
+    print_benchmark_line("hop query csr, mid-order target", size,
+                         time_queries(graph, levels, full, size / 2));
+    print_benchmark_line("hop query csr, 100th vertex target", size,
+                         time_queries(graph, levels, full, 100));
+  }
+  levels_result_delete(full);
+  levels_result_delete(levels);
+  csr_graph_delete(graph);
+}
+
+/**
+ * @brief compares a full BFS with BFS stopping at the target vertex, for a
+ * target in the middle of the BFS order and one close to the start
+ * @param max_size largest graph measured has max_size * 64 vertices
+ */
+void run_bounded_benchmark(int max_size) {
+  print_benchmark_header("Point-to-point hops: full vs early-stopping BFS");
+  for (int size = 4096; size <= max_size * 64; size *= 4) {
+    measure_size(size);
+  }
+}
@@ -0,0 +1,124 @@
+#include <stdio.h>
+
+#include "../graph_algorithms/data_structures/array_stack/array_stack.h"
+#include "../graph_algorithms/data_structures/queue/queue.h"
+#include "../graph_algorithms/data_structures/ring_queue/ring_queue.h"
+#include "../graph_algorithms/data_structures/stack/stack.h"
+#include "benchmark.h"
+
+#define CONTAINERS_BENCHMARK_ROUNDS 50
+
+/**
+ * Traversal-like pattern: each pop is followed by up to two pushes until
+ * size values went through the container.
+ */
+static long long queue_lib_rounds(int size) {
+  long long checksum = 0;
+  for (int round = 0; round < CONTAINERS_BENCHMARK_ROUNDS; round++) {
+    queue *q = queue_create();
+    if (!q) return checksum;
+    int pushed = 1;
+    queue_push(q, 0);
+    while (!queue_is_empty(q)) {
+      const int value = queue_front(q);
+      queue_pop(q);
+      checksum += value;
+      for (int k = 0; k < 2 && pushed < size; k++) queue_push(q, pushed++);
+    }
+    queue_delete(q);
+  }
+  return checksum;
+}
+
+static long long ring_queue_rounds(int size) {
+  long long checksum = 0;
+  for (int round = 0; round < CONTAINERS_BENCHMARK_ROUNDS; round++) {
+    ring_queue_t *q = ring_queue_create(size);
+    if (!q) return checksum;
+    int pushed = 1;
+    ring_queue_push(q, 0);
+    while (!ring_queue_is_empty(q)) {
+      const int value = ring_queue_front(q);
+      ring_queue_pop(q);
+      checksum += value;
+      for (int k = 0; k < 2 && pushed < size; k++) {
+        ring_queue_push(q, pushed++);
+      }
+    }
+    ring_queue_delete(q);
+  }
+  return checksum;
+}
+
+static long long stack_lib_rounds(int size) {
+  long long checksum = 0;
+  for (int round = 0; round < CONTAINERS_BENCHMARK_ROUNDS; round++) {
+    stack *s = stack_create();
+    if (!s) return checksum;
+    int pushed = 1;
+    stack_push(s, 0);
+    while (!stack_is_empty(s)) {
+      const int value = stack_top(s);
+      stack_pop(s);
+      checksum += value;
+      for (int k = 0; k < 2 && pushed < size; k++) stack_push(s, pushed++);
+    }
+    stack_delete(s);
+  }
+  return checksum;
+}
+
+static long long array_stack_rounds(int size) {
+  long long checksum = 0;
+  for (int round = 0; round < CONTAINERS_BENCHMARK_ROUNDS; round++) {
+    array_stack_t *s = array_stack_create(size);
+    if (!s) return checksum;
+    int pushed = 1;
+    array_stack_push(s, 0);
+    while (!array_stack_is_empty(s)) {
+      const int value = array_stack_top(s);
+      array_stack_pop(s);
+      checksum += value;
+      for (int k = 0; k < 2 && pushed < size; k++) {
+        array_stack_push(s, pushed++);
+      }
+    }
+    array_stack_delete(s);
+  }
+  return checksum;
+}
+
+static void measure_containers(int size) {
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  const long long queue_sum = queue_lib_rounds(size);
+  print_benchmark_line("queue, std::queue library", size,
+                       bench_timer_stop(&timer));
+  bench_timer_start(&timer);
+  const long long ring_sum = ring_queue_rounds(size);
+  print_benchmark_line("queue, inline ring buffer", size,
+                       bench_timer_stop(&timer));
+  bench_timer_start(&timer);
+  const long long stack_sum = stack_lib_rounds(size);
+  print_benchmark_line("stack, std::stack library", size,
+                       bench_timer_stop(&timer));
+  bench_timer_start(&timer);
+  const long long array_sum = array_stack_rounds(size);
+  print_benchmark_line("stack, inline array", size,
+                       bench_timer_stop(&timer));
+  if (queue_sum != ring_sum || stack_sum != array_sum) {
+    printf("container results differ\n");
+  }
+}
+
+/**
+ * @brief compares the C++ backed queue and stack libraries with the header
+ * only ring-buffer queue and array stack on a traversal-like access pattern
+ * @param max_size largest number of elements to measure, scaled by 1000
+ */
+void run_containers_benchmark(int max_size) {
+  print_benchmark_header("Containers: std::queue/stack vs inline arrays");
+  for (int size = 1000; size <= max_size; size *= 2) {
+    measure_containers(size * 1000);
+  }
+}
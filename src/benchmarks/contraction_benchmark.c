@@ -0,0 +1,83 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define CONTRACTION_BENCHMARK_FILE "contraction_benchmark.s21ch"
+
+/**
+ * @brief forward and reverse graph of a bidirectional query
+ */
+typedef struct {
+  const csr_graph_t *graph;
+  const csr_graph_t *reverse;
+} bidirectional_graphs_t;
+
+static int bidirectional_query(void *index, int from, int to) {
+  const bidirectional_graphs_t *graphs = (const bidirectional_graphs_t *)index;
+  return get_shortest_path_bidirectional(graphs->graph, graphs->reverse, from,
+                                         to);
+}
+
+static int hierarchy_query(void *index, int from, int to) {
+  return get_shortest_path_contraction_hierarchy(
+      (contraction_hierarchy_t *)index, from, to);
+}
+
+/**
+ * @brief builds, saves and loads a contraction hierarchy, then compares its
+ * query latency with Dijkstra and bidirectional Dijkstra
+ */
+static void measure_graph(const csr_graph_t *graph, const char *name) {
+  char label[64];
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  contraction_hierarchy_t *hierarchy = contraction_hierarchy_create(graph);
+  snprintf(label, sizeof(label), "%s preprocessing", name);
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+  if (!hierarchy) return;
+  printf("%s: %d edges, %d shortcuts\n", name, graph->edge_count,
+         hierarchy->shortcut_count);
+  bench_timer_start(&timer);
+  const bool saved =
+      save_contraction_hierarchy_to_file(hierarchy, CONTRACTION_BENCHMARK_FILE);
+  snprintf(label, sizeof(label), "%s save", name);
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+  bench_timer_start(&timer);
+  contraction_hierarchy_t *loaded =
+      saved ? load_contraction_hierarchy_from_file(CONTRACTION_BENCHMARK_FILE)
+            : NULL;
+  snprintf(label, sizeof(label), "%s load", name);
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+  remove(CONTRACTION_BENCHMARK_FILE);
+  csr_graph_t *reverse = csr_graph_transpose(graph);
+  if (reverse) {
+    bidirectional_graphs_t graphs = {graph, reverse};
+    const benchmark_engine_t engines[2] = {
+        {"bidirectional", bidirectional_query, &graphs, false},
+        {"hierarchy", hierarchy_query, loaded ? loaded : hierarchy, false}};
+    benchmark_point_to_point(graph, engines, 2, name);
+  }
+  csr_graph_delete(reverse);
+  contraction_hierarchy_delete(loaded);
+  contraction_hierarchy_delete(hierarchy);
+}
+
+/**
+ * @brief contraction hierarchies on a weighted grid and a sparse random
+ * graph: preprocessing, file round trip and query latency. Random graphs
+ * have no small separators, their hierarchy grows a dense core and is the
+ * worst case of the method.
+ * @param max_size the grid has about max_size * 4 vertices, the random
+ * graph max_size / 4
+ */
+void run_contraction_benchmark(int max_size) {
+  print_benchmark_header("Point-to-point: contraction hierarchies");
+  int side = 1;
+  while ((side + 1) * (side + 1) <= max_size * 4) side++;
+  csr_graph_t *grid = benchmark_grid_graph(side, 71u);
+  if (grid) measure_graph(grid, "grid");
+  csr_graph_delete(grid);
+  csr_graph_t *random = benchmark_random_csr_graph(max_size / 4, 3, 29u);
+  if (random) measure_graph(random, "random");
+  csr_graph_delete(random);
+}
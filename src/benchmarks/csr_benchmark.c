@@ -0,0 +1,39 @@
+#include "benchmark.h"
+
+static void measure_sparse_graph(int size) {
+  csr_graph_t *csr = benchmark_random_csr_graph(size, 8, 7u);
+  graph_t *graph = graph_from_csr(csr);
+  graph_traversal_result_t *result = traversal_result_create(size);
+  if (csr && graph && result) {
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    breadth_first_search(graph, 0, result);
+    print_benchmark_line("bfs, adjacency matrix", size,
+                         bench_timer_stop(&timer));
+    bench_timer_start(&timer);
+    breadth_first_search_csr(csr, 0, result);
+    print_benchmark_line("bfs, csr", size, bench_timer_stop(&timer));
+
+    bench_timer_start(&timer);
+    get_shortest_path_between_vertices(graph, 0, size - 1);
+    print_benchmark_line("dijkstra, adjacency matrix", size,
+                         bench_timer_stop(&timer));
+    bench_timer_start(&timer);
+    get_shortest_path_between_vertices_csr(csr, 0, size - 1);
+    print_benchmark_line("dijkstra, csr", size, bench_timer_stop(&timer));
+  }
+  traversal_result_delete(result);
+  graph_delete(graph);
+  csr_graph_delete(csr);
+}
+
+/**
+ * @brief compares dense and csr algorithms on graphs with average degree 8
+ * @param max_size largest graph size to measure
+ */
+void run_csr_benchmark(int max_size) {
+  print_benchmark_header("Sparse graphs: adjacency matrix vs csr");
+  for (int size = 1000; size <= max_size; size *= 2) {
+    measure_sparse_graph(size);
+  }
+}
@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmark.h"
+
+/**
+ * @brief vertex of largest finite distance, a Dijkstra query to it settles
+ * every reachable vertex
+ */
+static int farthest_vertex(const int *dist, int size) {
+  int farthest = 0;
+  for (int v = 1; v < size; v++) {
+    if (dist[v] > dist[farthest]) farthest = v;
+  }
+  return farthest;
+}
+
+static void measure_delta(const csr_graph_t *graph, int delta,
+                          thread_pool_t *pool, int *dist) {
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  shortest_paths_delta_stepping(graph, 0, delta, pool, dist);
+  char label[64];
+  if (pool) {
+    snprintf(label, sizeof(label), "delta %d, pool of %d", delta,
+             thread_pool_size(pool));
+  } else {
+    snprintf(label, sizeof(label), "delta %d, calling thread", delta);
+  }
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+}
+
+static void measure_size(int size, thread_pool_t *pool) {
+  csr_graph_t *graph = benchmark_random_csr_graph(size, 8, 37u);
+  int *dist = graph ? (int *)malloc((size_t)size * sizeof(int)) : NULL;
+  if (graph && dist &&
+      shortest_paths_delta_stepping(graph, 0, 0, NULL, dist)) {
+    const int target = farthest_vertex(dist, size);
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    get_shortest_path_between_vertices_engine(graph, 0, target,
+                                              SHORTEST_PATH_ENGINE_HEAP);
+    print_benchmark_line("sssp, dijkstra 4-ary heap", size,
+                         bench_timer_stop(&timer));
+    measure_delta(graph, 1, NULL, dist);
+    measure_delta(graph, 12, NULL, dist);
+    measure_delta(graph, 12, pool, dist);
+    measure_delta(graph, 100, pool, dist);
+  }
+  free(dist);
+  csr_graph_delete(graph);
+}
+
+/**
+ * @brief compares a full sequential Dijkstra with delta-stepping for several
+ * bucket widths, on one thread and on one thread per core. Weights are in
+ * [1, 100] and the average degree is 8, so the default delta is 12.
+ * @param max_size largest graph measured has max_size * 256 vertices
+ */
+void run_delta_stepping_benchmark(int max_size) {
+  print_benchmark_header("Single-source shortest paths: delta-stepping");
+  thread_pool_t *pool = thread_pool_create(0);
+  for (int size = 1 << 16; size <= max_size * 256; size *= 4) {
+    measure_size(size, pool);
+  }
+  thread_pool_delete(pool);
+}
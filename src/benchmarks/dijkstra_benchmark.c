@@ -0,0 +1,67 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define DIJKSTRA_BENCHMARK_QUERIES 8
+
+/**
+ * @brief times the matrix and heap versions on the same random queries
+ */
+static void measure_graph(graph_t *graph, csr_graph_t *csr, const char *name) {
+  if (!graph || !csr) return;
+  const int size = csr->size;
+  int sources[DIJKSTRA_BENCHMARK_QUERIES], targets[DIJKSTRA_BENCHMARK_QUERIES];
+  unsigned state = 17u;
+  for (int i = 0; i < DIJKSTRA_BENCHMARK_QUERIES; i++) {
+    sources[i] = (int)(bench_random_next(&state) % (unsigned)size);
+    targets[i] = (int)(bench_random_next(&state) % (unsigned)size);
+  }
+  char label[64];
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  for (int i = 0; i < DIJKSTRA_BENCHMARK_QUERIES; i++) {
+    get_shortest_path_between_vertices(graph, sources[i], targets[i]);
+  }
+  snprintf(label, sizeof(label), "dijkstra %s, matrix scan", name);
+  print_benchmark_line(label, size,
+                       bench_timer_stop(&timer) / DIJKSTRA_BENCHMARK_QUERIES);
+
+  bench_timer_start(&timer);
+  for (int i = 0; i < DIJKSTRA_BENCHMARK_QUERIES; i++) {
+    get_shortest_path_between_vertices_csr(csr, sources[i], targets[i]);
+  }
+  snprintf(label, sizeof(label), "dijkstra %s, csr 4-ary heap", name);
+  print_benchmark_line(label, size,
+                       bench_timer_stop(&timer) / DIJKSTRA_BENCHMARK_QUERIES);
+}
+
+static void measure_size(int size) {
+  csr_graph_t *csr = benchmark_random_csr_graph(size, 8, 3u);
+  graph_t *graph = graph_from_csr(csr);
+  measure_graph(graph, csr, "degree 8");
+  graph_delete(graph);
+  csr_graph_delete(csr);
+
+  const int kDensities[] = {1, 10, 50};
+  for (int i = 0; i < 3; i++) {
+    char name[16];
+    snprintf(name, sizeof(name), "%d%%", kDensities[i]);
+    graph = benchmark_random_graph(size, kDensities[i], 9u);
+    csr = graph ? graph_to_csr(graph) : NULL;
+    measure_graph(graph, csr, name);
+    csr_graph_delete(csr);
+    graph_delete(graph);
+  }
+}
+
+/**
+ * @brief compares the O(V²) matrix Dijkstra with the heap-based csr Dijkstra
+ * from sparse (average degree 8) to dense (50%) random directed graphs
+ * @param max_size largest graph size to measure
+ */
+void run_dijkstra_benchmark(int max_size) {
+  print_benchmark_header("Dijkstra: minimum scan vs indexed heap by density");
+  for (int size = 1000; size <= max_size; size *= 2) {
+    measure_size(size);
+  }
+}
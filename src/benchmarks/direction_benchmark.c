@@ -0,0 +1,45 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+static void measure_scale(int scale) {
+  csr_graph_t *graph = benchmark_rmat_graph(scale, 8, 5u);
+  graph_traversal_result_t *order =
+      graph ? traversal_result_create(graph->size) : NULL;
+  graph_levels_result_t *levels =
+      graph ? levels_result_create(graph->size) : NULL;
+  if (graph && order && levels) {
+    const int kStarts = 8;
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    for (int i = 0; i < kStarts; i++) {
+      breadth_first_search_csr(graph, benchmark_connected_vertex(graph, i),
+                               order);
+    }
+    print_benchmark_line("bfs r-mat, top-down csr", graph->size,
+                         bench_timer_stop(&timer) / kStarts);
+
+    bench_timer_start(&timer);
+    for (int i = 0; i < kStarts; i++) {
+      breadth_first_search_direction_optimizing(
+          graph, NULL, benchmark_connected_vertex(graph, i), levels);
+    }
+    print_benchmark_line("bfs r-mat, direction-optimizing", graph->size,
+                         bench_timer_stop(&timer) / kStarts);
+  }
+  levels_result_delete(levels);
+  traversal_result_delete(order);
+  csr_graph_delete(graph);
+}
+
+/**
+ * @brief compares top-down BFS with direction-optimizing BFS on power-law
+ * graphs of 8 * 2 * V directed edges
+ * @param max_size largest graph measured has max_size * 256 vertices
+ */
+void run_direction_benchmark(int max_size) {
+  print_benchmark_header("BFS on power-law graphs: top-down vs direction");
+  for (int scale = 14; (1 << scale) <= max_size * 256; scale += 2) {
+    measure_scale(scale);
+  }
+}
@@ -0,0 +1,84 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "benchmark.h"
+
+#define DOT_BENCHMARK_FILE "graph_benchmark_export.dot"
+
+static const int kDotSizes[] = {1000, 2000, 5000, 10000};
+
+/**
+ * Previous exporter: one fprintf per edge, column cells read one by one.
+ * Kept here only as the baseline.
+ */
+static void legacy_export_graph_to_dot(const graph_t *graph,
+                                       const char *filename) {
+  FILE *file = fopen(filename, "w");
+  if (!file) return;
+  fprintf(file, "digraph {\n");
+  const int size = graph->adjacency->size;
+  for (int i = 0; i < size; i++) {
+    for (int j = i + 1; j < size; j++) {
+      const int weight_ij = graph->adjacency->data[i][j];
+      const int weight_ji = graph->adjacency->data[j][i];
+      if (weight_ij != 0) {
+        fprintf(file, "    %d -> %d [label=\"%d\"];\n", i, j, weight_ij);
+      }
+      if (weight_ji != 0) {
+        fprintf(file, "    %d -> %d [label=\"%d\"];\n", j, i, weight_ji);
+      }
+    }
+  }
+  fprintf(file, "}\n");
+  fclose(file);
+}
+
+static void print_export_line(const char *name, int size, double seconds) {
+  struct stat info;
+  const double megabytes = stat(DOT_BENCHMARK_FILE, &info) == 0
+                               ? (double)info.st_size / (1024.0 * 1024.0)
+                               : 0.0;
+  printf("%-36s V=%-6d %12.6f s %8.1f MB/s\n", name, size, seconds,
+         seconds > 0 ? megabytes / seconds : 0.0);
+}
+
+static void measure_export(int size) {
+  graph_t *graph = benchmark_random_graph(size, 50, 13u);
+  if (!graph) return;
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  legacy_export_graph_to_dot(graph, DOT_BENCHMARK_FILE);
+  print_export_line("dot, fprintf per edge", size, bench_timer_stop(&timer));
+
+  bench_timer_start(&timer);
+  export_graph_to_dot(graph, DOT_BENCHMARK_FILE);
+  print_export_line("dot, buffered writer", size, bench_timer_stop(&timer));
+
+  dot_export_options_t options = dot_export_default_options();
+  options.sample_rate = 0.01;
+  bench_timer_start(&timer);
+  export_graph_to_dot_with_options(graph, DOT_BENCHMARK_FILE, &options);
+  print_export_line("dot, 1% sample", size, bench_timer_stop(&timer));
+
+  options = dot_export_default_options();
+  options.top_k = 10000;
+  bench_timer_start(&timer);
+  export_graph_to_dot_with_options(graph, DOT_BENCHMARK_FILE, &options);
+  print_export_line("dot, top 10000 edges", size, bench_timer_stop(&timer));
+  graph_delete(graph);
+  remove(DOT_BENCHMARK_FILE);
+}
+
+/**
+ * @brief compares the fprintf DOT export with the buffered writer and its
+ * sampling and top-k filters on graphs with 50% density
+ * @param max_size largest graph size to measure
+ */
+void run_dot_benchmark(int max_size) {
+  print_benchmark_header("DOT export: fprintf, buffered writer, filters");
+  for (size_t i = 0; i < sizeof(kDotSizes) / sizeof(kDotSizes[0]); i++) {
+    if (kDotSizes[i] <= max_size) measure_export(kDotSizes[i]);
+  }
+}
@@ -0,0 +1,53 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define ENGINES_BENCHMARK_QUERIES 16
+
+/**
+ * @brief draws new weights in [1, max_weight] and records the maximum
+ */
+static void reweight(csr_graph_t *graph, int max_weight) {
+  unsigned state = 29u;
+  for (int e = 0; e < graph->edge_count; e++) {
+    graph->weights[e] =
+        1 + (int)(bench_random_next(&state) % (unsigned)max_weight);
+  }
+  graph->max_weight = csr_graph_scan_max_weight(graph);
+}
+
+static void measure_engine(const csr_graph_t *graph, int max_weight,
+                           shortest_path_engine_t engine, const char *name) {
+  unsigned state = 5u;
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  for (int i = 0; i < ENGINES_BENCHMARK_QUERIES; i++) {
+    const int from = (int)(bench_random_next(&state) % (unsigned)graph->size);
+    const int to = (int)(bench_random_next(&state) % (unsigned)graph->size);
+    get_shortest_path_between_vertices_engine(graph, from, to, engine);
+  }
+  char label[64];
+  snprintf(label, sizeof(label), "max weight %d, %s", max_weight, name);
+  print_benchmark_line(label, graph->size,
+                       bench_timer_stop(&timer) / ENGINES_BENCHMARK_QUERIES);
+}
+
+/**
+ * @brief compares the indexed heap, Dial's buckets and the radix heap on
+ * random graphs of average degree 8 with growing maximum weight
+ * @param max_size the graph has max_size * 64 vertices
+ */
+void run_engines_benchmark(int max_size) {
+  print_benchmark_header("Shortest-path engines by maximum edge weight");
+  csr_graph_t *graph = benchmark_random_csr_graph(max_size * 64, 8, 13u);
+  const int kMaxWeights[] = {4, 64, 256, 4096, 1000000};
+  for (int i = 0; graph && i < 5; i++) {
+    reweight(graph, kMaxWeights[i]);
+    measure_engine(graph, kMaxWeights[i], SHORTEST_PATH_ENGINE_HEAP,
+                   "4-ary heap");
+    measure_engine(graph, kMaxWeights[i], SHORTEST_PATH_ENGINE_DIAL, "dial");
+    measure_engine(graph, kMaxWeights[i], SHORTEST_PATH_ENGINE_RADIX,
+                   "radix heap");
+  }
+  csr_graph_delete(graph);
+}
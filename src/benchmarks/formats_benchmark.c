@@ -0,0 +1,51 @@
+#include <stdio.h>
+
+#include "../graph/formats/graph_formats.h"
+#include "benchmark.h"
+
+#define FORMATS_BENCHMARK_MATRIX_FILE "graph_benchmark_formats.txt"
+#define FORMATS_BENCHMARK_EDGE_FILE "graph_benchmark_formats.el"
+
+static void measure_formats(int size) {
+  csr_graph_t *source = benchmark_random_csr_graph(size, 8, 5u);
+  graph_t *dense = source ? graph_from_csr(source) : NULL;
+  bool written =
+      dense &&
+      benchmark_write_matrix_file(dense, FORMATS_BENCHMARK_MATRIX_FILE) &&
+      benchmark_write_edge_list_file(source, FORMATS_BENCHMARK_EDGE_FILE);
+  graph_delete(dense);
+  csr_graph_delete(source);
+  if (written) {
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    csr_graph_t *csr = load_csr_graph_from_file(FORMATS_BENCHMARK_MATRIX_FILE,
+                                                GRAPH_FORMAT_MATRIX);
+    if (csr) {
+      print_benchmark_line("csr from dense matrix text", size,
+                           bench_timer_stop(&timer));
+    }
+    csr_graph_delete(csr);
+
+    bench_timer_start(&timer);
+    csr = load_csr_graph_from_edge_list(FORMATS_BENCHMARK_EDGE_FILE, false);
+    if (csr) {
+      print_benchmark_line("csr from edge list", size,
+                           bench_timer_stop(&timer));
+    }
+    csr_graph_delete(csr);
+  }
+  remove(FORMATS_BENCHMARK_MATRIX_FILE);
+  remove(FORMATS_BENCHMARK_EDGE_FILE);
+}
+
+/**
+ * @brief compares building a sparse graph (8 edges per vertex) from the dense
+ * text matrix and from an edge list
+ * @param max_size largest graph size to measure
+ */
+void run_formats_benchmark(int max_size) {
+  print_benchmark_header("Sparse loading: dense matrix text vs edge list");
+  for (int size = 1000; size <= max_size; size *= 2) {
+    measure_formats(size);
+  }
+}
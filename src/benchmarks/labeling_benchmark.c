@@ -0,0 +1,68 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define LABELING_BENCHMARK_FILE "labeling_benchmark.s21pll"
+
+static int labeling_query(void *index, int from, int to) {
+  return get_shortest_path_labeling(
+      (const pruned_landmark_labeling_t *)index, from, to);
+}
+
+/**
+ * @brief builds, saves and loads the labels, prints their size, then
+ * compares the query latency with Dijkstra
+ */
+static void measure_graph(const csr_graph_t *graph, const char *name) {
+  char label[64];
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  pruned_landmark_labeling_t *labeling =
+      pruned_landmark_labeling_create(graph);
+  snprintf(label, sizeof(label), "%s preprocessing", name);
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+  if (!labeling) return;
+  const long entries = (long)labeling->out.entry_count +
+                       labeling->in.entry_count - 2L * graph->size;
+  printf("%s: %.1f entries per label, longest %d, %ld KiB\n", name,
+         graph->size > 0 ? (double)entries / (2.0 * graph->size) : 0.0,
+         labeling->max_label_size,
+         (entries + 2L * graph->size) * 2L * (long)sizeof(int) / 1024);
+  bench_timer_start(&timer);
+  const bool saved =
+      save_pruned_landmark_labeling_to_file(labeling, LABELING_BENCHMARK_FILE);
+  snprintf(label, sizeof(label), "%s save", name);
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+  bench_timer_start(&timer);
+  pruned_landmark_labeling_t *loaded =
+      saved ? load_pruned_landmark_labeling_from_file(LABELING_BENCHMARK_FILE)
+            : NULL;
+  snprintf(label, sizeof(label), "%s load", name);
+  print_benchmark_line(label, graph->size, bench_timer_stop(&timer));
+  remove(LABELING_BENCHMARK_FILE);
+  // a single label query comes close to the timer resolution
+  const benchmark_engine_t engine = {"labeling", labeling_query,
+                                     loaded ? loaded : labeling, true};
+  benchmark_point_to_point(graph, &engine, 1, name);
+  pruned_landmark_labeling_delete(loaded);
+  pruned_landmark_labeling_delete(labeling);
+}
+
+/**
+ * @brief pruned landmark labeling on two R-MAT graphs, the small-diameter
+ * power-law workload the labels are meant for. Degree order separates
+ * nothing on graphs of uniform degree such as grids or road networks, their
+ * labels grow to a large fraction of the vertices; CH and ALT serve those.
+ * @param max_size the graphs have the largest powers of two not above
+ * max_size and max_size * 4 vertices
+ */
+void run_labeling_benchmark(int max_size) {
+  print_benchmark_header("Point-to-point: pruned landmark labeling");
+  int scale = 1;
+  while ((1 << (scale + 1)) <= max_size) scale++;
+  for (int step = 0; step <= 2; step += 2) {
+    csr_graph_t *rmat = benchmark_rmat_graph(scale + step, 8, 13u);
+    if (rmat) measure_graph(rmat, "rmat");
+    csr_graph_delete(rmat);
+  }
+}
@@ -0,0 +1,109 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "benchmark.h"
+
+/**
+ * Previous adjacency storage: one calloc per row plus a row pointer array,
+ * zeroed a second time by graph_create. Kept here only as the baseline.
+ */
+static int **legacy_allocate_matrix(int size) {
+  int **matrix = (int **)malloc(size * sizeof(int *));
+  if (!matrix) return NULL;
+  for (int i = 0; i < size; i++) {
+    matrix[i] = (int *)calloc(size, sizeof(int));
+    if (!matrix[i]) {
+      for (int j = 0; j < i; j++) free(matrix[j]);
+      free(matrix);
+      return NULL;
+    }
+  }
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      matrix[i][j] = 0;
+    }
+  }
+  return matrix;
+}
+
+static void legacy_free_matrix(int **matrix, int size) {
+  for (int i = 0; i < size; i++) free(matrix[i]);
+  free(matrix);
+}
+
+/**
+ * @brief BFS over a bare row view, same loop as breadth_first_search
+ * @return number of reached vertices
+ */
+static int rows_breadth_first_search(int **matrix, int size, int *queue,
+                                     char *visited) {
+  memset(visited, 0, (size_t)size);
+  int head = 0, tail = 0;
+  queue[tail++] = 0;
+  visited[0] = 1;
+  while (head < tail) {
+    const int *row = matrix[queue[head++]];
+    for (int n = 0; n < size; n++) {
+      if (row[n] && !visited[n]) {
+        visited[n] = 1;
+        queue[tail++] = n;
+      }
+    }
+  }
+  return tail;
+}
+
+static void measure_allocation(int size) {
+  bench_timer_t timer;
+  bench_timer_start(&timer);
+  int **legacy = legacy_allocate_matrix(size);
+  legacy_free_matrix(legacy, size);
+  print_benchmark_line("create, row per calloc", size,
+                       bench_timer_stop(&timer));
+
+  bench_timer_start(&timer);
+  graph_t *graph = graph_create(size);
+  graph_delete(graph);
+  print_benchmark_line("create, contiguous block", size,
+                       bench_timer_stop(&timer));
+}
+
+static void measure_traversal(int size) {
+  graph_t *graph = benchmark_random_graph(size, 2, 42u);
+  int **legacy = legacy_allocate_matrix(size);
+  int *queue = (int *)malloc(size * sizeof(int));
+  char *visited = (char *)malloc((size_t)size);
+  graph_traversal_result_t *result = traversal_result_create(size);
+  if (graph && legacy && queue && visited && result) {
+    for (int i = 0; i < size; i++) {
+      memcpy(legacy[i], graph->adjacency->data[i], size * sizeof(int));
+    }
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    rows_breadth_first_search(legacy, size, queue, visited);
+    print_benchmark_line("bfs, row per calloc", size,
+                         bench_timer_stop(&timer));
+
+    bench_timer_start(&timer);
+    breadth_first_search(graph, 0, result);
+    print_benchmark_line("bfs, contiguous block", size,
+                         bench_timer_stop(&timer));
+  }
+  traversal_result_delete(result);
+  free(visited);
+  free(queue);
+  if (legacy) legacy_free_matrix(legacy, size);
+  graph_delete(graph);
+}
+
+/**
+ * @brief compares per-row and single-block adjacency storage
+ * @param max_size largest graph size to measure
+ */
+void run_matrix_benchmark(int max_size) {
+  print_benchmark_header("Adjacency storage: allocation and BFS scan");
+  for (int size = 1000; size <= max_size; size *= 2) {
+    measure_allocation(size);
+    measure_traversal(size);
+  }
+}
@@ -0,0 +1,51 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmark.h"
+
+#define MULTI_SOURCE_BENCHMARK_SOURCES 256
+
+static void measure_scale(int scale) {
+  csr_graph_t *graph = benchmark_rmat_graph(scale, 8, 31u);
+  int *sources = (int *)malloc(MULTI_SOURCE_BENCHMARK_SOURCES * sizeof(int));
+  graph_traversal_result_t *order =
+      graph ? traversal_result_create(graph->size) : NULL;
+  int *distances =
+      graph ? (int *)malloc((size_t)MULTI_SOURCE_BENCHMARK_SOURCES *
+                            graph->size * sizeof(int))
+            : NULL;
+  if (graph && sources && order && distances) {
+    for (int i = 0; i < MULTI_SOURCE_BENCHMARK_SOURCES; i++) {
+      sources[i] = benchmark_connected_vertex(graph, i);
+    }
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    for (int i = 0; i < MULTI_SOURCE_BENCHMARK_SOURCES; i++) {
+      breadth_first_search_csr(graph, sources[i], order);
+    }
+    print_benchmark_line("256 bfs r-mat, one at a time", graph->size,
+                         bench_timer_stop(&timer));
+
+    bench_timer_start(&timer);
+    multi_source_breadth_first_search(
+        graph, sources, MULTI_SOURCE_BENCHMARK_SOURCES, distances);
+    print_benchmark_line("256 bfs r-mat, bit-parallel batches", graph->size,
+                         bench_timer_stop(&timer));
+  }
+  free(distances);
+  traversal_result_delete(order);
+  free(sources);
+  csr_graph_delete(graph);
+}
+
+/**
+ * @brief compares 256 separate BFS runs with the batched bit-parallel BFS
+ * that also returns all hop distances
+ * @param max_size largest graph measured has max_size * 64 vertices
+ */
+void run_multi_source_benchmark(int max_size) {
+  print_benchmark_header("Many-source BFS: separate runs vs MS-BFS");
+  for (int scale = 12; (1 << scale) <= max_size * 64; scale += 2) {
+    measure_scale(scale);
+  }
+}
@@ -0,0 +1,55 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+static const int kThreadCounts[] = {1, 2, 4, 8};
+
+static void measure_scale(int scale) {
+  csr_graph_t *graph = benchmark_rmat_graph(scale, 16, 9u);
+  graph_traversal_result_t *order =
+      graph ? traversal_result_create(graph->size) : NULL;
+  graph_levels_result_t *levels =
+      graph ? levels_result_create(graph->size) : NULL;
+  if (graph && order && levels) {
+    const int kStarts = 4;
+    char name[64];
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    for (int i = 0; i < kStarts; i++) {
+      breadth_first_search_csr(graph, benchmark_connected_vertex(graph, i),
+                               order);
+    }
+    print_benchmark_line("bfs r-mat, sequential csr", graph->size,
+                         bench_timer_stop(&timer) / kStarts);
+    for (size_t t = 0; t < sizeof(kThreadCounts) / sizeof(kThreadCounts[0]);
+         t++) {
+      thread_pool_t *pool = thread_pool_create(kThreadCounts[t]);
+      if (!pool) continue;
+      bench_timer_start(&timer);
+      for (int i = 0; i < kStarts; i++) {
+        breadth_first_search_parallel(
+            graph, benchmark_connected_vertex(graph, i), pool, order, levels);
+      }
+      snprintf(name, sizeof(name), "bfs r-mat, parallel %d threads",
+               kThreadCounts[t]);
+      print_benchmark_line(name, graph->size,
+                           bench_timer_stop(&timer) / kStarts);
+      thread_pool_delete(pool);
+    }
+  }
+  levels_result_delete(levels);
+  traversal_result_delete(order);
+  csr_graph_delete(graph);
+}
+
+/**
+ * @brief compares sequential BFS with the level-synchronous parallel BFS on
+ * power-law graphs of 16 * 2 * V directed edges for 1..8 threads
+ * @param max_size largest graph measured has max_size * 256 vertices
+ */
+void run_parallel_bfs_benchmark(int max_size) {
+  print_benchmark_header("BFS on power-law graphs: sequential vs parallel");
+  for (int scale = 16; (1 << scale) <= max_size * 256; scale += 2) {
+    measure_scale(scale);
+  }
+}
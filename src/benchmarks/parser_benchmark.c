@@ -0,0 +1,86 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "benchmark.h"
+
+#define PARSER_BENCHMARK_FILE "graph_benchmark_parser.txt"
+
+static const int kParserSizes[] = {1000, 2000, 5000, 10000, 20000};
+
+/**
+ * Previous loader: one fscanf("%d") per cell. Kept here only as the baseline.
+ */
+static bool legacy_load_graph_from_file(graph_t *graph, const char *filename) {
+  FILE *file = fopen(filename, "r");
+  if (!file) return false;
+  int size = 0;
+  bool success = fscanf(file, "%d", &size) == 1 && size > 0 &&
+                 size == graph->adjacency->size;
+  for (int i = 0; i < size && success; i++) {
+    int *row = matrix_row(graph->adjacency, i);
+    for (int j = 0; j < size && success; j++) {
+      success = fscanf(file, "%d", &row[j]) == 1;
+    }
+  }
+  fclose(file);
+  return success;
+}
+
+static void print_throughput(const char *name, int size, double seconds,
+                             double megabytes) {
+  printf("%-36s V=%-6d %12.6f s %8.1f MB/s\n", name, size, seconds,
+         seconds > 0 ? megabytes / seconds : 0.0);
+}
+
+static void measure_parse(int size) {
+  graph_t *source = benchmark_random_graph(size, 10, 11u);
+  bool written =
+      source && benchmark_write_matrix_file(source, PARSER_BENCHMARK_FILE);
+  graph_delete(source);
+  struct stat info;
+  if (!written || stat(PARSER_BENCHMARK_FILE, &info) != 0) return;
+  const double megabytes = (double)info.st_size / (1024.0 * 1024.0);
+
+  graph_t *graph = graph_create(size);
+  if (graph) {
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    if (legacy_load_graph_from_file(graph, PARSER_BENCHMARK_FILE)) {
+      print_throughput("parse, fscanf", size, bench_timer_stop(&timer),
+                       megabytes);
+    }
+    bench_timer_start(&timer);
+    if (load_graph_from_file(graph, PARSER_BENCHMARK_FILE)) {
+      print_throughput("parse, block scanner", size, bench_timer_stop(&timer),
+                       megabytes);
+    }
+    const int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    for (int threads = 1; threads <= cores; threads *= 2) {
+      char name[64];
+      snprintf(name, sizeof(name), "parse, parallel %d threads", threads);
+      bench_timer_start(&timer);
+      if (load_graph_from_file_parallel(graph, PARSER_BENCHMARK_FILE,
+                                        threads)) {
+        print_throughput(name, size, bench_timer_stop(&timer), megabytes);
+      }
+    }
+  }
+  graph_delete(graph);
+  remove(PARSER_BENCHMARK_FILE);
+}
+
+/**
+ * @brief compares fscanf parsing with the block scanner used by
+ * load_graph_from_file and with load_graph_from_file_parallel
+ * @param max_size largest graph size to measure
+ */
+void run_parser_benchmark(int max_size) {
+  print_benchmark_header(
+      "Text matrix parsing: fscanf, block scanner, parallel chunks");
+  for (size_t i = 0; i < sizeof(kParserSizes) / sizeof(kParserSizes[0]); i++) {
+    if (kParserSizes[i] <= max_size) measure_parse(kParserSizes[i]);
+  }
+}
@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmark.h"
+
+#define SSSP_TREE_BENCHMARK_TARGETS 200
+
+static void measure_matrix(int size) {
+  graph_t *graph = benchmark_random_graph(size, 2, 41u);
+  shortest_path_tree_t *tree = shortest_path_tree_create(size);
+  int *path = (int *)malloc((size_t)size * sizeof(int));
+  if (graph && tree && path) {
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    for (int t = 0; t < SSSP_TREE_BENCHMARK_TARGETS; t++) {
+      get_shortest_path_between_vertices(graph, 0, t * (size / 200));
+    }
+    print_benchmark_line("200 targets matrix, one query each", size,
+                         bench_timer_stop(&timer));
+    bench_timer_start(&timer);
+    get_shortest_path_tree(graph, 0, tree);
+    for (int t = 0; t < SSSP_TREE_BENCHMARK_TARGETS; t++) {
+      shortest_path_tree_path(tree, t * (size / 200), path);
+    }
+    print_benchmark_line("200 targets matrix, tree + paths", size,
+                         bench_timer_stop(&timer));
+  }
+  free(path);
+  shortest_path_tree_delete(tree);
+  graph_delete(graph);
+}
+
+static void measure_csr(int size) {
+  csr_graph_t *graph = benchmark_random_csr_graph(size, 8, 43u);
+  shortest_path_tree_t *tree = shortest_path_tree_create(size);
+  int *path = (int *)malloc((size_t)size * sizeof(int));
+  if (graph && tree && path) {
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    for (int t = 0; t < SSSP_TREE_BENCHMARK_TARGETS; t++) {
+      get_shortest_path_between_vertices_csr(graph, 0, t * (size / 200));
+    }
+    print_benchmark_line("200 targets csr, one query each", size,
+                         bench_timer_stop(&timer));
+    bench_timer_start(&timer);
+    get_shortest_path_tree_csr(graph, 0, tree);
+    for (int t = 0; t < SSSP_TREE_BENCHMARK_TARGETS; t++) {
+      shortest_path_tree_path(tree, t * (size / 200), path);
+    }
+    print_benchmark_line("200 targets csr, tree + paths", size,
+                         bench_timer_stop(&timer));
+  }
+  free(path);
+  shortest_path_tree_delete(tree);
+  csr_graph_delete(graph);
+}
+
+/**
+ * @brief compares answering 200 targets of one source with one query each
+ * against one single-source tree followed by path lookups
+ * @param max_size largest matrix graph, the csr graph has 16 times more
+ * vertices
+ */
+void run_sssp_tree_benchmark(int max_size) {
+  print_benchmark_header("One source, many targets: queries vs tree");
+  measure_matrix(max_size / 2);
+  measure_csr(max_size * 16);
+}
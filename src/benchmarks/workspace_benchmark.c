@@ -0,0 +1,54 @@
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#define WORKSPACE_BENCHMARK_QUERIES 50
+
+static void measure_queries(int size, int density_percent) {
+  graph_t *graph = benchmark_random_graph(size, density_percent, 17u);
+  graph_workspace_t *workspace = graph_workspace_create(graph);
+  graph_traversal_result_t *result = traversal_result_create(size);
+  if (graph && workspace && result) {
+    char name[64];
+    long long checksum = 0, workspace_checksum = 0;
+    bench_timer_t timer;
+    bench_timer_start(&timer);
+    for (int q = 0; q < WORKSPACE_BENCHMARK_QUERIES; q++) {
+      depth_first_search(graph, q % size, result);
+      checksum += result->size;
+      checksum += get_shortest_path_between_vertices(graph, q % size,
+                                                     (q * 7 + 1) % size);
+    }
+    snprintf(name, sizeof(name), "dfs + dijkstra %d%%, allocating",
+             density_percent);
+    print_benchmark_line(name, size, bench_timer_stop(&timer));
+
+    bench_timer_start(&timer);
+    for (int q = 0; q < WORKSPACE_BENCHMARK_QUERIES; q++) {
+      depth_first_search_with_workspace(workspace, q % size, result);
+      workspace_checksum += result->size;
+      workspace_checksum += get_shortest_path_between_vertices_with_workspace(
+          workspace, q % size, (q * 7 + 1) % size);
+    }
+    snprintf(name, sizeof(name), "dfs + dijkstra %d%%, workspace",
+             density_percent);
+    print_benchmark_line(name, size, bench_timer_stop(&timer));
+    if (checksum != workspace_checksum) printf("workspace results differ\n");
+  }
+  traversal_result_delete(result);
+  graph_workspace_delete(workspace);
+  graph_delete(graph);
+}
+
+/**
+ * @brief compares repeated queries that allocate and clear their scratch
+ * with the same queries reusing a generation-stamped workspace
+ * @param max_size largest graph size to measure
+ */
+void run_workspace_benchmark(int max_size) {
+  print_benchmark_header("Repeated queries: allocating vs workspace");
+  for (int size = 500; size <= max_size; size *= 2) {
+    measure_queries(size, 1);
+    measure_queries(size, 20);
+  }
+}
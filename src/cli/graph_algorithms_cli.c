@@ -13,6 +13,7 @@
 #include <linux/limits.h>
 #endif
 
+#include "../graph/formats/graph_formats.h"
 #include "../graph/s21_graph.h"
 #include "../graph_algorithms/s21_graph_algorithms.h"
 
@@ -399,13 +400,37 @@ int load_graph_from_file_improved(graph_t **graph) {
     graph_delete(*graph);
   }
 
+  if (is_graph_binary_file(filename)) {
+    *graph = map_graph_from_binary_file(filename, true);
+    if (*graph) {
+      printf("\nGraph mapped from binary file: %s\n", filename);
+      printf("Graph order: %d\n", get_order(*graph));
+      return 1;
+    }
+    printf("Error mapping binary graph file '%s'\n", filename);
+    return 0;
+  }
+
+  if (detect_graph_file_format(filename) != GRAPH_FORMAT_MATRIX) {
+    csr_graph_t *csr = load_csr_graph_from_file(filename, GRAPH_FORMAT_AUTO);
+    *graph = csr ? graph_from_csr(csr) : NULL;
+    csr_graph_delete(csr);
+    if (*graph) {
+      printf("\nGraph loaded from edge list file: %s\n", filename);
+      printf("Graph order: %d\n", get_order(*graph));
+      return 1;
+    }
+    printf("Error loading graph from file '%s'\n", filename);
+    return 0;
+  }
+
   *graph = graph_create(0);
   if (!*graph) {
     printf("Error creating graph structure!\n");
     return 0;
   }
 
-  if (load_graph_from_file(*graph, filename)) {
+  if (load_graph_from_file_parallel(*graph, filename, 0)) {
     printf("\nGraph loaded successfully from: %s\n", filename);
     printf("Graph order: %d\n", get_order(*graph));
     return 1;
@@ -455,6 +480,24 @@ void handle_export_to_dot(graph_t *graph) {
   printf("Graph successfully exported to %s\n", filename);
 }
 
+void handle_save_to_binary(graph_t *graph) {
+  if (graph == NULL || graph->adjacency == NULL) {
+    printf("\n):\tGraph is not loaded!\t:(\n");
+    return;
+  }
+  char filename[256];
+  printf("Enter filename to save binary graph (e.g., graph.s21g): ");
+  if (scanf("%255s", filename) != 1) {
+    printf("\n):\tInvalid filename!\t:(\n");
+    return;
+  }
+  if (save_graph_to_binary_file(graph, filename)) {
+    printf("Graph successfully saved to %s\n", filename);
+  } else {
+    printf("\n):\tFailed to save graph to %s\t:(\n", filename);
+  }
+}
+
 bool handle_load_new_graph(graph_t **graph) {
   if (load_graph(graph)) {
     return true;
@@ -473,6 +516,7 @@ void display_algorithms_menu(void) {
   printf("7. How to visualie my graph?\n");
   printf("8. Export graph to DOT file\n");
   printf("9. Load different graph\n");
+  printf("10. Save graph to binary file\n");
   printf("Choose an option (or 'q' to exit): ");
 }
 
@@ -507,6 +551,9 @@ void process_user_choice(int choice, graph_t **graph) {
         return;
       }
       break;
+    case 10:
+      handle_save_to_binary(*graph);
+      break;
     default:
       printf("\nInvalid choice. Try again.\n");
   }
@@ -0,0 +1,493 @@
+#include "graph_binary.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../s21_graph.h"
+
+_Static_assert(sizeof(graph_binary_header_t) == 72,
+               "binary graph header must not contain padding");
+_Static_assert(sizeof(graph_binary_section_prefix_t) == 24,
+               "section file prefix must not contain padding");
+
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+static size_t align_up(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief FNV-1a step over data followed by zeros up to padded_length
+ * @param hash current hash
+ * @param data hashed bytes
+ * @param length number of data bytes
+ * @param padded_length length including zero padding
+ * @return updated hash
+ */
+static uint64_t checksum_update(uint64_t hash, const void* data, size_t length,
+                                size_t padded_length) {
+  const unsigned char* bytes = (const unsigned char*)data;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    memcpy(&word, bytes + i, sizeof(word));
+    hash = (hash ^ word) * FNV_PRIME;
+  }
+  if (i < length) {
+    uint64_t word = 0;
+    memcpy(&word, bytes + i, length - i);
+    hash = (hash ^ word) * FNV_PRIME;
+    i += 8;
+  }
+  for (; i + 8 <= padded_length; i += 8) {
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+/**
+ * @brief FNV-1a over 64-bit words, a trailing partial word is zero-padded
+ * @param data hashed bytes
+ * @param length number of bytes
+ * @return checksum
+ */
+uint64_t graph_binary_checksum(const void* data, size_t length) {
+  return checksum_update(FNV_OFFSET_BASIS, data, length, length);
+}
+
+static bool write_zeros(FILE* file, size_t count) {
+  static const char kZeros[GRAPH_BINARY_SECTION_ALIGNMENT] = {0};
+  bool success = true;
+  while (success && count > 0) {
+    const size_t chunk = count < sizeof(kZeros) ? count : sizeof(kZeros);
+    success = fwrite(kZeros, 1, chunk, file) == chunk;
+    count -= chunk;
+  }
+  return success;
+}
+
+/**
+ * @brief writes one payload section and updates header size and checksum
+ * @param padded_length section length including zero padding
+ * @return true if success false if error
+ */
+static bool write_section(FILE* file, graph_binary_header_t* header,
+                          const void* data, size_t length,
+                          size_t padded_length) {
+  bool success = length == 0 || fwrite(data, 1, length, file) == length;
+  success = success && write_zeros(file, padded_length - length);
+  header->payload_size += padded_length;
+  header->checksum =
+      checksum_update(header->checksum, data, length, padded_length);
+  return success;
+}
+
+static void init_header(graph_binary_header_t* header,
+                        graph_binary_layout_t layout, int64_t vertex_count) {
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, GRAPH_BINARY_MAGIC, sizeof(header->magic));
+  header->version = GRAPH_BINARY_VERSION;
+  header->layout = (uint32_t)layout;
+  header->endian_tag = GRAPH_BINARY_ENDIAN_TAG;
+  header->cell_size = (uint32_t)sizeof(int);
+  header->vertex_count = vertex_count;
+  header->payload_offset =
+      align_up(sizeof(*header), GRAPH_BINARY_PAYLOAD_ALIGNMENT);
+  header->checksum = FNV_OFFSET_BASIS;
+}
+
+static FILE* begin_container(const char* filename,
+                             const graph_binary_header_t* header) {
+  FILE* file = fopen(filename, "wb");
+  if (file && (fwrite(header, sizeof(*header), 1, file) != 1 ||
+               !write_zeros(file, header->payload_offset - sizeof(*header)))) {
+    fclose(file);
+    file = NULL;
+  }
+  return file;
+}
+
+static bool finish_container(FILE* file, const graph_binary_header_t* header,
+                             bool success) {
+  success = success && fseek(file, 0, SEEK_SET) == 0 &&
+            fwrite(header, sizeof(*header), 1, file) == 1;
+  return fclose(file) == 0 && success;
+}
+
+/**
+ * @brief save adjacency matrix to the binary container (dense layout)
+ * @param graph Pointer to graph
+ * @param filename Name of file
+ * @return true if success false if error
+ */
+bool save_graph_to_binary_file(const graph_t* graph, const char* filename) {
+  if (!graph || !graph->adjacency || !graph->adjacency->data || !filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return false;
+  }
+  const matrix_t* adjacency = graph->adjacency;
+  graph_binary_header_t header;
+  init_header(&header, GRAPH_BINARY_DENSE, adjacency->size);
+  header.stride = matrix_row_stride(adjacency->size);
+  FILE* file = begin_container(filename, &header);
+  if (!file) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return false;
+  }
+  bool success = true;
+  for (int i = 0; i < adjacency->size && success; i++) {
+    success = write_section(file, &header, adjacency->data[i],
+                            (size_t)adjacency->size * sizeof(int),
+                            (size_t)header.stride * sizeof(int));
+  }
+  success = finish_container(file, &header, success);
+  if (!success) {
+    fprintf(stderr, "Error writing binary graph file\n");
+  }
+  return success;
+}
+
+/**
+ * @brief save csr graph to the binary container (csr layout)
+ * @param graph Pointer to csr graph
+ * @param filename Name of file
+ * @return true if success false if error
+ */
+bool save_csr_graph_to_binary_file(const csr_graph_t* graph,
+                                   const char* filename) {
+  if (!graph || !filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return false;
+  }
+  graph_binary_header_t header;
+  init_header(&header, GRAPH_BINARY_CSR, graph->size);
+  header.edge_count = graph->edge_count;
+  FILE* file = begin_container(filename, &header);
+  if (!file) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return false;
+  }
+  const size_t offsets_length = ((size_t)graph->size + 1) * sizeof(int);
+  const size_t edges_length = (size_t)graph->edge_count * sizeof(int);
+  bool success =
+      write_section(file, &header, graph->offsets, offsets_length,
+                    align_up(offsets_length, GRAPH_BINARY_SECTION_ALIGNMENT));
+  success = success &&
+            write_section(file, &header, graph->targets, edges_length,
+                          align_up(edges_length, GRAPH_BINARY_SECTION_ALIGNMENT));
+  success = success &&
+            write_section(file, &header, graph->weights, edges_length,
+                          align_up(edges_length, GRAPH_BINARY_SECTION_ALIGNMENT));
+  success = finish_container(file, &header, success);
+  if (!success) {
+    fprintf(stderr, "Error writing binary graph file\n");
+  }
+  return success;
+}
+
+/**
+ * @brief read and check the magic of a binary graph header
+ * @param filename Name of file
+ * @param header receives the header
+ * @return true if the file starts with a binary graph header
+ */
+bool read_graph_binary_header(const char* filename,
+                              graph_binary_header_t* header) {
+  if (!filename || !header) return false;
+  FILE* file = fopen(filename, "rb");
+  if (!file) return false;
+  bool success = fread(header, sizeof(*header), 1, file) == 1 &&
+                 memcmp(header->magic, GRAPH_BINARY_MAGIC,
+                        sizeof(header->magic)) == 0;
+  fclose(file);
+  return success;
+}
+
+/**
+ * @brief check whether the file is a binary graph container
+ * @param filename Name of file
+ * @return true if the file starts with GRAPH_BINARY_MAGIC
+ */
+bool is_graph_binary_file(const char* filename) {
+  graph_binary_header_t header;
+  return read_graph_binary_header(filename, &header);
+}
+
+static size_t expected_payload_size(const graph_binary_header_t* header) {
+  const size_t vertex_count = (size_t)header->vertex_count;
+  if (header->layout == GRAPH_BINARY_DENSE) {
+    return vertex_count * (size_t)header->stride * sizeof(int);
+  }
+  return align_up((vertex_count + 1) * sizeof(int),
+                  GRAPH_BINARY_SECTION_ALIGNMENT) +
+         2 * align_up((size_t)header->edge_count * sizeof(int),
+                      GRAPH_BINARY_SECTION_ALIGNMENT);
+}
+
+static bool validate_header(const graph_binary_header_t* header,
+                            size_t file_length, graph_binary_layout_t layout) {
+  bool valid =
+      memcmp(header->magic, GRAPH_BINARY_MAGIC, sizeof(header->magic)) == 0 &&
+      header->version == GRAPH_BINARY_VERSION &&
+      header->endian_tag == GRAPH_BINARY_ENDIAN_TAG &&
+      header->cell_size == sizeof(int) && header->layout == (uint32_t)layout &&
+      header->vertex_count >= 0 && header->vertex_count < INT_MAX &&
+      header->edge_count >= 0 && header->edge_count < INT_MAX &&
+      header->payload_offset % GRAPH_BINARY_SECTION_ALIGNMENT == 0 &&
+      header->payload_offset >= sizeof(graph_binary_header_t) &&
+      header->payload_offset <= file_length &&
+      header->payload_size <= file_length - header->payload_offset;
+  if (valid && layout == GRAPH_BINARY_DENSE) {
+    valid = header->stride >= header->vertex_count &&
+            header->stride <= (int64_t)INT_MAX &&
+            (header->vertex_count == 0 ||
+             (uint64_t)header->stride <=
+                 SIZE_MAX / sizeof(int) / (uint64_t)header->vertex_count);
+  }
+  return valid && header->payload_size == expected_payload_size(header);
+}
+
+/**
+ * @brief maps the file and checks header, layout and optionally checksum
+ * @return mapping or NULL if error (reported to stderr)
+ */
+static graph_mapping_t* open_container(const char* filename,
+                                       graph_binary_layout_t layout,
+                                       bool verify_checksum,
+                                       graph_binary_header_t* header) {
+  if (!filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return NULL;
+  }
+  graph_mapping_t* mapping = graph_mapping_open(filename);
+  if (!mapping) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return NULL;
+  }
+  bool success = mapping->length >= sizeof(*header);
+  if (success) {
+    memcpy(header, mapping->address, sizeof(*header));
+    success = validate_header(header, mapping->length, layout);
+  }
+  if (!success) {
+    fprintf(stderr, "Invalid binary graph header\n");
+  } else if (verify_checksum &&
+             graph_binary_checksum(
+                 (const char*)mapping->address + header->payload_offset,
+                 header->payload_size) != header->checksum) {
+    fprintf(stderr, "Binary graph checksum mismatch\n");
+    success = false;
+  }
+  if (!success) {
+    graph_mapping_close(mapping);
+    mapping = NULL;
+  }
+  return mapping;
+}
+
+/**
+ * @brief map binary dense graph read-only, the adjacency cells point into
+ * the mapping and must not be modified; graph_delete unmaps the file
+ * @param filename Name of file
+ * @param verify_checksum hash the whole payload before returning
+ * @return Pointer to graph or NULL if error
+ */
+graph_t* map_graph_from_binary_file(const char* filename,
+                                    bool verify_checksum) {
+  graph_binary_header_t header;
+  graph_mapping_t* mapping =
+      open_container(filename, GRAPH_BINARY_DENSE, verify_checksum, &header);
+  if (!mapping) return NULL;
+  const int size = (int)header.vertex_count;
+  graph_t* graph = (graph_t*)calloc(1, sizeof(graph_t));
+  matrix_t* adjacency = (matrix_t*)calloc(1, sizeof(matrix_t));
+  int** rows = (int**)malloc(((size_t)size + 1) * sizeof(int*));
+  if (!graph || !adjacency || !rows) {
+    fprintf(stderr, "Failed to prepare graph structure\n");
+    free(graph);
+    free(adjacency);
+    free(rows);
+    graph_mapping_close(mapping);
+    return NULL;
+  }
+  adjacency->size = size;
+  adjacency->stride = (int)header.stride;
+  adjacency->cells =
+      size > 0 ? (int*)((char*)mapping->address + header.payload_offset)
+               : NULL;
+  for (int i = 0; i < size; i++) {
+    rows[i] = adjacency->cells + (size_t)i * (size_t)adjacency->stride;
+  }
+  adjacency->data = rows;
+  graph->adjacency = adjacency;
+  graph->mapping = mapping;
+  return graph;
+}
+
+/**
+ * @brief checks that the rows of a mapped csr graph are non-decreasing and
+ * every target is a vertex, so a damaged or crafted file can not make the
+ * csr algorithms read or write out of bounds; O(V + E)
+ */
+static bool validate_csr_rows(const csr_graph_t* graph) {
+  bool valid = graph->offsets[0] == 0 &&
+               graph->offsets[graph->size] == graph->edge_count;
+  for (int v = 0; valid && v < graph->size; v++) {
+    valid = graph->offsets[v] <= graph->offsets[v + 1];
+  }
+  for (int e = 0; valid && e < graph->edge_count; e++) {
+    valid = graph->targets[e] >= 0 && graph->targets[e] < graph->size;
+  }
+  return valid;
+}
+
+/**
+ * @brief map binary csr graph read-only, the arrays point into the mapping;
+ * csr_graph_delete unmaps the file. Rows and targets are always checked
+ * to stay in range, the weights are read once to record max_weight.
+ * @param filename Name of file
+ * @param verify_checksum hash the whole payload before returning
+ * @return Pointer to csr graph or NULL if error
+ */
+csr_graph_t* map_csr_graph_from_binary_file(const char* filename,
+                                            bool verify_checksum) {
+  graph_binary_header_t header;
+  graph_mapping_t* mapping =
+      open_container(filename, GRAPH_BINARY_CSR, verify_checksum, &header);
+  if (!mapping) return NULL;
+  csr_graph_t* graph = (csr_graph_t*)calloc(1, sizeof(csr_graph_t));
+  if (!graph) {
+    fprintf(stderr, "Failed to prepare graph structure\n");
+    graph_mapping_close(mapping);
+    return NULL;
+  }
+  char* payload = (char*)mapping->address + header.payload_offset;
+  const size_t offsets_length =
+      align_up(((size_t)header.vertex_count + 1) * sizeof(int),
+               GRAPH_BINARY_SECTION_ALIGNMENT);
+  const size_t edges_length = align_up(
+      (size_t)header.edge_count * sizeof(int), GRAPH_BINARY_SECTION_ALIGNMENT);
+  graph->size = (int)header.vertex_count;
+  graph->edge_count = (int)header.edge_count;
+  graph->offsets = (int*)payload;
+  graph->targets = (int*)(payload + offsets_length);
+  graph->weights = (int*)(payload + offsets_length + edges_length);
+  graph->mapping = mapping;
+  if (!validate_csr_rows(graph)) {
+    fprintf(stderr, "Invalid binary graph rows\n");
+    csr_graph_delete(graph);
+    graph = NULL;
+  } else {
+    graph->max_weight = csr_graph_scan_max_weight(graph);
+  }
+  return graph;
+}
+
+/**
+ * @brief fills the common fields of a section file header
+ * @param prefix header start, the caller zeroes the rest of the header
+ * @param magic format magic, at least 8 characters
+ * @param version format version
+ */
+void graph_binary_section_prefix_init(graph_binary_section_prefix_t* prefix,
+                                      const char* magic, uint32_t version) {
+  memset(prefix, 0, sizeof(*prefix));
+  memcpy(prefix->magic, magic, sizeof(prefix->magic));
+  prefix->version = version;
+  prefix->endian_tag = GRAPH_BINARY_ENDIAN_TAG;
+  prefix->cell_size = (uint32_t)sizeof(int);
+}
+
+/**
+ * @brief graph_binary_checksum of every section chained with the FNV prime
+ * @param sections section list
+ * @param section_count number of sections
+ * @return checksum
+ */
+uint64_t graph_binary_sections_checksum(
+    const graph_binary_section_t* sections, int section_count) {
+  uint64_t checksum = 0;
+  for (int s = 0; s < section_count; s++) {
+    checksum = (checksum ^ graph_binary_checksum(
+                               sections[s].data,
+                               sections[s].count * sizeof(int))) *
+               FNV_PRIME;
+  }
+  return checksum;
+}
+
+/**
+ * @brief writes a section file
+ * @param filename Name of file
+ * @param header header starting with graph_binary_section_prefix_t, its
+ * checksum already set
+ * @param header_size header size in bytes
+ * @param sections section list
+ * @param section_count number of sections
+ * @return true if success false if error
+ */
+bool graph_binary_write_sections(const char* filename, const void* header,
+                                 size_t header_size,
+                                 const graph_binary_section_t* sections,
+                                 int section_count) {
+  FILE* file = fopen(filename, "wb");
+  if (!file) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return false;
+  }
+  bool success = fwrite(header, header_size, 1, file) == 1;
+  for (int s = 0; success && s < section_count; s++) {
+    success = fwrite(sections[s].data, sizeof(int), sections[s].count,
+                     file) == sections[s].count;
+  }
+  success = fclose(file) == 0 && success;
+  if (!success) {
+    fprintf(stderr, "Error writing file: %s\n", filename);
+  }
+  return success;
+}
+
+/**
+ * @brief reads a section file header and checks its common fields
+ * @param file file opened for reading at its start
+ * @param magic expected format magic
+ * @param version expected format version
+ * @param header receives the header, starting with
+ * graph_binary_section_prefix_t
+ * @param header_size header size in bytes
+ * @return false on short read or foreign magic, version, byte order or
+ * cell size
+ */
+bool graph_binary_read_section_header(FILE* file, const char* magic,
+                                      uint32_t version, void* header,
+                                      size_t header_size) {
+  if (fread(header, header_size, 1, file) != 1) return false;
+  const graph_binary_section_prefix_t* prefix =
+      (const graph_binary_section_prefix_t*)header;
+  return memcmp(prefix->magic, magic, sizeof(prefix->magic)) == 0 &&
+         prefix->version == version &&
+         prefix->endian_tag == GRAPH_BINARY_ENDIAN_TAG &&
+         prefix->cell_size == sizeof(int);
+}
+
+/**
+ * @brief reads the sections following the header and verifies them
+ * @param file file positioned after the header
+ * @param sections section list, arrays already allocated
+ * @param section_count number of sections
+ * @param checksum checksum stored in the header
+ * @return false on short read or checksum mismatch
+ */
+bool graph_binary_read_sections(FILE* file,
+                                const graph_binary_section_t* sections,
+                                int section_count, uint64_t checksum) {
+  bool success = true;
+  for (int s = 0; success && s < section_count; s++) {
+    success = fread(sections[s].data, sizeof(int), sections[s].count,
+                    file) == sections[s].count;
+  }
+  return success &&
+         graph_binary_sections_checksum(sections, section_count) == checksum;
+}
@@ -0,0 +1,112 @@
+#ifndef S21_GRAPH_BINARY_H
+#define S21_GRAPH_BINARY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Binary graph container:
+ * [header][zero padding up to payload_offset][payload]
+ * The payload starts on a page boundary so a mapped file can be used in
+ * place. Dense payload: vertex_count rows of stride ints. CSR payload:
+ * offsets (vertex_count + 1 ints), targets and weights (edge_count ints),
+ * every section padded to GRAPH_BINARY_SECTION_ALIGNMENT bytes.
+ */
+#define GRAPH_BINARY_MAGIC "S21GRAPH"
+#define GRAPH_BINARY_VERSION 1u
+#define GRAPH_BINARY_ENDIAN_TAG 0x01020304u
+#define GRAPH_BINARY_PAYLOAD_ALIGNMENT 4096
+#define GRAPH_BINARY_SECTION_ALIGNMENT 64
+
+typedef enum {
+  GRAPH_BINARY_DENSE = 1,
+  GRAPH_BINARY_CSR = 2
+} graph_binary_layout_t;
+
+/**
+ * @brief header of the binary graph container
+ * @param magic GRAPH_BINARY_MAGIC without terminating zero
+ * @param version format version, GRAPH_BINARY_VERSION
+ * @param layout graph_binary_layout_t value
+ * @param endian_tag GRAPH_BINARY_ENDIAN_TAG as written by the producer
+ * @param cell_size size of one stored integer in bytes
+ * @param vertex_count number of vertices
+ * @param edge_count number of edges (CSR only)
+ * @param stride row stride in cells (dense only)
+ * @param payload_offset payload start from the beginning of the file
+ * @param payload_size payload length in bytes (multiple of 8)
+ * @param checksum graph_binary_checksum of the payload
+ */
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t layout;
+  uint32_t endian_tag;
+  uint32_t cell_size;
+  int64_t vertex_count;
+  int64_t edge_count;
+  int64_t stride;
+  uint64_t payload_offset;
+  uint64_t payload_size;
+  uint64_t checksum;
+} graph_binary_header_t;
+
+/**
+ * Section file (contraction hierarchy, landmark labels):
+ * [header starting with graph_binary_section_prefix_t][sections]
+ * Every section is an array of native ints written back to back, the
+ * header checksum is graph_binary_sections_checksum of all of them.
+ */
+
+/**
+ * @brief first fields of every section file header
+ * @param magic format magic without terminating zero
+ * @param version format version
+ * @param endian_tag GRAPH_BINARY_ENDIAN_TAG as written by the producer
+ * @param cell_size size of one stored integer in bytes
+ */
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t endian_tag;
+  uint32_t cell_size;
+  uint32_t reserved;
+} graph_binary_section_prefix_t;
+
+/**
+ * @brief one int array of a section file
+ */
+typedef struct {
+  int *data;
+  size_t count;
+} graph_binary_section_t;
+
+uint64_t graph_binary_checksum(const void *data, size_t length);
+void graph_binary_section_prefix_init(graph_binary_section_prefix_t *prefix,
+                                      const char *magic, uint32_t version);
+uint64_t graph_binary_sections_checksum(
+    const graph_binary_section_t *sections, int section_count);
+bool graph_binary_write_sections(const char *filename, const void *header,
+                                 size_t header_size,
+                                 const graph_binary_section_t *sections,
+                                 int section_count);
+bool graph_binary_read_section_header(FILE *file, const char *magic,
+                                      uint32_t version, void *header,
+                                      size_t header_size);
+bool graph_binary_read_sections(FILE *file,
+                                const graph_binary_section_t *sections,
+                                int section_count, uint64_t checksum);
+bool read_graph_binary_header(const char *filename,
+                              graph_binary_header_t *header);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_GRAPH_BINARY_H
@@ -0,0 +1,96 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "graph_mapping.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief fallback for platforms without mmap: copy the file to the heap
+ * @return true if success false if error
+ */
+static bool read_whole_file(const char *filename, graph_mapping_t *mapping) {
+  FILE *file = fopen(filename, "rb");
+  if (!file) return false;
+  bool success = fseek(file, 0, SEEK_END) == 0;
+  long length = success ? ftell(file) : -1;
+  success = success && length >= 0 && fseek(file, 0, SEEK_SET) == 0;
+  if (success) {
+    mapping->length = (size_t)length;
+    mapping->address = malloc(mapping->length ? mapping->length : 1);
+    success = mapping->address != NULL &&
+              fread(mapping->address, 1, mapping->length, file) ==
+                  mapping->length;
+  }
+  fclose(file);
+  return success;
+}
+
+#ifndef _WIN32
+static bool map_whole_file(const char *filename, graph_mapping_t *mapping) {
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  bool success = fstat(fd, &info) == 0 && info.st_size > 0;
+  if (success) {
+    mapping->length = (size_t)info.st_size;
+    mapping->address =
+        mmap(NULL, mapping->length, PROT_READ, MAP_SHARED, fd, 0);
+    success = mapping->address != MAP_FAILED;
+    mapping->mapped = success;
+  }
+  close(fd);
+  return success;
+}
+#endif
+
+/**
+ * @brief maps a whole file read-only, the pages are shared between processes
+ * @param filename Name of file
+ * @return Pointer to mapping or NULL if error
+ */
+graph_mapping_t *graph_mapping_open(const char *filename) {
+  if (!filename) return NULL;
+  graph_mapping_t *mapping = (graph_mapping_t *)calloc(1, sizeof(*mapping));
+  if (!mapping) return NULL;
+  bool success = false;
+#ifndef _WIN32
+  success = map_whole_file(filename, mapping);
+#endif
+  if (!success) {
+    mapping->address = NULL;
+    mapping->mapped = false;
+    success = read_whole_file(filename, mapping);
+  }
+  if (!success) {
+    graph_mapping_close(mapping);
+    mapping = NULL;
+  }
+  return mapping;
+}
+
+/**
+ * @brief unmaps the file and frees the mapping
+ * @param mapping Pointer to mapping
+ */
+void graph_mapping_close(graph_mapping_t *mapping) {
+  if (mapping) {
+#ifndef _WIN32
+    if (mapping->mapped) {
+      munmap(mapping->address, mapping->length);
+    } else {
+      free(mapping->address);
+    }
+#else
+    free(mapping->address);
+#endif
+    free(mapping);
+  }
+}
@@ -0,0 +1,30 @@
+#ifndef S21_GRAPH_MAPPING_H
+#define S21_GRAPH_MAPPING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief read-only view of a whole file
+ * @param address first byte of the file
+ * @param length file length in bytes
+ * @param mapped true if address comes from mmap, false if it is a heap copy
+ */
+typedef struct graph_mapping {
+  void *address;
+  size_t length;
+  bool mapped;
+} graph_mapping_t;
+
+graph_mapping_t *graph_mapping_open(const char *filename);
+void graph_mapping_close(graph_mapping_t *mapping);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_GRAPH_MAPPING_H
@@ -0,0 +1,57 @@
+#include "bit_matrix.h"
+
+#include <stdlib.h>
+
+#include "../matrix/matrix.h"
+
+/**
+ * @brief create zeroed bit matrix, rows padded to whole cache lines
+ * @param size number of vertices
+ * @return pointer to matrix or NULL if error
+ */
+bit_matrix_t *bit_matrix_create(int size) {
+  if (size < 0) return NULL;
+  const int words_per_line = MATRIX_ALIGNMENT / (int)sizeof(uint64_t);
+  const int words_per_row = bit_words_for(size);
+  const int stride =
+      (words_per_row + words_per_line - 1) / words_per_line * words_per_line;
+  bit_matrix_t *matrix = (bit_matrix_t *)calloc(1, sizeof(bit_matrix_t));
+  if (!matrix) return NULL;
+  matrix->block = calloc(
+      1, (size_t)size * (size_t)stride * sizeof(uint64_t) + MATRIX_ALIGNMENT);
+  if (!matrix->block) {
+    free(matrix);
+    return NULL;
+  }
+  const uintptr_t aligned =
+      ((uintptr_t)matrix->block + MATRIX_ALIGNMENT - 1) &
+      ~(uintptr_t)(MATRIX_ALIGNMENT - 1);
+  matrix->words = (uint64_t *)((unsigned char *)matrix->block +
+                               (aligned - (uintptr_t)matrix->block));
+  matrix->size = size;
+  matrix->stride = stride;
+  matrix->words_per_row = words_per_row;
+  return matrix;
+}
+
+/**
+ * @brief delete bit matrix
+ * @param matrix bit matrix pointer
+ */
+void bit_matrix_delete(bit_matrix_t *matrix) {
+  if (matrix) {
+    free(matrix->block);
+    free(matrix);
+  }
+}
+
+/**
+ * @brief memory used by the rows
+ * @param matrix bit matrix pointer
+ * @return size of the rows in bytes
+ */
+size_t bit_matrix_bytes(const bit_matrix_t *matrix) {
+  return matrix ? (size_t)matrix->size * (size_t)matrix->stride *
+                      sizeof(uint64_t)
+                : 0;
+}
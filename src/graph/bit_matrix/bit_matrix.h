@@ -0,0 +1,104 @@
+#ifndef S21_BIT_MATRIX_H
+#define S21_BIT_MATRIX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief number of vertices held by one word of a row
+ */
+#define BIT_MATRIX_WORD_BITS 64
+
+/**
+ * @brief unweighted adjacency with one bit per cell
+ * @param words first word of row 0, aligned to a cache line
+ * @param block allocation the words live in
+ * @param size number of vertices
+ * @param stride distance in words between two rows, rows are padded to a
+ * whole cache line
+ * @param words_per_row number of words that hold vertices
+ */
+typedef struct {
+  uint64_t *words;
+  void *block;
+  int size;
+  int stride;
+  int words_per_row;
+} bit_matrix_t;
+
+/**
+ * @brief row of the bit matrix
+ * @param matrix bit matrix pointer
+ * @param row row index
+ * @return first word of the row
+ */
+static inline uint64_t *bit_matrix_row(const bit_matrix_t *matrix, int row) {
+  return matrix->words + (size_t)row * (size_t)matrix->stride;
+}
+
+static inline bool bit_matrix_test(const bit_matrix_t *matrix, int row,
+                                   int column) {
+  return (bit_matrix_row(matrix, row)[column / BIT_MATRIX_WORD_BITS] >>
+          (column % BIT_MATRIX_WORD_BITS)) &
+         1u;
+}
+
+static inline void bit_matrix_set(bit_matrix_t *matrix, int row, int column) {
+  bit_matrix_row(matrix, row)[column / BIT_MATRIX_WORD_BITS] |=
+      (uint64_t)1 << (column % BIT_MATRIX_WORD_BITS);
+}
+
+/**
+ * @brief index of the lowest set bit
+ * @param word non-zero word
+ * @return bit index 0-63
+ */
+static inline int bit_scan_forward(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int index = 0;
+  while (!(word & 1u)) {
+    word >>= 1;
+    index++;
+  }
+  return index;
+#endif
+}
+
+/**
+ * @brief index of the highest set bit
+ * @param word non-zero word
+ * @return bit index 0-63
+ */
+static inline int bit_scan_reverse(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63 - __builtin_clzll(word);
+#else
+  int index = 63;
+  while (!(word >> 63)) {
+    word <<= 1;
+    index--;
+  }
+  return index;
+#endif
+}
+
+static inline int bit_words_for(int bits) {
+  return (bits + BIT_MATRIX_WORD_BITS - 1) / BIT_MATRIX_WORD_BITS;
+}
+
+bit_matrix_t *bit_matrix_create(int size);
+void bit_matrix_delete(bit_matrix_t *matrix);
+size_t bit_matrix_bytes(const bit_matrix_t *matrix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_BIT_MATRIX_H
@@ -0,0 +1,199 @@
+#include "csr_graph.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief create csr graph with uninitialized edge arrays
+ * @param size number of vertices
+ * @param edge_count number of edges
+ * @return pointer to graph (offsets zeroed, max_weight unknown) or NULL if
+ * error
+ */
+csr_graph_t* csr_graph_create(int size, int edge_count) {
+  if (size < 0 || edge_count < 0) return NULL;
+  csr_graph_t* graph = (csr_graph_t*)calloc(1, sizeof(csr_graph_t));
+  if (!graph) return NULL;
+  graph->size = size;
+  graph->edge_count = edge_count;
+  graph->max_weight = -1;
+  graph->offsets = (int*)calloc((size_t)size + 1, sizeof(int));
+  graph->targets = (int*)malloc(((size_t)edge_count + 1) * sizeof(int));
+  graph->weights = (int*)malloc(((size_t)edge_count + 1) * sizeof(int));
+  if (!graph->offsets || !graph->targets || !graph->weights) {
+    csr_graph_delete(graph);
+    graph = NULL;
+  }
+  return graph;
+}
+
+/**
+ * @brief delete csr graph
+ * @param graph csr graph pointer
+ */
+void csr_graph_delete(csr_graph_t* graph) {
+  if (graph) {
+    if (graph->mapping) {
+      graph_mapping_close(graph->mapping);
+    } else {
+      free(graph->offsets);
+      free(graph->targets);
+      free(graph->weights);
+    }
+    free(graph);
+  }
+}
+
+static bool validate_edges(int size, int edge_count, const int* sources,
+                           const int* targets, const int* weights) {
+  if (size < 0 || edge_count < 0) return false;
+  if (edge_count > 0 && (!sources || !targets || !weights)) return false;
+  for (int e = 0; e < edge_count; e++) {
+    if (sources[e] < 0 || sources[e] >= size || targets[e] < 0 ||
+        targets[e] >= size) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief orders edge indices by (source, target) with two counting sorts
+ * @param counts receives the end of every source row inside order
+ * @param order receives edge indices, zero-weight edges are skipped
+ * @return number of ordered edges
+ */
+static int order_edges(int size, int edge_count, const int* sources,
+                       const int* targets, const int* weights, int* counts,
+                       int* order, int* scratch) {
+  memset(counts, 0, ((size_t)size + 1) * sizeof(int));
+  for (int e = 0; e < edge_count; e++) {
+    if (weights[e] != 0) counts[targets[e] + 1]++;
+  }
+  for (int v = 0; v < size; v++) counts[v + 1] += counts[v];
+  for (int e = 0; e < edge_count; e++) {
+    if (weights[e] != 0) scratch[counts[targets[e]]++] = e;
+  }
+  const int kept = counts[size];
+
+  memset(counts, 0, ((size_t)size + 1) * sizeof(int));
+  for (int i = 0; i < kept; i++) counts[sources[scratch[i]] + 1]++;
+  for (int v = 0; v < size; v++) counts[v + 1] += counts[v];
+  for (int i = 0; i < kept; i++) {
+    const int e = scratch[i];
+    order[counts[sources[e]]++] = e;
+  }
+  return kept;
+}
+
+/**
+ * @brief build csr graph from an edge list in O(V + E)
+ *
+ * Edges with weight 0 are dropped (0 means no edge), parallel edges are
+ * merged keeping the smallest weight.
+ * @param size number of vertices
+ * @param edge_count number of edges in the arrays
+ * @param sources edge sources
+ * @param targets edge targets
+ * @param weights edge weights
+ * @return pointer to graph or NULL if error
+ */
+csr_graph_t* csr_graph_from_edges(int size, int edge_count, const int* sources,
+                                  const int* targets, const int* weights) {
+  if (!validate_edges(size, edge_count, sources, targets, weights)) {
+    return NULL;
+  }
+  int* counts = (int*)malloc(((size_t)size + 1) * sizeof(int));
+  int* order = (int*)malloc(((size_t)edge_count + 1) * sizeof(int));
+  int* scratch = (int*)malloc(((size_t)edge_count + 1) * sizeof(int));
+  csr_graph_t* graph = NULL;
+  if (counts && order && scratch) {
+    const int kept = order_edges(size, edge_count, sources, targets, weights,
+                                 counts, order, scratch);
+    graph = csr_graph_create(size, kept);
+  }
+  if (graph) {
+    int count = 0;
+    int begin = 0;
+    for (int v = 0; v < size; v++) {
+      graph->offsets[v] = count;
+      for (int i = begin; i < counts[v]; i++) {
+        const int e = order[i];
+        if (count > graph->offsets[v] &&
+            graph->targets[count - 1] == targets[e]) {
+          if (weights[e] < graph->weights[count - 1]) {
+            graph->weights[count - 1] = weights[e];
+          }
+        } else {
+          graph->targets[count] = targets[e];
+          graph->weights[count++] = weights[e];
+        }
+      }
+      begin = counts[v];
+    }
+    graph->offsets[size] = count;
+    graph->edge_count = count;
+    graph->max_weight = csr_graph_scan_max_weight(graph);
+  }
+  free(counts);
+  free(order);
+  free(scratch);
+  return graph;
+}
+
+/**
+ * @brief build the reverse graph, edge u -> v becomes v -> u, in O(V + E)
+ *
+ * Targets stay ascending inside every row because sources are visited in
+ * order. The rows of the result list the in-neighbours of each vertex.
+ * @param graph csr graph pointer
+ * @return pointer to the transposed graph or NULL if error
+ */
+csr_graph_t* csr_graph_transpose(const csr_graph_t* graph) {
+  if (!graph || graph->size < 0) return NULL;
+  csr_graph_t* reverse = csr_graph_create(graph->size, graph->edge_count);
+  if (!reverse) return NULL;
+  for (int e = 0; e < graph->edge_count; e++) {
+    reverse->offsets[graph->targets[e] + 1]++;
+  }
+  for (int v = 0; v < graph->size; v++) {
+    reverse->offsets[v + 1] += reverse->offsets[v];
+  }
+  for (int u = 0; u < graph->size; u++) {
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+      const int slot = reverse->offsets[graph->targets[e]]++;
+      reverse->targets[slot] = u;
+      reverse->weights[slot] = graph->weights[e];
+    }
+  }
+  for (int v = graph->size; v > 0; v--) {
+    reverse->offsets[v] = reverse->offsets[v - 1];
+  }
+  reverse->offsets[0] = 0;
+  reverse->max_weight = graph->max_weight;
+  return reverse;
+}
+
+/**
+ * @brief largest positive edge weight, read from every stored edge in O(E)
+ * @param graph csr graph pointer
+ * @return largest positive weight, 0 if there is none
+ */
+int csr_graph_scan_max_weight(const csr_graph_t* graph) {
+  int max_weight = 0;
+  for (int e = 0; graph && e < graph->edge_count; e++) {
+    if (graph->weights[e] > max_weight) max_weight = graph->weights[e];
+  }
+  return max_weight;
+}
+
+/**
+ * @brief largest positive edge weight, the value recorded at load time or a
+ * scan of the edges if it is unknown
+ * @param graph csr graph pointer
+ * @return largest positive weight, 0 if there is none
+ */
+int csr_graph_max_weight(const csr_graph_t* graph) {
+  if (graph && graph->max_weight >= 0) return graph->max_weight;
+  return csr_graph_scan_max_weight(graph);
+}
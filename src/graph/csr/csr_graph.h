@@ -0,0 +1,58 @@
+#ifndef S21_CSR_GRAPH_H
+#define S21_CSR_GRAPH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../binary/graph_mapping.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief compressed sparse row graph
+ * @param offsets row starts, edges of v are [offsets[v], offsets[v + 1])
+ * @param targets edge targets, ascending inside every row
+ * @param weights edge weights, never 0 (0 means no edge)
+ * @param size number of vertices
+ * @param edge_count number of stored (directed) edges
+ * @param max_weight largest positive weight (0 without any) recorded when the
+ * graph is built or loaded, -1 if unknown (arrays filled by hand)
+ * @param mapping read-only file the arrays point into, NULL when the arrays
+ * are owned by the graph
+ */
+typedef struct {
+  int *offsets;
+  int *targets;
+  int *weights;
+  int size;
+  int edge_count;
+  int max_weight;
+  graph_mapping_t *mapping;
+} csr_graph_t;
+
+/**
+ * @brief out-degree of a vertex
+ * @param graph csr graph pointer
+ * @param vertex vertex index
+ * @return number of outgoing edges
+ */
+static inline int csr_degree(const csr_graph_t *graph, int vertex) {
+  return graph->offsets[vertex + 1] - graph->offsets[vertex];
+}
+
+csr_graph_t *csr_graph_create(int size, int edge_count);
+void csr_graph_delete(csr_graph_t *graph);
+csr_graph_t *csr_graph_from_edges(int size, int edge_count,
+                                  const int *sources, const int *targets,
+                                  const int *weights);
+csr_graph_t *csr_graph_transpose(const csr_graph_t *graph);
+int csr_graph_scan_max_weight(const csr_graph_t *graph);
+int csr_graph_max_weight(const csr_graph_t *graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_CSR_GRAPH_H
@@ -0,0 +1,334 @@
+#include "dot_export.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../s21_graph.h"
+
+/**
+ * @brief rows whose columns are gathered together, one cache line of cells
+ */
+#define DOT_ROW_BLOCK (MATRIX_ALIGNMENT / (int)sizeof(int))
+
+static const char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
+static const char kDotHeader[] =
+    "digraph {\n"
+    "    bgcolor=\"lightgray\";\n"
+    "    rankdir=LR;\n"
+    "    size=\"8,5\";\n"
+    "    node [shape=circle];\n"
+    "    overlap=false;\n"
+    "    splines=true;\n"
+    "    nodesep=4.0;\n"
+    "    ranksep=3.0;\n"
+    "    edge [fontsize=24, fontname=\"Arial\"];\n"
+    "    node [fontsize=24, fontname=\"Arial\"];\n";
+
+/**
+ * @brief options that keep every edge, the behaviour of export_graph_to_dot
+ */
+dot_export_options_t dot_export_default_options(void) {
+  dot_export_options_t options = {1.0, 0u, 0};
+  return options;
+}
+
+/**
+ * @brief writes the decimal text of value, two digits per division
+ * @param out destination, at least DOT_INT_MAX_CHARS bytes, not terminated
+ * @param value number to format
+ * @return number of characters written
+ */
+size_t dot_format_int(char *out, int value) {
+  unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+  char digits[DOT_INT_MAX_CHARS];
+  char *p = digits + sizeof(digits);
+  while (magnitude >= 100u) {
+    const unsigned pair = (magnitude % 100u) * 2u;
+    magnitude /= 100u;
+    *--p = kDigitPairs[pair + 1];
+    *--p = kDigitPairs[pair];
+  }
+  if (magnitude >= 10u) {
+    *--p = kDigitPairs[magnitude * 2u + 1];
+    *--p = kDigitPairs[magnitude * 2u];
+  } else {
+    *--p = (char)('0' + magnitude);
+  }
+  if (value < 0) *--p = '-';
+  const size_t length = (size_t)(digits + sizeof(digits) - p);
+  memcpy(out, p, length);
+  return length;
+}
+
+/**
+ * @brief opens a file for buffered writing
+ * @param filename output path
+ * @return writer or NULL if the file cannot be created
+ */
+dot_writer_t *dot_writer_open(const char *filename) {
+  dot_writer_t *writer = (dot_writer_t *)calloc(1, sizeof(dot_writer_t));
+  if (writer) {
+    writer->buffer = (char *)malloc(DOT_WRITER_BUFFER_SIZE);
+    writer->file = writer->buffer ? fopen(filename, "w") : NULL;
+    if (!writer->file) {
+      free(writer->buffer);
+      free(writer);
+      writer = NULL;
+    }
+  }
+  if (writer) setvbuf(writer->file, NULL, _IONBF, 0);
+  return writer;
+}
+
+/**
+ * @brief writes the pending text to the file with a single fwrite
+ */
+void dot_writer_flush(dot_writer_t *writer) {
+  if (writer->length > 0 && !writer->failed) {
+    writer->failed =
+        fwrite(writer->buffer, 1, writer->length, writer->file) !=
+        writer->length;
+  }
+  writer->length = 0;
+}
+
+/**
+ * @brief flushes and closes the file, frees the writer
+ * @return true if every write succeeded
+ */
+bool dot_writer_close(dot_writer_t *writer) {
+  if (!writer) return false;
+  dot_writer_flush(writer);
+  bool success = !writer->failed;
+  success = fclose(writer->file) == 0 && success;
+  free(writer->buffer);
+  free(writer);
+  return success;
+}
+
+/**
+ * @brief appends text, flushing the buffer when it is full
+ */
+void dot_writer_write(dot_writer_t *writer, const char *text, size_t length) {
+  if (writer->length + length > DOT_WRITER_BUFFER_SIZE) {
+    dot_writer_flush(writer);
+  }
+  if (length > DOT_WRITER_BUFFER_SIZE) {
+    writer->failed |= fwrite(text, 1, length, writer->file) != length;
+  } else {
+    memcpy(writer->buffer + writer->length, text, length);
+    writer->length += length;
+  }
+}
+
+/**
+ * @brief appends "    source -> target [label=\"weight\"];\n"
+ */
+void dot_writer_edge(dot_writer_t *writer, int source, int target,
+                     int weight) {
+  static const char kArrow[] = " -> ";
+  static const char kLabel[] = " [label=\"";
+  static const char kEnd[] = "\"];\n";
+  if (writer->length + 3 * DOT_INT_MAX_CHARS + 24 > DOT_WRITER_BUFFER_SIZE) {
+    dot_writer_flush(writer);
+  }
+  char *out = writer->buffer + writer->length;
+  char *const begin = out;
+  memcpy(out, "    ", 4);
+  out += 4;
+  out += dot_format_int(out, source);
+  memcpy(out, kArrow, sizeof(kArrow) - 1);
+  out += sizeof(kArrow) - 1;
+  out += dot_format_int(out, target);
+  memcpy(out, kLabel, sizeof(kLabel) - 1);
+  out += sizeof(kLabel) - 1;
+  out += dot_format_int(out, weight);
+  memcpy(out, kEnd, sizeof(kEnd) - 1);
+  out += sizeof(kEnd) - 1;
+  writer->length += (size_t)(out - begin);
+}
+
+/**
+ * @brief decides from a hash of the edge and the seed if it is sampled
+ */
+static bool edge_sampled(const dot_export_options_t *options, int source,
+                         int target) {
+  if (options->sample_rate >= 1.0) return true;
+  if (options->sample_rate <= 0.0) return false;
+  // splitmix64 finalizer
+  uint64_t x = ((uint64_t)(uint32_t)source << 32 | (uint32_t)target) ^
+               ((uint64_t)options->seed * 0x9e3779b97f4a7c15ull);
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  x ^= x >> 31;
+  return (double)(x >> 11) < options->sample_rate * (double)(1ull << 53);
+}
+
+/**
+ * @brief weight threshold of the top_k filter
+ * @param active false if every sampled edge is kept
+ * @param threshold weight of the k-th heaviest edge
+ * @param equal_budget how many edges of exactly threshold weight still fit
+ */
+typedef struct {
+  bool active;
+  int threshold;
+  long long equal_budget;
+} top_k_filter_t;
+
+static void sift_down(int *heap, int count, int index) {
+  for (;;) {
+    int smallest = index;
+    const int left = 2 * index + 1;
+    const int right = left + 1;
+    if (left < count && heap[left] < heap[smallest]) smallest = left;
+    if (right < count && heap[right] < heap[smallest]) smallest = right;
+    if (smallest == index) return;
+    const int swap = heap[index];
+    heap[index] = heap[smallest];
+    heap[smallest] = swap;
+    index = smallest;
+  }
+}
+
+static void sift_up(int *heap, int index) {
+  while (index > 0 && heap[(index - 1) / 2] > heap[index]) {
+    const int parent = (index - 1) / 2;
+    const int swap = heap[index];
+    heap[index] = heap[parent];
+    heap[parent] = swap;
+    index = parent;
+  }
+}
+
+/**
+ * @brief keeps the k heaviest sampled weights in a min-heap, one row-major
+ * pass over the matrix and O(k) memory
+ * @return false if the heap cannot be allocated
+ */
+static bool build_top_k_filter(const matrix_t *adjacency,
+                               const dot_export_options_t *options,
+                               top_k_filter_t *filter) {
+  filter->active = false;
+  if (options->top_k <= 0) return true;
+  int *heap = (int *)malloc((size_t)options->top_k * sizeof(int));
+  if (!heap) return false;
+  int count = 0;
+  for (int i = 0; i < adjacency->size; i++) {
+    const int *row = matrix_row(adjacency, i);
+    for (int j = 0; j < adjacency->size; j++) {
+      const int weight = row[j];
+      if (i == j || weight == 0 || !edge_sampled(options, i, j)) continue;
+      if (count < options->top_k) {
+        heap[count] = weight;
+        sift_up(heap, count++);
+      } else if (weight > heap[0]) {
+        heap[0] = weight;
+        sift_down(heap, count, 0);
+      }
+    }
+  }
+  if (count == options->top_k) {
+    filter->active = true;
+    filter->threshold = heap[0];
+    filter->equal_budget = 0;
+    for (int i = 0; i < count; i++) {
+      filter->equal_budget += heap[i] == filter->threshold;
+    }
+  }
+  free(heap);
+  return true;
+}
+
+static bool edge_selected(const dot_export_options_t *options,
+                          top_k_filter_t *filter, int source, int target,
+                          int weight) {
+  if (weight == 0 || !edge_sampled(options, source, target)) return false;
+  if (!filter->active || weight > filter->threshold) return true;
+  if (weight == filter->threshold && filter->equal_budget > 0) {
+    filter->equal_budget--;
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief streams the upper triangle pairs of a block of rows.
+ *
+ * Cell (j, i) of every row i of the block is gathered from one cache line of
+ * row j, so the lower triangle is read row by row instead of column by
+ * column.
+ */
+static void write_row_block(dot_writer_t *writer, const matrix_t *adjacency,
+                            int first_row, int *columns,
+                            const dot_export_options_t *options,
+                            top_k_filter_t *filter) {
+  const int size = adjacency->size;
+  const int rows =
+      size - first_row < DOT_ROW_BLOCK ? size - first_row : DOT_ROW_BLOCK;
+  for (int j = first_row + 1; j < size; j++) {
+    const int *row = matrix_row(adjacency, j) + first_row;
+    for (int r = 0; r < rows; r++) columns[(size_t)r * size + j] = row[r];
+  }
+  for (int r = 0; r < rows; r++) {
+    const int i = first_row + r;
+    const int *row = matrix_row(adjacency, i);
+    const int *column = columns + (size_t)r * size;
+    for (int j = i + 1; j < size; j++) {
+      if (row[j] == 0 && column[j] == 0) continue;
+      if (edge_selected(options, filter, i, j, row[j])) {
+        dot_writer_edge(writer, i, j, row[j]);
+      }
+      if (edge_selected(options, filter, j, i, column[j])) {
+        dot_writer_edge(writer, j, i, column[j]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Export graph to DOT file through a large output buffer
+ *
+ * The output equals export_graph_to_dot when options keep every edge.
+ * Self loops are never written.
+ * @param graph Pointer to graph
+ * @param filename Path to file
+ * @param options edge sampling and top-k filter, NULL keeps every edge
+ * @return true on success
+ */
+bool export_graph_to_dot_with_options(const graph_t *graph,
+                                      const char *filename,
+                                      const dot_export_options_t *options) {
+  if (!graph || !graph->adjacency || !graph->adjacency->cells || !filename) {
+    return false;
+  }
+  const dot_export_options_t defaults = dot_export_default_options();
+  if (!options) options = &defaults;
+  const matrix_t *adjacency = graph->adjacency;
+  top_k_filter_t filter = {false, 0, 0};
+  const size_t column_cells =
+      (size_t)DOT_ROW_BLOCK * ((size_t)adjacency->size + 1);
+  int *columns = (int *)malloc(column_cells * sizeof(int));
+  bool success = columns && build_top_k_filter(adjacency, options, &filter);
+  dot_writer_t *writer = success ? dot_writer_open(filename) : NULL;
+  if (success && !writer) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    success = false;
+  }
+  if (success) {
+    dot_writer_write(writer, kDotHeader, sizeof(kDotHeader) - 1);
+    for (int i = 0; i < adjacency->size; i += DOT_ROW_BLOCK) {
+      write_row_block(writer, adjacency, i, columns, options, &filter);
+    }
+    dot_writer_write(writer, "}\n", 2);
+  }
+  if (writer) success = dot_writer_close(writer) && success;
+  free(columns);
+  return success;
+}
@@ -0,0 +1,62 @@
+#ifndef S21_DOT_EXPORT_H
+#define S21_DOT_EXPORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief size of the user-space buffer flushed by one fwrite
+ */
+#define DOT_WRITER_BUFFER_SIZE (1 << 20)
+
+/**
+ * @brief longest text produced by dot_format_int, "-2147483648"
+ */
+#define DOT_INT_MAX_CHARS 11
+
+/**
+ * @brief edge filters of the DOT exporter
+ * @param sample_rate probability to keep an edge, 1.0 keeps all; the choice
+ * is a hash of (source, target, seed), so repeated exports are identical
+ * @param seed sampling seed
+ * @param top_k keep only the top_k heaviest of the sampled edges, 0 keeps
+ * all; among equal weights the first edges in export order win
+ */
+typedef struct {
+  double sample_rate;
+  unsigned seed;
+  int top_k;
+} dot_export_options_t;
+
+/**
+ * @brief buffered text output, the file itself is unbuffered
+ * @param file destination
+ * @param buffer pending text
+ * @param length bytes pending in buffer
+ * @param failed true once a write failed, later writes are dropped
+ */
+typedef struct {
+  FILE *file;
+  char *buffer;
+  size_t length;
+  bool failed;
+} dot_writer_t;
+
+dot_export_options_t dot_export_default_options(void);
+size_t dot_format_int(char *out, int value);
+dot_writer_t *dot_writer_open(const char *filename);
+bool dot_writer_close(dot_writer_t *writer);
+void dot_writer_flush(dot_writer_t *writer);
+void dot_writer_write(dot_writer_t *writer, const char *text, size_t length);
+void dot_writer_edge(dot_writer_t *writer, int source, int target, int weight);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_DOT_EXPORT_H
@@ -0,0 +1,358 @@
+#include "graph_formats.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../parser/text_scanner.h"
+#include "../s21_graph.h"
+
+/**
+ * @brief growing edge arrays, memory stays proportional to the edge count
+ */
+typedef struct {
+  int *sources;
+  int *targets;
+  int *weights;
+  size_t count;
+  size_t capacity;
+} edge_buffer_t;
+
+/**
+ * @brief iterator over the lines of a mapped file
+ * @param number number of the last returned line, starting from 1
+ */
+typedef struct {
+  const char *cursor;
+  const char *end;
+  size_t number;
+} line_reader_t;
+
+static bool edge_buffer_reserve(edge_buffer_t *buffer, size_t capacity) {
+  if (capacity <= buffer->capacity) return true;
+  if (capacity > (size_t)INT_MAX) return false;
+  int *sources = (int *)realloc(buffer->sources, capacity * sizeof(int));
+  if (sources) buffer->sources = sources;
+  int *targets = (int *)realloc(buffer->targets, capacity * sizeof(int));
+  if (targets) buffer->targets = targets;
+  int *weights = (int *)realloc(buffer->weights, capacity * sizeof(int));
+  if (weights) buffer->weights = weights;
+  if (!sources || !targets || !weights) return false;
+  buffer->capacity = capacity;
+  return true;
+}
+
+static bool edge_buffer_push(edge_buffer_t *buffer, int source, int target,
+                             int weight) {
+  if (buffer->count == buffer->capacity &&
+      !edge_buffer_reserve(buffer,
+                           buffer->capacity ? buffer->capacity * 2 : 1024)) {
+    return false;
+  }
+  buffer->sources[buffer->count] = source;
+  buffer->targets[buffer->count] = target;
+  buffer->weights[buffer->count] = weight;
+  buffer->count++;
+  return true;
+}
+
+static void edge_buffer_free(edge_buffer_t *buffer) {
+  free(buffer->sources);
+  free(buffer->targets);
+  free(buffer->weights);
+}
+
+/**
+ * @brief builds the csr graph and frees the buffer
+ */
+static csr_graph_t *edge_buffer_to_csr(edge_buffer_t *buffer, int size) {
+  csr_graph_t *graph = csr_graph_from_edges(
+      size, (int)buffer->count, buffer->sources, buffer->targets,
+      buffer->weights);
+  edge_buffer_free(buffer);
+  if (!graph) fprintf(stderr, "Failed to build sparse graph\n");
+  return graph;
+}
+
+static bool next_line(line_reader_t *reader, text_cursor_t *line) {
+  if (reader->cursor >= reader->end) return false;
+  const char *newline = (const char *)memchr(
+      reader->cursor, '\n', (size_t)(reader->end - reader->cursor));
+  line->cursor = reader->cursor;
+  line->end = newline ? newline : reader->end;
+  reader->cursor = newline ? newline + 1 : reader->end;
+  reader->number++;
+  return true;
+}
+
+/**
+ * @brief skips leading whitespace
+ * @return first symbol of the rest of the line or 0 if it is empty
+ */
+static char first_symbol(text_cursor_t *line) {
+  while (line->cursor < line->end && text_is_space(*line->cursor)) {
+    line->cursor++;
+  }
+  return line->cursor < line->end ? *line->cursor : '\0';
+}
+
+static void skip_word(text_cursor_t *line) {
+  first_symbol(line);
+  while (line->cursor < line->end && !text_is_space(*line->cursor)) {
+    line->cursor++;
+  }
+}
+
+static bool read_ints(text_cursor_t *line, int *values, int count) {
+  bool success = true;
+  for (int i = 0; i < count && success; i++) {
+    success = text_cursor_next_int(line, &values[i]) == TEXT_SCAN_OK;
+  }
+  return success;
+}
+
+static bool line_is_finished(text_cursor_t *line) {
+  return first_symbol(line) == '\0';
+}
+
+static bool open_lines(const char *filename, graph_mapping_t **mapping,
+                       line_reader_t *reader) {
+  if (!filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return false;
+  }
+  *mapping = graph_mapping_open(filename);
+  if (!*mapping) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return false;
+  }
+  reader->cursor = (const char *)(*mapping)->address;
+  reader->end = reader->cursor + (*mapping)->length;
+  reader->number = 0;
+  return true;
+}
+
+/**
+ * @brief picks the format from the file extension: ".gr" and ".dimacs" are
+ * DIMACS, ".graph" and ".metis" are METIS, ".el", ".edges" and ".edgelist"
+ * are edge lists, anything else is the dense matrix format
+ * @param filename Name of file
+ * @return detected format
+ */
+graph_file_format_t detect_graph_file_format(const char *filename) {
+  static const struct {
+    const char *extension;
+    graph_file_format_t format;
+  } kExtensions[] = {
+      {".gr", GRAPH_FORMAT_DIMACS},      {".dimacs", GRAPH_FORMAT_DIMACS},
+      {".graph", GRAPH_FORMAT_METIS},    {".metis", GRAPH_FORMAT_METIS},
+      {".el", GRAPH_FORMAT_EDGE_LIST},   {".edges", GRAPH_FORMAT_EDGE_LIST},
+      {".edgelist", GRAPH_FORMAT_EDGE_LIST},
+  };
+  const char *dot = filename ? strrchr(filename, '.') : NULL;
+  graph_file_format_t format = GRAPH_FORMAT_MATRIX;
+  for (size_t i = 0; dot && i < sizeof(kExtensions) / sizeof(kExtensions[0]);
+       i++) {
+    if (strcmp(dot, kExtensions[i].extension) == 0) {
+      format = kExtensions[i].format;
+    }
+  }
+  return format;
+}
+
+/**
+ * @brief loads "source target [weight]" lines, the weight defaults to 1.
+ * Vertices are zero-based, the graph has max index + 1 vertices.
+ * @param filename Name of file
+ * @param undirected store every edge in both directions
+ * @return csr graph or NULL if error
+ */
+csr_graph_t *load_csr_graph_from_edge_list(const char *filename,
+                                           bool undirected) {
+  graph_mapping_t *mapping = NULL;
+  line_reader_t reader;
+  if (!open_lines(filename, &mapping, &reader)) return NULL;
+  edge_buffer_t edges = {0};
+  int max_vertex = -1;
+  bool success = true;
+  text_cursor_t line;
+  while (success && next_line(&reader, &line)) {
+    const char symbol = first_symbol(&line);
+    if (symbol == '\0' || symbol == '#' || symbol == '%') continue;
+    int edge[3] = {0, 0, 1};
+    success = read_ints(&line, edge, 2) && edge[0] >= 0 && edge[1] >= 0 &&
+              edge[0] < INT_MAX && edge[1] < INT_MAX;
+    if (success && !line_is_finished(&line)) {
+      success = read_ints(&line, &edge[2], 1) && line_is_finished(&line);
+    }
+    if (success) {
+      if (edge[0] > max_vertex) max_vertex = edge[0];
+      if (edge[1] > max_vertex) max_vertex = edge[1];
+      success = edge_buffer_push(&edges, edge[0], edge[1], edge[2]) &&
+                (!undirected || edge[0] == edge[1] ||
+                 edge_buffer_push(&edges, edge[1], edge[0], edge[2]));
+    }
+  }
+  graph_mapping_close(mapping);
+  if (!success) {
+    fprintf(stderr, "Error reading edge list at line %zu\n", reader.number);
+    edge_buffer_free(&edges);
+    return NULL;
+  }
+  return edge_buffer_to_csr(&edges, max_vertex + 1);
+}
+
+/**
+ * @brief loads a DIMACS shortest path file: "c" comments, one
+ * "p sp vertices arcs" problem line and one-based "a source target weight"
+ * arcs
+ * @param filename Name of file
+ * @return csr graph or NULL if error
+ */
+csr_graph_t *load_csr_graph_from_dimacs(const char *filename) {
+  graph_mapping_t *mapping = NULL;
+  line_reader_t reader;
+  if (!open_lines(filename, &mapping, &reader)) return NULL;
+  edge_buffer_t edges = {0};
+  int header[2] = {-1, -1};
+  bool success = true;
+  text_cursor_t line;
+  while (success && next_line(&reader, &line)) {
+    const char symbol = first_symbol(&line);
+    if (symbol == '\0' || symbol == 'c') continue;
+    skip_word(&line);
+    if (symbol == 'p' && header[0] < 0) {
+      skip_word(&line);
+      success = read_ints(&line, header, 2) && header[0] >= 0 &&
+                header[1] >= 0 && line_is_finished(&line) &&
+                edge_buffer_reserve(&edges, (size_t)header[1]);
+    } else if (symbol == 'a' && header[0] >= 0) {
+      int arc[3];
+      success = read_ints(&line, arc, 3) && line_is_finished(&line) &&
+                arc[0] >= 1 && arc[0] <= header[0] && arc[1] >= 1 &&
+                arc[1] <= header[0] &&
+                edge_buffer_push(&edges, arc[0] - 1, arc[1] - 1, arc[2]);
+    } else {
+      success = false;
+    }
+  }
+  graph_mapping_close(mapping);
+  if (!success || header[0] < 0) {
+    fprintf(stderr, "Error reading DIMACS graph at line %zu\n",
+            reader.number);
+    edge_buffer_free(&edges);
+    return NULL;
+  }
+  return edge_buffer_to_csr(&edges, header[0]);
+}
+
+/**
+ * @brief reads the METIS header "vertices edges [fmt [ncon]]"
+ * @return true if the header is valid
+ */
+static bool read_metis_header(text_cursor_t *line, int *vertices,
+                              int *edge_count, int *format, int *constraints) {
+  int header[2];
+  bool success = read_ints(line, header, 2) && header[0] >= 0 && header[1] >= 0;
+  *format = 0;
+  *constraints = 0;
+  if (success && !line_is_finished(line)) {
+    success = read_ints(line, format, 1) && *format >= 0 && *format <= 111;
+  }
+  if (success && *format / 10 % 10 == 1) {
+    *constraints = 1;
+    if (!line_is_finished(line)) success = read_ints(line, constraints, 1);
+  }
+  *vertices = header[0];
+  *edge_count = header[1];
+  return success && *constraints >= 0 && line_is_finished(line);
+}
+
+/**
+ * @brief reads the neighbours of one vertex line
+ * @return true if the line is valid
+ */
+static bool read_metis_vertex(text_cursor_t *line, int vertex, int vertices,
+                              int format, int constraints,
+                              edge_buffer_t *edges) {
+  int skipped = (format / 100 == 1 ? 1 : 0) + constraints;
+  bool success = true;
+  for (int value = 0; skipped > 0 && success; skipped--) {
+    success = read_ints(line, &value, 1);
+  }
+  const bool weighted = format % 10 == 1;
+  while (success && !line_is_finished(line)) {
+    int edge[2] = {0, 1};
+    success = read_ints(line, edge, weighted ? 2 : 1) && edge[0] >= 1 &&
+              edge[0] <= vertices &&
+              edge_buffer_push(edges, vertex, edge[0] - 1, edge[1]);
+  }
+  return success;
+}
+
+/**
+ * @brief loads a METIS graph: "%" comments, header
+ * "vertices edges [fmt [ncon]]" and then one line of one-based neighbours per
+ * vertex (with edge weights when fmt ends with 1). METIS lists every edge at
+ * both of its ends, so the graph keeps both directions.
+ * @param filename Name of file
+ * @return csr graph or NULL if error
+ */
+csr_graph_t *load_csr_graph_from_metis(const char *filename) {
+  graph_mapping_t *mapping = NULL;
+  line_reader_t reader;
+  if (!open_lines(filename, &mapping, &reader)) return NULL;
+  edge_buffer_t edges = {0};
+  int vertices = -1, edge_count = 0, format = 0, constraints = 0;
+  int vertex = 0;
+  bool success = true;
+  text_cursor_t line;
+  while (success && (vertices < 0 || vertex < vertices) &&
+         next_line(&reader, &line)) {
+    const char symbol = first_symbol(&line);
+    if (symbol == '%') continue;
+    if (vertices < 0) {
+      if (symbol == '\0') continue;
+      success = read_metis_header(&line, &vertices, &edge_count, &format,
+                                  &constraints) &&
+                edge_buffer_reserve(&edges, 2 * (size_t)edge_count);
+    } else {
+      success = read_metis_vertex(&line, vertex++, vertices, format,
+                                  constraints, &edges);
+    }
+  }
+  graph_mapping_close(mapping);
+  if (!success || vertices < 0 || vertex < vertices) {
+    fprintf(stderr, "Error reading METIS graph at line %zu\n", reader.number);
+    edge_buffer_free(&edges);
+    return NULL;
+  }
+  return edge_buffer_to_csr(&edges, vertices);
+}
+
+/**
+ * @brief loads any supported text format into a csr graph
+ * @param filename Name of file
+ * @param format file format, GRAPH_FORMAT_AUTO detects it from the extension
+ * @return csr graph or NULL if error
+ */
+csr_graph_t *load_csr_graph_from_file(const char *filename,
+                                      graph_file_format_t format) {
+  if (format == GRAPH_FORMAT_AUTO) format = detect_graph_file_format(filename);
+  csr_graph_t *csr = NULL;
+  if (format == GRAPH_FORMAT_EDGE_LIST) {
+    csr = load_csr_graph_from_edge_list(filename, false);
+  } else if (format == GRAPH_FORMAT_DIMACS) {
+    csr = load_csr_graph_from_dimacs(filename);
+  } else if (format == GRAPH_FORMAT_METIS) {
+    csr = load_csr_graph_from_metis(filename);
+  } else if (format == GRAPH_FORMAT_MATRIX) {
+    graph_t *graph = graph_create(0);
+    if (graph && load_graph_from_file(graph, filename)) {
+      csr = graph_to_csr(graph);
+    }
+    graph_delete(graph);
+  }
+  return csr;
+}
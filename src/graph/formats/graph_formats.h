@@ -0,0 +1,40 @@
+#ifndef S21_GRAPH_FORMATS_H
+#define S21_GRAPH_FORMATS_H
+
+#include <stdbool.h>
+
+#include "../csr/csr_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief text formats understood by the sparse loaders
+ */
+typedef enum {
+  /** pick the format from the file extension */
+  GRAPH_FORMAT_AUTO = 0,
+  /** "source target [weight]" per line, zero-based, '#' or '%' comments */
+  GRAPH_FORMAT_EDGE_LIST = 1,
+  /** DIMACS shortest path ".gr": "p sp n m" and "a u v w" lines */
+  GRAPH_FORMAT_DIMACS = 2,
+  /** METIS ".graph": header "n m [fmt [ncon]]" and one line per vertex */
+  GRAPH_FORMAT_METIS = 3,
+  /** dense adjacency matrix read by load_graph_from_file */
+  GRAPH_FORMAT_MATRIX = 4
+} graph_file_format_t;
+
+graph_file_format_t detect_graph_file_format(const char *filename);
+csr_graph_t *load_csr_graph_from_edge_list(const char *filename,
+                                           bool undirected);
+csr_graph_t *load_csr_graph_from_dimacs(const char *filename);
+csr_graph_t *load_csr_graph_from_metis(const char *filename);
+csr_graph_t *load_csr_graph_from_file(const char *filename,
+                                      graph_file_format_t format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_GRAPH_FORMATS_H
@@ -1,60 +1,92 @@
 #include "matrix.h"
 
-int **allocate_matrix(int size) {
-  int **matrix = NULL;
-  bool success = true;
+#include <stdint.h>
 
-  matrix = (int **)malloc(size * sizeof(int *));
-  if (!matrix) {
-    success = false;
-  }
+/**
+ * @brief rounds the row length up to a whole number of cache lines
+ * @param size number of cells in a row
+ * @param element_size size of one cell in bytes
+ * @return padded row length in cells
+ */
+static int padded_row_length(int size, size_t element_size) {
+  const int cells_per_line = (int)(MATRIX_ALIGNMENT / element_size);
+  return ((size + cells_per_line - 1) / cells_per_line) * cells_per_line;
+}
 
-  for (int i = 0; i < size && success; i++) {
-    matrix[i] = (int *)calloc(size, sizeof(int));
-    if (!matrix[i]) {
-      success = false;
-      for (int j = 0; j < i; j++) {
-        free(matrix[j]);
-      }
-    }
+/**
+ * @brief allocates one zeroed block holding the row pointers followed by the
+ * aligned row-major cells: [row pointers][padding][size * stride cells]
+ * @param size matrix size
+ * @param element_size size of one cell in bytes
+ * @param cells receives the address of the first (aligned) cell
+ * @return block start (row pointer array) or NULL if error
+ */
+static unsigned char *allocate_block(int size, size_t element_size,
+                                     unsigned char **cells) {
+  if (size < 0) return NULL;
+  const size_t stride = (size_t)padded_row_length(size, element_size);
+  const size_t header = (size_t)size * sizeof(void *);
+  const size_t row_bytes = stride * element_size;
+  if (row_bytes != 0 &&
+      (size_t)size > (SIZE_MAX - header - MATRIX_ALIGNMENT) / row_bytes) {
+    return NULL;
   }
-
-  if (!success) {
-    if (matrix) {
-      free(matrix);
-    }
-    matrix = NULL;
+  unsigned char *block = (unsigned char *)calloc(
+      1, header + MATRIX_ALIGNMENT + (size_t)size * row_bytes);
+  if (block) {
+    const uintptr_t aligned =
+        ((uintptr_t)(block + header) + MATRIX_ALIGNMENT - 1) &
+        ~(uintptr_t)(MATRIX_ALIGNMENT - 1);
+    *cells = block + (aligned - (uintptr_t)block);
   }
-
-  return matrix;
+  return block;
 }
 
-double **allocate_matrix_double(int size) {
-  double **matrix = NULL;
-  bool success = true;
+/**
+ * @brief row stride of an int matrix
+ * @param size matrix size
+ * @return distance in cells between the starts of two neighbouring rows
+ */
+int matrix_row_stride(int size) {
+  return padded_row_length(size, sizeof(int));
+}
 
-  matrix = (double **)malloc(size * sizeof(double *));
-  if (!matrix) {
-    success = false;
-  }
+/**
+ * @brief row stride of a double matrix
+ * @param size matrix size
+ * @return distance in cells between the starts of two neighbouring rows
+ */
+int matrix_row_stride_double(int size) {
+  return padded_row_length(size, sizeof(double));
+}
 
-  for (int i = 0; i < size && success; i++) {
-    matrix[i] = (double *)calloc(size, sizeof(double));
-    if (!matrix[i]) {
-      success = false;
-      for (int j = 0; j < i; j++) {
-        free(matrix[j]);
-      }
+/**
+ * @brief allocates zeroed size x size matrix as one contiguous block,
+ * matrix[0] is the flat row-major buffer with matrix_row_stride(size) stride
+ * @param size matrix size
+ * @return row view of the matrix or NULL if error
+ */
+int **allocate_matrix(int size) {
+  unsigned char *cells = NULL;
+  int **matrix = (int **)allocate_block(size, sizeof(int), &cells);
+  if (matrix) {
+    const size_t stride = (size_t)matrix_row_stride(size);
+    for (int i = 0; i < size; i++) {
+      matrix[i] = (int *)cells + (size_t)i * stride;
     }
   }
+  return matrix;
+}
 
-  if (!success) {
-    if (matrix) {
-      free(matrix);
+double **allocate_matrix_double(int size) {
+  unsigned char *cells = NULL;
+  double **matrix = (double **)allocate_block(size, sizeof(double), &cells);
+  if (matrix) {
+    const size_t stride = (size_t)matrix_row_stride_double(size);
+    for (int i = 0; i < size; i++) {
+      matrix[i] = (double *)cells + (size_t)i * stride;
     }
-    matrix = NULL;
   }
-
   return matrix;
 }
 
@@ -71,23 +103,11 @@ double **allocate_matrix_double_with_value(int size, double value) {
 }
 
 void free_matrix_double(double **matrix, int size) {
-  if (matrix) {
-    for (int i = 0; i < size; i++) {
-      if (matrix[i]) {
-        free(matrix[i]);
-      }
-    }
-    free(matrix);
-  }
+  (void)size;
+  free(matrix);
 }
 
 void free_matrix(int **matrix, int size) {
-  if (matrix) {
-    for (int i = 0; i < size; i++) {
-      if (matrix[i]) {
-        free(matrix[i]);
-      }
-    }
-    free(matrix);
-  }
+  (void)size;
+  free(matrix);
 }
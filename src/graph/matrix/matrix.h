@@ -10,6 +10,14 @@
 extern "C" {
 #endif
 
+/**
+ * @brief alignment (in bytes) of the first cell of every matrix and of the
+ * row stride, one cache line
+ */
+#define MATRIX_ALIGNMENT 64
+
+int matrix_row_stride(int size);
+int matrix_row_stride_double(int size);
 int **allocate_matrix(int size);
 void free_matrix(int **matrix, int size);
 double **allocate_matrix_double(int size);
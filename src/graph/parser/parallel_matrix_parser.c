@@ -0,0 +1,197 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "parallel_matrix_parser.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "text_scanner.h"
+
+/**
+ * @brief part of the text owned by one thread, always whole lines
+ * @param begin first byte of the chunk
+ * @param end end of the chunk (one past its last newline)
+ * @param line_count newlines inside the chunk, filled by the first pass
+ * @param first_line index of the first line, prefix sum of line counts
+ * @param status parse result of the chunk
+ */
+typedef struct {
+  const char *begin;
+  const char *end;
+  int line_count;
+  int first_line;
+  int *cells;
+  int stride;
+  int size;
+  matrix_parse_status_t status;
+} parse_chunk_t;
+
+/**
+ * @brief picks the number of parsing threads
+ * @param length text length in bytes
+ * @param requested thread count asked by the caller, 0 means one per core
+ * with at least PARALLEL_PARSE_MIN_CHUNK bytes per thread
+ * @return thread count, at least 1
+ */
+int parallel_parse_thread_count(size_t length, int requested) {
+  long count = requested;
+  if (count <= 0) {
+    count = sysconf(_SC_NPROCESSORS_ONLN);
+    const size_t by_length = length / PARALLEL_PARSE_MIN_CHUNK;
+    if ((size_t)count > by_length) count = (long)by_length;
+  }
+  if ((size_t)count > length) count = (long)length;
+  return count > 0 ? (int)count : 1;
+}
+
+static void *count_lines(void *argument) {
+  parse_chunk_t *chunk = (parse_chunk_t *)argument;
+  int lines = 0;
+  const char *p = chunk->begin;
+  while (p < chunk->end &&
+         (p = (const char *)memchr(p, '\n', (size_t)(chunk->end - p)))) {
+    lines++;
+    p++;
+  }
+  chunk->line_count = lines;
+  return NULL;
+}
+
+/**
+ * @brief parses one line into a row, it must hold exactly size numbers
+ */
+static matrix_parse_status_t parse_row(const char *begin, const char *end,
+                                       int *row, int size) {
+  text_cursor_t cursor = {begin, end};
+  for (int j = 0; j < size; j++) {
+    const text_scan_status_t status = text_cursor_next_int(&cursor, &row[j]);
+    if (status != TEXT_SCAN_OK) {
+      return status == TEXT_SCAN_END ? MATRIX_PARSE_LAYOUT_MISMATCH
+                                     : MATRIX_PARSE_ERROR;
+    }
+  }
+  int extra = 0;
+  const text_scan_status_t status = text_cursor_next_int(&cursor, &extra);
+  if (status == TEXT_SCAN_ERROR) return MATRIX_PARSE_ERROR;
+  return status == TEXT_SCAN_END ? MATRIX_PARSE_OK
+                                 : MATRIX_PARSE_LAYOUT_MISMATCH;
+}
+
+static void *parse_lines(void *argument) {
+  parse_chunk_t *chunk = (parse_chunk_t *)argument;
+  matrix_parse_status_t status = MATRIX_PARSE_OK;
+  const char *p = chunk->begin;
+  // lines after the last row are ignored, as the sequential loader does
+  for (int line = chunk->first_line;
+       p < chunk->end && line < chunk->size && status == MATRIX_PARSE_OK;
+       line++) {
+    const char *newline =
+        (const char *)memchr(p, '\n', (size_t)(chunk->end - p));
+    const char *line_end = newline ? newline : chunk->end;
+    status = parse_row(p, line_end,
+                       chunk->cells + (size_t)line * (size_t)chunk->stride,
+                       chunk->size);
+    p = line_end + 1;
+  }
+  chunk->status = status;
+  return NULL;
+}
+
+/**
+ * @brief runs routine over every chunk, the first chunk on the calling thread
+ * @return false if a thread could not be started
+ */
+static bool run_chunks(parse_chunk_t *chunks, int count,
+                       void *(*routine)(void *)) {
+  pthread_t *threads = (pthread_t *)malloc((size_t)count * sizeof(pthread_t));
+  if (!threads) return false;
+  int started = 1;
+  bool success = true;
+  for (; started < count && success; started++) {
+    success = pthread_create(&threads[started], NULL, routine,
+                             &chunks[started]) == 0;
+  }
+  if (!success) started--;
+  routine(&chunks[0]);
+  for (int i = 1; i < started; i++) pthread_join(threads[i], NULL);
+  free(threads);
+  return success;
+}
+
+/**
+ * @brief splits the text on newline boundaries
+ */
+static void split_chunks(const char *data, size_t length, parse_chunk_t *chunks,
+                         int count) {
+  const char *end = data + length;
+  const char *begin = data;
+  for (int i = 0; i < count; i++) {
+    const char *chunk_end =
+        i == count - 1 ? end : data + length / (size_t)count * (size_t)(i + 1);
+    if (chunk_end < begin) chunk_end = begin;
+    if (chunk_end < end && chunk_end > data && chunk_end[-1] != '\n') {
+      const char *newline =
+          (const char *)memchr(chunk_end, '\n', (size_t)(end - chunk_end));
+      chunk_end = newline ? newline + 1 : end;
+    }
+    chunks[i].begin = begin;
+    chunks[i].end = chunk_end;
+    begin = chunk_end;
+  }
+}
+
+/**
+ * @brief parses a matrix stored one row per line into preallocated rows.
+ *
+ * The text is split into chunks on newline boundaries. A first parallel pass
+ * counts lines per chunk so that every chunk knows the index of its first
+ * row, a second pass parses the chunks concurrently straight into the rows.
+ * Row and column counts are validated after all chunks finished.
+ * @param data text after the line holding the matrix size
+ * @param length text length in bytes
+ * @param cells first cell of the matrix
+ * @param stride distance in cells between two rows
+ * @param size matrix size
+ * @param thread_count number of threads, see parallel_parse_thread_count
+ * @return MATRIX_PARSE_OK, MATRIX_PARSE_LAYOUT_MISMATCH if rows are not
+ * one per line or MATRIX_PARSE_ERROR on malformed data
+ */
+matrix_parse_status_t parse_matrix_rows_parallel(const char *data,
+                                                 size_t length, int *cells,
+                                                 int stride, int size,
+                                                 int thread_count) {
+  const int count = parallel_parse_thread_count(length, thread_count);
+  parse_chunk_t *chunks =
+      (parse_chunk_t *)calloc((size_t)count, sizeof(parse_chunk_t));
+  if (!chunks) return MATRIX_PARSE_ERROR;
+  split_chunks(data, length, chunks, count);
+  matrix_parse_status_t status = MATRIX_PARSE_OK;
+  if (!run_chunks(chunks, count, count_lines)) status = MATRIX_PARSE_ERROR;
+
+  long lines = 0;
+  for (int i = 0; i < count; i++) {
+    chunks[i].first_line = lines > size ? size : (int)lines;
+    chunks[i].cells = cells;
+    chunks[i].stride = stride;
+    chunks[i].size = size;
+    lines += chunks[i].line_count;
+  }
+  if (length > 0 && data[length - 1] != '\n') lines++;
+  if (status == MATRIX_PARSE_OK && lines < size) {
+    status = MATRIX_PARSE_LAYOUT_MISMATCH;
+  }
+  if (status == MATRIX_PARSE_OK && !run_chunks(chunks, count, parse_lines)) {
+    status = MATRIX_PARSE_ERROR;
+  }
+  for (int i = 0; i < count && status == MATRIX_PARSE_OK; i++) {
+    status = chunks[i].status;
+  }
+  for (int i = 0; i < count && status == MATRIX_PARSE_LAYOUT_MISMATCH; i++) {
+    if (chunks[i].status == MATRIX_PARSE_ERROR) status = MATRIX_PARSE_ERROR;
+  }
+  free(chunks);
+  return status;
+}
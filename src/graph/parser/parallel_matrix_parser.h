@@ -0,0 +1,37 @@
+#ifndef S21_PARALLEL_MATRIX_PARSER_H
+#define S21_PARALLEL_MATRIX_PARSER_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief smallest chunk handed to one thread when the thread count is chosen
+ * automatically
+ */
+#define PARALLEL_PARSE_MIN_CHUNK (1 << 20)
+
+/**
+ * @brief result of parallel matrix parsing
+ */
+typedef enum {
+  MATRIX_PARSE_OK = 0,
+  /** the text is not one row per line, it must be parsed sequentially */
+  MATRIX_PARSE_LAYOUT_MISMATCH = 1,
+  /** malformed or out of range number */
+  MATRIX_PARSE_ERROR = 2
+} matrix_parse_status_t;
+
+int parallel_parse_thread_count(size_t length, int requested);
+matrix_parse_status_t parse_matrix_rows_parallel(const char *data,
+                                                 size_t length, int *cells,
+                                                 int stride, int size,
+                                                 int thread_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_PARALLEL_MATRIX_PARSER_H
@@ -0,0 +1,101 @@
+#include "text_scanner.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief opens a text file for block reading
+ * @param filename Name of file
+ * @return Pointer to scanner or NULL if error
+ */
+text_scanner_t *text_scanner_open(const char *filename) {
+  if (!filename) return NULL;
+  text_scanner_t *scanner = (text_scanner_t *)calloc(1, sizeof(*scanner));
+  if (!scanner) return NULL;
+  scanner->file = fopen(filename, "rb");
+  scanner->buffer = (char *)malloc(TEXT_SCANNER_BLOCK_SIZE);
+  if (!scanner->file || !scanner->buffer) {
+    text_scanner_close(scanner);
+    return NULL;
+  }
+  // blocks are already large, stdio buffering would only add a copy
+  setvbuf(scanner->file, NULL, _IONBF, 0);
+  scanner->text.cursor = scanner->buffer;
+  scanner->text.end = scanner->buffer;
+  return scanner;
+}
+
+/**
+ * @brief closes the file and frees the scanner
+ * @param scanner Pointer to scanner
+ */
+void text_scanner_close(text_scanner_t *scanner) {
+  if (scanner) {
+    if (scanner->file) fclose(scanner->file);
+    free(scanner->buffer);
+    free(scanner);
+  }
+}
+
+/**
+ * @brief keeps the unread tail, appends the next block and moves the
+ * parseable end to the last whitespace so that no number is split
+ * @return false on read error or on a token longer than a whole block
+ */
+static bool refill(text_scanner_t *scanner) {
+  const size_t tail =
+      scanner->length - (size_t)(scanner->text.cursor - scanner->buffer);
+  memmove(scanner->buffer, scanner->text.cursor, tail);
+  const size_t wanted = TEXT_SCANNER_BLOCK_SIZE - tail;
+  const size_t got = fread(scanner->buffer + tail, 1, wanted, scanner->file);
+  if (got < wanted) {
+    if (ferror(scanner->file)) return false;
+    scanner->eof = true;
+  }
+  scanner->length = tail + got;
+  scanner->text.cursor = scanner->buffer;
+  const char *end = scanner->buffer + scanner->length;
+  if (!scanner->eof) {
+    while (end > scanner->buffer && !text_is_space(end[-1])) end--;
+    if (end == scanner->buffer) return false;
+  }
+  scanner->text.end = end;
+  return true;
+}
+
+/**
+ * @brief reads the next integer of the file
+ * @param scanner Pointer to scanner
+ * @param value receives the number
+ * @return TEXT_SCAN_OK, TEXT_SCAN_END at end of file or TEXT_SCAN_ERROR
+ */
+text_scan_status_t text_scanner_next_int(text_scanner_t *scanner, int *value) {
+  text_scan_status_t status = text_cursor_next_int(&scanner->text, value);
+  while (status == TEXT_SCAN_END && !scanner->eof) {
+    if (!refill(scanner)) return TEXT_SCAN_ERROR;
+    status = text_cursor_next_int(&scanner->text, value);
+  }
+  return status;
+}
+
+/**
+ * @brief reads up to count integers into values
+ * @param scanner Pointer to scanner
+ * @param values destination array
+ * @param count number of integers wanted
+ * @return number of integers read, less than count on error or end of file
+ */
+size_t text_scanner_read_ints(text_scanner_t *scanner, int *values,
+                              size_t count) {
+  size_t read = 0;
+  while (read < count) {
+    const text_scan_status_t status =
+        text_cursor_next_int(&scanner->text, &values[read]);
+    if (status == TEXT_SCAN_OK) {
+      read++;
+    } else if (status == TEXT_SCAN_ERROR || scanner->eof || !refill(scanner)) {
+      break;
+    }
+  }
+  return read;
+}
@@ -0,0 +1,106 @@
+#ifndef S21_TEXT_SCANNER_H
+#define S21_TEXT_SCANNER_H
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief size of one block read from the file
+ */
+#define TEXT_SCANNER_BLOCK_SIZE (1 << 20)
+
+/**
+ * @brief result of reading one integer
+ */
+typedef enum {
+  TEXT_SCAN_OK = 0,
+  TEXT_SCAN_END = 1,
+  TEXT_SCAN_ERROR = 2
+} text_scan_status_t;
+
+/**
+ * @brief integer scanner over an in-memory range of text
+ * @param cursor first unread character
+ * @param end end of the range, the range never ends inside a number
+ */
+typedef struct {
+  const char *cursor;
+  const char *end;
+} text_cursor_t;
+
+/**
+ * @brief buffered block reader of a text file
+ * @param file source file
+ * @param buffer block buffer
+ * @param length number of valid bytes in buffer
+ * @param text parseable part of buffer, it stops after the last whitespace
+ * @param eof true if the whole file has been read
+ */
+typedef struct {
+  FILE *file;
+  char *buffer;
+  size_t length;
+  text_cursor_t text;
+  bool eof;
+} text_scanner_t;
+
+static inline bool text_is_space(char c) {
+  return c == ' ' || (unsigned char)(c - '\t') < 5u;
+}
+
+/**
+ * @brief reads one decimal integer, same accepted syntax as "%d" except that
+ * a number must be followed by whitespace or the end of the range
+ * @param cursor scanner
+ * @param value receives the number
+ * @return TEXT_SCAN_OK, TEXT_SCAN_END if only whitespace is left or
+ * TEXT_SCAN_ERROR on malformed or out of range number
+ */
+static inline text_scan_status_t text_cursor_next_int(text_cursor_t *cursor,
+                                                      int *value) {
+  const char *p = cursor->cursor;
+  const char *end = cursor->end;
+  while (p < end && text_is_space(*p)) p++;
+  if (p == end) {
+    cursor->cursor = p;
+    return TEXT_SCAN_END;
+  }
+  const bool negative = *p == '-';
+  p += (*p == '-' || *p == '+');
+  const char *digits = p;
+  uint64_t result = 0;
+  uint64_t overflow = 0;
+  unsigned digit = 0;
+  while (p < end && (digit = (unsigned)(unsigned char)*p - '0') < 10u) {
+    result = result * 10u + digit;
+    overflow |= result >> 32;
+    p++;
+  }
+  cursor->cursor = p;
+  const uint64_t limit = (uint64_t)INT_MAX + (negative ? 1u : 0u);
+  if (p == digits || overflow || result > limit ||
+      (p < end && !text_is_space(*p))) {
+    return TEXT_SCAN_ERROR;
+  }
+  *value = negative ? (int)(-(int64_t)result) : (int)result;
+  return TEXT_SCAN_OK;
+}
+
+text_scanner_t *text_scanner_open(const char *filename);
+void text_scanner_close(text_scanner_t *scanner);
+text_scan_status_t text_scanner_next_int(text_scanner_t *scanner, int *value);
+size_t text_scanner_read_ints(text_scanner_t *scanner, int *values,
+                              size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_TEXT_SCANNER_H
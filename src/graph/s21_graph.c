@@ -3,6 +3,28 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "parser/parallel_matrix_parser.h"
+#include "parser/text_scanner.h"
+
+/**
+ * @brief allocates adjacency storage and binds the flat buffer to the matrix
+ * @param adjacency matrix structure pointer
+ * @param size matrix size
+ * @return true if success false if error
+ */
+static bool allocate_adjacency(matrix_t* adjacency, int size) {
+  adjacency->size = size;
+  adjacency->data = allocate_matrix(size);
+  if (!adjacency->data) {
+    adjacency->cells = NULL;
+    adjacency->stride = 0;
+    return false;
+  }
+  adjacency->cells = size > 0 ? adjacency->data[0] : NULL;
+  adjacency->stride = matrix_row_stride(size);
+  return true;
+}
+
 /**
  * @brief create graph
  * @param size Size of graph
@@ -22,17 +44,7 @@ graph_t* graph_create(int size) {
     }
   }
   if (success) {
-    graph->adjacency->size = size;
-    graph->adjacency->data = allocate_matrix(size);
-    if (!graph->adjacency->data) {
-      success = false;
-    } else {
-      for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-          graph->adjacency->data[i][j] = 0;
-        }
-      }
-    }
+    success = allocate_adjacency(graph->adjacency, size);
   }
   if (!success) {
     if (graph) {
@@ -49,6 +61,22 @@ graph_t* graph_create(int size) {
   return graph;
 }
 
+/**
+ * @brief frees the adjacency matrix and unmaps its file if it is mapped
+ * @param graph Pointer to graph
+ */
+static void release_adjacency(graph_t* graph) {
+  if (graph->adjacency) {
+    free_matrix(graph->adjacency->data, graph->adjacency->size);
+    free(graph->adjacency);
+    graph->adjacency = NULL;
+  }
+  if (graph->mapping) {
+    graph_mapping_close(graph->mapping);
+    graph->mapping = NULL;
+  }
+}
+
 /**
  * @brief delete graph
  * @param graph Pointer to graph
@@ -56,10 +84,7 @@ graph_t* graph_create(int size) {
  */
 void graph_delete(graph_t* graph) {
   if (graph) {
-    if (graph->adjacency) {
-      free_matrix(graph->adjacency->data, graph->adjacency->size);
-      free(graph->adjacency);
-    }
+    release_adjacency(graph);
     free(graph);
   }
 }
@@ -77,11 +102,10 @@ int get_order(graph_t* graph) {
 }
 
 static bool prepare_graph_structure(graph_t* graph, int size) {
-  // Clean up existing matrix if size doesn't match
-  if (graph->adjacency && graph->adjacency->size != size) {
-    free_matrix(graph->adjacency->data, graph->adjacency->size);
-    free(graph->adjacency);
-    graph->adjacency = NULL;
+  // Clean up existing matrix if size doesn't match or it is read-only
+  if (graph->mapping ||
+      (graph->adjacency && graph->adjacency->size != size)) {
+    release_adjacency(graph);
   }
 
   // Allocate new matrix if needed
@@ -91,9 +115,7 @@ static bool prepare_graph_structure(graph_t* graph, int size) {
       return false;
     }
 
-    graph->adjacency->size = size;
-    graph->adjacency->data = allocate_matrix(size);
-    if (!graph->adjacency->data) {
+    if (!allocate_adjacency(graph->adjacency, size)) {
       free(graph->adjacency);
       graph->adjacency = NULL;
       return false;
@@ -102,13 +124,7 @@ static bool prepare_graph_structure(graph_t* graph, int size) {
   return true;
 }
 
-static void cleanup_on_failure(graph_t* graph) {
-  if (graph->adjacency) {
-    free_matrix(graph->adjacency->data, graph->adjacency->size);
-    free(graph->adjacency);
-    graph->adjacency = NULL;
-  }
-}
+static void cleanup_on_failure(graph_t* graph) { release_adjacency(graph); }
 
 /**
  * @brief load graph from file, can allocate memory for new graph
@@ -122,31 +138,28 @@ bool load_graph_from_file(graph_t* graph, const char* filename) {
     fprintf(stderr, "Invalid input parameters\n");
     return false;
   }
-  FILE* file = fopen(filename, "r");
-  if (!file) {
+  text_scanner_t* scanner = text_scanner_open(filename);
+  if (!scanner) {
     fprintf(stderr, "Failed to open file: %s\n", filename);
     return false;
   }
   int size = 0;
-  if (fscanf(file, "%d", &size) != 1 || size <= 0) {
-    fclose(file);
+  if (text_scanner_next_int(scanner, &size) != TEXT_SCAN_OK || size <= 0) {
+    text_scanner_close(scanner);
     fprintf(stderr, "Invalid graph size in file\n");
     return false;
   }
   if (!prepare_graph_structure(graph, size)) {
-    fclose(file);
+    text_scanner_close(scanner);
     fprintf(stderr, "Failed to prepare graph structure\n");
     return false;
   }
   bool success = true;
   for (int i = 0; i < size && success; i++) {
-    for (int j = 0; j < size && success; j++) {
-      if (fscanf(file, "%d", &graph->adjacency->data[i][j]) != 1) {
-        success = false;
-      }
-    }
+    success = text_scanner_read_ints(scanner, matrix_row(graph->adjacency, i),
+                                     (size_t)size) == (size_t)size;
   }
-  fclose(file);
+  text_scanner_close(scanner);
   if (!success) {
     cleanup_on_failure(graph);
     fprintf(stderr, "Error reading matrix data from file\n");
@@ -154,29 +167,85 @@ bool load_graph_from_file(graph_t* graph, const char* filename) {
   return success;
 }
 
-static void initialize_dot_file(FILE* file) {
-  fprintf(file, "digraph {\n");
-  fprintf(file, "    bgcolor=\"lightgray\";\n");
-  fprintf(file, "    rankdir=LR;\n");
-  fprintf(file, "    size=\"8,5\";\n");
-  fprintf(file, "    node [shape=circle];\n");
-  fprintf(file, "    overlap=false;\n");
-  fprintf(file, "    splines=true;\n");
-  fprintf(file, "    nodesep=4.0;\n");
-  fprintf(file, "    ranksep=3.0;\n");
-  fprintf(file, "    edge [fontsize=24, fontname=\"Arial\"];\n");
-  fprintf(file, "    node [fontsize=24, fontname=\"Arial\"];\n");
+/**
+ * @brief finds the matrix rows in a mapped file: reads the size and skips the
+ * rest of its line
+ * @param mapping mapped file
+ * @param size receives the matrix size
+ * @param data receives the first byte after the size line or NULL if the
+ * size line holds more than the size
+ * @return true if the size is valid
+ */
+static bool locate_matrix_rows(const graph_mapping_t* mapping, int* size,
+                               const char** data) {
+  const char* begin = (const char*)mapping->address;
+  text_cursor_t cursor = {begin, begin + mapping->length};
+  if (text_cursor_next_int(&cursor, size) != TEXT_SCAN_OK || *size <= 0) {
+    return false;
+  }
+  while (cursor.cursor < cursor.end && *cursor.cursor != '\n' &&
+         text_is_space(*cursor.cursor)) {
+    cursor.cursor++;
+  }
+  *data = NULL;
+  if (cursor.cursor < cursor.end && *cursor.cursor == '\n') {
+    *data = cursor.cursor + 1;
+  }
+  return true;
 }
 
-static void write_edge(FILE* file, int i, int j, int weight_ij, int weight_ji) {
-  if (weight_ij != 0 && weight_ji != 0) {
-    fprintf(file, "    %d -> %d [label=\"%d\"];\n", i, j, weight_ij);
-    fprintf(file, "    %d -> %d [label=\"%d\"];\n", j, i, weight_ji);
-  } else if (weight_ij != 0) {
-    fprintf(file, "    %d -> %d [label=\"%d\"];\n", i, j, weight_ij);
-  } else if (weight_ji != 0) {
-    fprintf(file, "    %d -> %d [label=\"%d\"];\n", j, i, weight_ji);
+/**
+ * @brief load graph from file parsing rows on several threads
+ *
+ * The file is mapped and split into chunks on newline boundaries which are
+ * parsed concurrently into the preallocated rows. Files that do not keep one
+ * matrix row per line are loaded by load_graph_from_file instead, so both
+ * functions accept the same input and report the same errors.
+ * @param graph Pointer to graph
+ * @param filename Name of file
+ * @param thread_count Number of threads, 0 picks one per core for large files
+ * @return true if success false if error
+ */
+bool load_graph_from_file_parallel(graph_t* graph, const char* filename,
+                                   int thread_count) {
+  if (!graph || !filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return false;
   }
+  graph_mapping_t* mapping = graph_mapping_open(filename);
+  if (!mapping) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return false;
+  }
+  int size = 0;
+  const char* data = NULL;
+  if (!locate_matrix_rows(mapping, &size, &data)) {
+    graph_mapping_close(mapping);
+    fprintf(stderr, "Invalid graph size in file\n");
+    return false;
+  }
+  matrix_parse_status_t status = MATRIX_PARSE_LAYOUT_MISMATCH;
+  if (data) {
+    if (!prepare_graph_structure(graph, size)) {
+      graph_mapping_close(mapping);
+      fprintf(stderr, "Failed to prepare graph structure\n");
+      return false;
+    }
+    const char* end = (const char*)mapping->address + mapping->length;
+    status = parse_matrix_rows_parallel(data, (size_t)(end - data),
+                                        graph->adjacency->cells,
+                                        graph->adjacency->stride, size,
+                                        thread_count);
+  }
+  graph_mapping_close(mapping);
+  if (status == MATRIX_PARSE_LAYOUT_MISMATCH) {
+    return load_graph_from_file(graph, filename);
+  }
+  if (status != MATRIX_PARSE_OK) {
+    cleanup_on_failure(graph);
+    fprintf(stderr, "Error reading matrix data from file\n");
+  }
+  return status == MATRIX_PARSE_OK;
 }
 
 /**
@@ -185,31 +254,104 @@ static void write_edge(FILE* file, int i, int j, int weight_ij, int weight_ji) {
  * @param filename Path to file
  */
 void export_graph_to_dot(const graph_t* graph, const char* filename) {
-  bool success = true;
-  if (!graph || !filename) {
-    success = false;
+  export_graph_to_dot_with_options(graph, filename, NULL);
+}
+
+/**
+ * @brief build compressed sparse row copy of the adjacency matrix
+ * @param graph Pointer to graph
+ * @return Pointer to csr graph or NULL if error
+ */
+csr_graph_t* graph_to_csr(const graph_t* graph) {
+  if (!graph || !graph->adjacency || !graph->adjacency->data) {
+    return NULL;
   }
-  FILE* file = NULL;
-  if (success) {
-    file = fopen(filename, "w");
-    if (!file) {
-      success = false;
+  const matrix_t* adjacency = graph->adjacency;
+  int edge_count = 0;
+  for (int i = 0; i < adjacency->size; i++) {
+    const int* row = matrix_row(adjacency, i);
+    for (int j = 0; j < adjacency->size; j++) {
+      edge_count += row[j] != 0;
     }
   }
-  if (success) {
-    initialize_dot_file(file);
-    for (int i = 0; i < graph->adjacency->size; i++) {
-      for (int j = i + 1; j < graph->adjacency->size; j++) {
-        if (graph->adjacency->data[i][j] != 0 ||
-            graph->adjacency->data[j][i] != 0) {
-          write_edge(file, i, j, graph->adjacency->data[i][j],
-                     graph->adjacency->data[j][i]);
+  csr_graph_t* csr = csr_graph_create(adjacency->size, edge_count);
+  if (csr) {
+    int count = 0;
+    for (int i = 0; i < adjacency->size; i++) {
+      const int* row = matrix_row(adjacency, i);
+      csr->offsets[i] = count;
+      for (int j = 0; j < adjacency->size; j++) {
+        if (row[j] != 0) {
+          csr->targets[count] = j;
+          csr->weights[count++] = row[j];
         }
       }
     }
-    fprintf(file, "}\n");
+    csr->offsets[adjacency->size] = count;
+    csr->max_weight = csr_graph_scan_max_weight(csr);
   }
-  if (file) {
-    fclose(file);
+  return csr;
+}
+
+/**
+ * @brief build dense graph from compressed sparse row graph
+ * @param csr Pointer to csr graph
+ * @return Pointer to graph or NULL if error
+ */
+graph_t* graph_from_csr(const csr_graph_t* csr) {
+  if (!csr) {
+    return NULL;
+  }
+  graph_t* graph = graph_create(csr->size);
+  if (graph) {
+    for (int v = 0; v < csr->size; v++) {
+      int* row = matrix_row(graph->adjacency, v);
+      for (int e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+        row[csr->targets[e]] = csr->weights[e];
+      }
+    }
+  }
+  return graph;
+}
+
+/**
+ * @brief build unweighted bit matrix, every non-zero cell becomes a set bit
+ * @param graph Pointer to graph
+ * @return Pointer to bit matrix or NULL if error
+ */
+bit_matrix_t* graph_to_bit_matrix(const graph_t* graph) {
+  if (!graph || !graph->adjacency || !graph->adjacency->data) {
+    return NULL;
+  }
+  const matrix_t* adjacency = graph->adjacency;
+  bit_matrix_t* bits = bit_matrix_create(adjacency->size);
+  if (bits) {
+    for (int i = 0; i < adjacency->size; i++) {
+      const int* row = matrix_row(adjacency, i);
+      uint64_t* bit_row = bit_matrix_row(bits, i);
+      for (int j = 0; j < adjacency->size; j++) {
+        bit_row[j / BIT_MATRIX_WORD_BITS] |=
+            (uint64_t)(row[j] != 0) << (j % BIT_MATRIX_WORD_BITS);
+      }
+    }
+  }
+  return bits;
+}
+
+/**
+ * @brief build unweighted bit matrix from compressed sparse rows
+ * @param csr Pointer to csr graph
+ * @return Pointer to bit matrix or NULL if error
+ */
+bit_matrix_t* csr_to_bit_matrix(const csr_graph_t* csr) {
+  if (!csr) return NULL;
+  bit_matrix_t* bits = bit_matrix_create(csr->size);
+  if (bits) {
+    for (int i = 0; i < csr->size; i++) {
+      for (int e = csr->offsets[i]; e < csr->offsets[i + 1]; e++) {
+        bit_matrix_set(bits, i, csr->targets[e]);
+      }
+    }
   }
+  return bits;
 }
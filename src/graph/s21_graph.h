@@ -3,6 +3,10 @@
 
 #include <stdbool.h>
 
+#include "binary/graph_mapping.h"
+#include "bit_matrix/bit_matrix.h"
+#include "csr/csr_graph.h"
+#include "dot/dot_export.h"
 #include "matrix/matrix.h"
 
 #ifdef __cplusplus
@@ -11,27 +15,61 @@ extern "C" {
 
 /**
  * @brief matrix structure
- * @param data pointer to matrix
+ * @param data row view of the matrix, data[i] points into cells
  * @param size matrix size
+ * @param cells flat row-major buffer (one aligned block)
+ * @param stride distance in cells between the starts of two rows
  */
 typedef struct {
   int **data;
   int size;
+  int *cells;
+  int stride;
 } matrix_t;
 
 /**
  * @brief graph structure
  * @param adjacency pointer to adjacency matrix
+ * @param mapping read-only file the adjacency cells point into, NULL when the
+ * matrix is owned by the graph
  */
 typedef struct {
   matrix_t *adjacency;
+  graph_mapping_t *mapping;
 } graph_t;
 
+/**
+ * @brief row of the flat adjacency buffer
+ * @param matrix matrix structure pointer
+ * @param row row index
+ * @return pointer to the first cell of the row
+ */
+static inline int *matrix_row(const matrix_t *matrix, int row) {
+  return matrix->cells + (size_t)row * (size_t)matrix->stride;
+}
+
 graph_t *graph_create(int size);
 void graph_delete(graph_t *graph);
 int get_order(graph_t *graph);
 bool load_graph_from_file(graph_t *graph, const char *filename);
+bool load_graph_from_file_parallel(graph_t *graph, const char *filename,
+                                   int thread_count);
 void export_graph_to_dot(const graph_t *graph, const char *filename);
+bool export_graph_to_dot_with_options(const graph_t *graph,
+                                      const char *filename,
+                                      const dot_export_options_t *options);
+csr_graph_t *graph_to_csr(const graph_t *graph);
+graph_t *graph_from_csr(const csr_graph_t *csr);
+bit_matrix_t *graph_to_bit_matrix(const graph_t *graph);
+bit_matrix_t *csr_to_bit_matrix(const csr_graph_t *csr);
+bool save_graph_to_binary_file(const graph_t *graph, const char *filename);
+bool save_csr_graph_to_binary_file(const csr_graph_t *graph,
+                                   const char *filename);
+graph_t *map_graph_from_binary_file(const char *filename,
+                                    bool verify_checksum);
+csr_graph_t *map_csr_graph_from_binary_file(const char *filename,
+                                            bool verify_checksum);
+bool is_graph_binary_file(const char *filename);
 
 #ifdef __cplusplus
 }
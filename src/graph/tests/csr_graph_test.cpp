@@ -0,0 +1,123 @@
+#include "../../test/main_test.h"
+#include "wrapper_for_gtest/graph_wrapper.h"
+
+TEST(CsrGraphTest, BuildFromAdjacencyMatrix) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/simple_graph.txt"));
+  const csr_graph_t* csr = graph.getCsrGraph();
+
+  ASSERT_EQ(csr->size, graph.getOrder());
+  int edges = 0;
+  for (int i = 0; i < csr->size; i++) {
+    for (int j = 0; j < csr->size; j++) {
+      edges += graph.getMatrixValue(i, j) != 0;
+    }
+    for (int e = csr->offsets[i]; e < csr->offsets[i + 1]; e++) {
+      EXPECT_EQ(csr->weights[e], graph.getMatrixValue(i, csr->targets[e]));
+      if (e > csr->offsets[i]) {
+        EXPECT_LT(csr->targets[e - 1], csr->targets[e]);
+      }
+    }
+  }
+  EXPECT_EQ(csr->edge_count, edges);
+  EXPECT_EQ(csr->offsets[csr->size], edges);
+}
+
+TEST(CsrGraphTest, BuildFromEdgesSortsAndMergesParallelEdges) {
+  const int sources[] = {2, 0, 0, 2, 0, 1};
+  const int targets[] = {0, 2, 1, 0, 1, 1};
+  const int weights[] = {7, 4, 9, 3, 5, 0};
+  csr_graph_t* csr = csr_graph_from_edges(3, 6, sources, targets, weights);
+  ASSERT_NE(csr, nullptr);
+
+  EXPECT_EQ(csr->edge_count, 3);
+  EXPECT_EQ(csr_degree(csr, 0), 2);
+  EXPECT_EQ(csr_degree(csr, 1), 0);
+  EXPECT_EQ(csr_degree(csr, 2), 1);
+  EXPECT_EQ(csr->targets[0], 1);
+  EXPECT_EQ(csr->weights[0], 5);
+  EXPECT_EQ(csr->targets[1], 2);
+  EXPECT_EQ(csr->weights[1], 4);
+  EXPECT_EQ(csr->targets[2], 0);
+  EXPECT_EQ(csr->weights[2], 3);
+
+  graph_t* dense = graph_from_csr(csr);
+  ASSERT_NE(dense, nullptr);
+  EXPECT_EQ(dense->adjacency->data[0][1], 5);
+  EXPECT_EQ(dense->adjacency->data[2][0], 3);
+  EXPECT_EQ(dense->adjacency->data[1][1], 0);
+  graph_delete(dense);
+  csr_graph_delete(csr);
+}
+
+TEST(CsrGraphTest, RejectsOutOfRangeEdges) {
+  const int sources[] = {0};
+  const int targets[] = {3};
+  const int weights[] = {1};
+  EXPECT_EQ(csr_graph_from_edges(3, 1, sources, targets, weights), nullptr);
+}
+
+TEST(CsrGraphTest, TransposeReversesEveryEdge) {
+  const int sources[] = {0, 0, 2, 3, 3, 1};
+  const int targets[] = {1, 3, 0, 0, 2, 3};
+  const int weights[] = {4, 2, 7, 1, 5, 6};
+  csr_graph_t* csr = csr_graph_from_edges(4, 6, sources, targets, weights);
+  ASSERT_NE(csr, nullptr);
+  csr_graph_t* reverse = csr_graph_transpose(csr);
+  ASSERT_NE(reverse, nullptr);
+
+  EXPECT_EQ(reverse->edge_count, 6);
+  graph_t* dense = graph_from_csr(csr);
+  graph_t* dense_reverse = graph_from_csr(reverse);
+  ASSERT_NE(dense, nullptr);
+  ASSERT_NE(dense_reverse, nullptr);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      EXPECT_EQ(dense_reverse->adjacency->data[j][i],
+                dense->adjacency->data[i][j]);
+    }
+  }
+  // in-neighbours of 0 are 2 and 3, of 3 are 0 and 1, ascending
+  EXPECT_EQ(reverse->targets[reverse->offsets[0]], 2);
+  EXPECT_EQ(reverse->targets[reverse->offsets[0] + 1], 3);
+  EXPECT_EQ(reverse->targets[reverse->offsets[3]], 0);
+  EXPECT_EQ(reverse->targets[reverse->offsets[3] + 1], 1);
+  graph_delete(dense);
+  graph_delete(dense_reverse);
+  csr_graph_delete(reverse);
+  csr_graph_delete(csr);
+}
+
+TEST(CsrGraphTest, MaxWeightIsRecordedByBuilders) {
+  const int sources[] = {0, 1, 2, 2};
+  const int targets[] = {1, 2, 0, 1};
+  const int weights[] = {4, -3, 9, 0};
+  csr_graph_t* csr = csr_graph_from_edges(3, 4, sources, targets, weights);
+  ASSERT_NE(csr, nullptr);
+  EXPECT_EQ(csr->max_weight, 9);
+  csr_graph_t* reverse = csr_graph_transpose(csr);
+  ASSERT_NE(reverse, nullptr);
+  EXPECT_EQ(reverse->max_weight, 9);
+  graph_t* dense = graph_from_csr(csr);
+  ASSERT_NE(dense, nullptr);
+  csr_graph_t* copy = graph_to_csr(dense);
+  ASSERT_NE(copy, nullptr);
+  EXPECT_EQ(copy->max_weight, 9);
+
+  csr_graph_t* manual = csr_graph_create(2, 1);
+  ASSERT_NE(manual, nullptr);
+  EXPECT_EQ(manual->max_weight, -1);
+  manual->offsets[1] = 1;
+  manual->offsets[2] = 1;
+  manual->targets[0] = 1;
+  manual->weights[0] = 12;
+  EXPECT_EQ(csr_graph_max_weight(manual), 12);
+  EXPECT_EQ(csr_graph_max_weight(csr), 9);
+
+  csr_graph_delete(manual);
+  csr_graph_delete(copy);
+  graph_delete(dense);
+  csr_graph_delete(reverse);
+  csr_graph_delete(csr);
+}
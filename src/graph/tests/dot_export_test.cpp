@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../test/main_test.h"
+#include "wrapper_for_gtest/graph_wrapper.h"
+
+namespace {
+
+const char kDotFile[] = "../data-samples/dot_structs/dot_export_test.dot";
+
+std::string ReadFile(const std::string& filename) {
+  std::ifstream file(filename);
+  std::stringstream text;
+  text << file.rdbuf();
+  return text.str();
+}
+
+/**
+ * @brief edge lines of a DOT file as (source, target, weight)
+ */
+std::vector<std::vector<int>> ReadEdges(const std::string& filename) {
+  std::vector<std::vector<int>> edges;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    int source = 0, target = 0, weight = 0;
+    if (std::sscanf(line.c_str(), " %d -> %d [label=\"%d\"];", &source,
+                    &target, &weight) == 3) {
+      edges.push_back({source, target, weight});
+    }
+  }
+  return edges;
+}
+
+void FillComplete(GraphWrapper& graph, int size) {
+  graph.createGraph(size);
+  const matrix_t* adjacency = graph.getGraph()->adjacency;
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      matrix_row(adjacency, i)[j] = i == j ? 0 : (i * 31 + j * 17) % 97 + 1;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(DotExportTest, FormatIntMatchesPrintf) {
+  const int values[] = {0,  7,   10,     99,      100,     -1,
+                        -42, 1000, 123456, INT_MAX, INT_MIN, -1000000};
+  for (int value : values) {
+    char text[DOT_INT_MAX_CHARS + 1] = {0};
+    const size_t length = dot_format_int(text, value);
+    EXPECT_EQ(std::string(text, length), std::to_string(value));
+  }
+}
+
+TEST(DotExportTest, MatchesFprintfOutput) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/graph_examples.txt"));
+  std::string expected =
+      "digraph {\n"
+      "    bgcolor=\"lightgray\";\n"
+      "    rankdir=LR;\n"
+      "    size=\"8,5\";\n"
+      "    node [shape=circle];\n"
+      "    overlap=false;\n"
+      "    splines=true;\n"
+      "    nodesep=4.0;\n"
+      "    ranksep=3.0;\n"
+      "    edge [fontsize=24, fontname=\"Arial\"];\n"
+      "    node [fontsize=24, fontname=\"Arial\"];\n";
+  for (int i = 0; i < graph.getOrder(); i++) {
+    for (int j = i + 1; j < graph.getOrder(); j++) {
+      char line[96];
+      if (graph.getMatrixValue(i, j) != 0) {
+        std::snprintf(line, sizeof(line), "    %d -> %d [label=\"%d\"];\n", i,
+                      j, graph.getMatrixValue(i, j));
+        expected += line;
+      }
+      if (graph.getMatrixValue(j, i) != 0) {
+        std::snprintf(line, sizeof(line), "    %d -> %d [label=\"%d\"];\n", j,
+                      i, graph.getMatrixValue(j, i));
+        expected += line;
+      }
+    }
+  }
+  expected += "}\n";
+
+  graph.exportGraphToDot(kDotFile);
+  EXPECT_EQ(ReadFile(kDotFile), expected);
+  std::remove(kDotFile);
+}
+
+TEST(DotExportTest, TopKKeepsHeaviestEdges) {
+  GraphWrapper graph;
+  FillComplete(graph, 40);
+  dot_export_options_t options = dot_export_default_options();
+  options.top_k = 25;
+  ASSERT_TRUE(graph.exportGraphToDot(kDotFile, options));
+  const auto edges = ReadEdges(kDotFile);
+  std::remove(kDotFile);
+
+  ASSERT_EQ(edges.size(), 25u);
+  int lightest_kept = INT_MAX;
+  for (const auto& edge : edges) {
+    EXPECT_EQ(edge[2], graph.getMatrixValue(edge[0], edge[1]));
+    lightest_kept = std::min(lightest_kept, edge[2]);
+  }
+  int heavier = 0;
+  for (int i = 0; i < graph.getOrder(); i++) {
+    for (int j = 0; j < graph.getOrder(); j++) {
+      heavier += graph.getMatrixValue(i, j) > lightest_kept;
+    }
+  }
+  EXPECT_LE(heavier, 25);
+}
+
+TEST(DotExportTest, SamplingIsDeterministic) {
+  GraphWrapper graph;
+  FillComplete(graph, 60);
+  dot_export_options_t options = dot_export_default_options();
+  options.sample_rate = 0.25;
+  options.seed = 7u;
+  ASSERT_TRUE(graph.exportGraphToDot(kDotFile, options));
+  const std::string first = ReadFile(kDotFile);
+  const size_t sampled = ReadEdges(kDotFile).size();
+  ASSERT_TRUE(graph.exportGraphToDot(kDotFile, options));
+  EXPECT_EQ(ReadFile(kDotFile), first);
+
+  const size_t all = 60 * 59;
+  EXPECT_GT(sampled, all / 8);
+  EXPECT_LT(sampled, all / 2);
+  options.sample_rate = 0.0;
+  ASSERT_TRUE(graph.exportGraphToDot(kDotFile, options));
+  EXPECT_TRUE(ReadEdges(kDotFile).empty());
+  std::remove(kDotFile);
+}
@@ -0,0 +1,140 @@
+#include <cstdio>
+#include <fstream>
+
+#include "../../test/main_test.h"
+#include "../binary/graph_binary.h"
+#include "wrapper_for_gtest/graph_wrapper.h"
+
+namespace {
+const std::string kSourceFile =
+    "../datasets/incidence_matrix_src/graph_examples.txt";
+const std::string kBinaryFile = "../data-samples/graph_examples.s21g";
+
+void ExpectSameMatrix(const GraphWrapper& expected,
+                      const GraphWrapper& actual) {
+  ASSERT_EQ(expected.getOrder(), actual.getOrder());
+  for (int i = 0; i < expected.getOrder(); i++) {
+    for (int j = 0; j < expected.getOrder(); j++) {
+      ASSERT_EQ(expected.getMatrixValue(i, j), actual.getMatrixValue(i, j));
+    }
+  }
+}
+}  // namespace
+
+TEST(GraphBinaryTest, DenseRoundTrip) {
+  GraphWrapper source;
+  ASSERT_TRUE(source.loadGraphFromFile(kSourceFile));
+  ASSERT_TRUE(source.saveGraphToBinaryFile(kBinaryFile));
+  EXPECT_TRUE(is_graph_binary_file(kBinaryFile.c_str()));
+  EXPECT_FALSE(is_graph_binary_file(kSourceFile.c_str()));
+
+  GraphWrapper mapped;
+  ASSERT_TRUE(mapped.mapGraphFromBinaryFile(kBinaryFile));
+  ExpectSameMatrix(source, mapped);
+  EXPECT_NE(mapped.getGraph()->mapping, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped.getGraph()->adjacency->cells) %
+                MATRIX_ALIGNMENT,
+            0u);
+
+  // loading text into a mapped graph replaces the read-only matrix
+  ASSERT_TRUE(mapped.loadGraphFromFile(kSourceFile));
+  EXPECT_EQ(mapped.getGraph()->mapping, nullptr);
+  ExpectSameMatrix(source, mapped);
+  std::remove(kBinaryFile.c_str());
+}
+
+TEST(GraphBinaryTest, CsrRoundTrip) {
+  GraphWrapper source;
+  ASSERT_TRUE(source.loadGraphFromFile(kSourceFile));
+  const csr_graph_t* csr = source.getCsrGraph();
+  ASSERT_TRUE(save_csr_graph_to_binary_file(csr, kBinaryFile.c_str()));
+
+  csr_graph_t* mapped = map_csr_graph_from_binary_file(kBinaryFile.c_str(), true);
+  ASSERT_NE(mapped, nullptr);
+  ASSERT_EQ(mapped->size, csr->size);
+  ASSERT_EQ(mapped->edge_count, csr->edge_count);
+  for (int v = 0; v <= csr->size; v++) {
+    EXPECT_EQ(mapped->offsets[v], csr->offsets[v]);
+  }
+  for (int e = 0; e < csr->edge_count; e++) {
+    EXPECT_EQ(mapped->targets[e], csr->targets[e]);
+    EXPECT_EQ(mapped->weights[e], csr->weights[e]);
+  }
+  EXPECT_EQ(map_graph_from_binary_file(kBinaryFile.c_str(), false), nullptr)
+      << "dense mapping of a csr container must fail";
+  csr_graph_delete(mapped);
+  std::remove(kBinaryFile.c_str());
+}
+
+TEST(GraphBinaryTest, CorruptedPayloadFailsChecksum) {
+  GraphWrapper source;
+  ASSERT_TRUE(source.loadGraphFromFile(kSourceFile));
+  ASSERT_TRUE(source.saveGraphToBinaryFile(kBinaryFile));
+  graph_binary_header_t header;
+  ASSERT_TRUE(read_graph_binary_header(kBinaryFile.c_str(), &header));
+  {
+    std::fstream file(kBinaryFile,
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(static_cast<std::streamoff>(header.payload_offset) + 4);
+    const int kValue = 12345;
+    file.write(reinterpret_cast<const char*>(&kValue), sizeof(kValue));
+  }
+
+  GraphWrapper mapped;
+  EXPECT_FALSE(mapped.mapGraphFromBinaryFile(kBinaryFile, true));
+  EXPECT_TRUE(mapped.mapGraphFromBinaryFile(kBinaryFile, false));
+  EXPECT_EQ(mapped.getMatrixValue(0, 1), 12345);
+  std::remove(kBinaryFile.c_str());
+}
+
+TEST(GraphBinaryTest, TextFileIsRejected) {
+  GraphWrapper graph;
+  EXPECT_FALSE(graph.mapGraphFromBinaryFile(kSourceFile));
+}
+
+TEST(GraphBinaryTest, CsrRowsOutOfRangeAreRejected) {
+  GraphWrapper source;
+  ASSERT_TRUE(source.loadGraphFromFile(kSourceFile));
+  const csr_graph_t* csr = source.getCsrGraph();
+  ASSERT_GT(csr->edge_count, 1);
+  graph_binary_header_t header;
+  const size_t offsets_length =
+      (((size_t)csr->size + 1) * sizeof(int) + GRAPH_BINARY_SECTION_ALIGNMENT -
+       1) /
+      GRAPH_BINARY_SECTION_ALIGNMENT * GRAPH_BINARY_SECTION_ALIGNMENT;
+  struct Damage {
+    std::streamoff position;
+    int value;
+  };
+  for (int variant = 0; variant < 3; variant++) {
+    ASSERT_TRUE(save_csr_graph_to_binary_file(csr, kBinaryFile.c_str()));
+    ASSERT_TRUE(read_graph_binary_header(kBinaryFile.c_str(), &header));
+    const std::streamoff payload =
+        static_cast<std::streamoff>(header.payload_offset);
+    const Damage damages[3] = {
+        // a target past the last vertex
+        {payload + static_cast<std::streamoff>(offsets_length), csr->size},
+        // offsets[1] below offsets[0]
+        {payload + static_cast<std::streamoff>(sizeof(int)), -1},
+        // payload starting inside the header
+        {static_cast<std::streamoff>(
+             offsetof(graph_binary_header_t, payload_offset)),
+         0}};
+    {
+      std::fstream file(kBinaryFile,
+                        std::ios::in | std::ios::out | std::ios::binary);
+      file.seekp(damages[variant].position);
+      if (variant == 2) {
+        const uint64_t kOffset = 0;
+        file.write(reinterpret_cast<const char*>(&kOffset), sizeof(kOffset));
+      } else {
+        file.write(reinterpret_cast<const char*>(&damages[variant].value),
+                   sizeof(int));
+      }
+    }
+    EXPECT_EQ(map_csr_graph_from_binary_file(kBinaryFile.c_str(), false),
+              nullptr)
+        << "variant " << variant;
+  }
+  std::remove(kBinaryFile.c_str());
+}
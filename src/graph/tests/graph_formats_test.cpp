@@ -0,0 +1,101 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../../test/main_test.h"
+#include "../formats/graph_formats.h"
+#include "wrapper_for_gtest/graph_wrapper.h"
+
+namespace {
+const std::string kEdgeListDir = "../datasets/edge_list_src/";
+const std::string kMatrixDir = "../datasets/incidence_matrix_src/";
+const std::string kFormatFile = "../data-samples/format_test_graph";
+
+void ExpectSameAsMatrix(const csr_graph_t* csr, const std::string& matrix) {
+  ASSERT_NE(csr, nullptr);
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(matrix));
+  const csr_graph_t* expected = graph.getCsrGraph();
+  ASSERT_EQ(csr->size, expected->size);
+  ASSERT_EQ(csr->edge_count, expected->edge_count);
+  for (int v = 0; v <= csr->size; v++) {
+    EXPECT_EQ(csr->offsets[v], expected->offsets[v]);
+  }
+  for (int e = 0; e < csr->edge_count; e++) {
+    EXPECT_EQ(csr->targets[e], expected->targets[e]);
+    EXPECT_EQ(csr->weights[e], expected->weights[e]);
+  }
+}
+
+csr_graph_t* LoadText(const std::string& text, graph_file_format_t format) {
+  {
+    std::ofstream file(kFormatFile, std::ios::binary);
+    file << text;
+  }
+  csr_graph_t* csr = load_csr_graph_from_file(kFormatFile.c_str(), format);
+  std::remove(kFormatFile.c_str());
+  return csr;
+}
+}  // namespace
+
+TEST(GraphFormatsTest, DetectsFormatFromExtension) {
+  EXPECT_EQ(detect_graph_file_format("roads.gr"), GRAPH_FORMAT_DIMACS);
+  EXPECT_EQ(detect_graph_file_format("mesh.graph"), GRAPH_FORMAT_METIS);
+  EXPECT_EQ(detect_graph_file_format("web.edges"), GRAPH_FORMAT_EDGE_LIST);
+  EXPECT_EQ(detect_graph_file_format("dir.gr/matrix.txt"), GRAPH_FORMAT_MATRIX);
+}
+
+TEST(GraphFormatsTest, LoadsSameGraphAsMatrix) {
+  csr_graph_t* dimacs = load_csr_graph_from_file(
+      (kEdgeListDir + "simple_graph.gr").c_str(), GRAPH_FORMAT_AUTO);
+  ExpectSameAsMatrix(dimacs, kMatrixDir + "simple_graph.txt");
+  csr_graph_t* edges = load_csr_graph_from_file(
+      (kEdgeListDir + "simple_graph.el").c_str(), GRAPH_FORMAT_AUTO);
+  ExpectSameAsMatrix(edges, kMatrixDir + "simple_graph.txt");
+  csr_graph_t* metis = load_csr_graph_from_file(
+      (kEdgeListDir + "prim_basic.graph").c_str(), GRAPH_FORMAT_AUTO);
+  ExpectSameAsMatrix(metis, kMatrixDir + "prim_basic.txt");
+  csr_graph_delete(dimacs);
+  csr_graph_delete(edges);
+  csr_graph_delete(metis);
+}
+
+TEST(GraphFormatsTest, EdgeListDefaultsAndUndirected) {
+  {
+    std::ofstream file(kFormatFile, std::ios::binary);
+    file << "# comment\n0 2\n\n2 1 7\n";
+  }
+  csr_graph_t* csr = load_csr_graph_from_edge_list(kFormatFile.c_str(), true);
+  std::remove(kFormatFile.c_str());
+  ASSERT_NE(csr, nullptr);
+  EXPECT_EQ(csr->size, 3);
+  EXPECT_EQ(csr->edge_count, 4);
+  EXPECT_EQ(csr_degree(csr, 2), 2);
+  EXPECT_EQ(csr->weights[csr->offsets[0]], 1);
+  EXPECT_EQ(csr->weights[csr->offsets[1]], 7);
+  csr_graph_delete(csr);
+}
+
+TEST(GraphFormatsTest, MetisIsolatedVerticesAndVertexWeights) {
+  csr_graph_t* csr = LoadText("% c\n3 1 11\n4 3 9\n1\n2 1 9\n",
+                              GRAPH_FORMAT_METIS);
+  ASSERT_NE(csr, nullptr);
+  EXPECT_EQ(csr->size, 3);
+  EXPECT_EQ(csr->edge_count, 2);
+  EXPECT_EQ(csr_degree(csr, 1), 0);
+  EXPECT_EQ(csr->targets[csr->offsets[2]], 0);
+  EXPECT_EQ(csr->weights[csr->offsets[2]], 9);
+  csr_graph_delete(csr);
+}
+
+TEST(GraphFormatsTest, RejectsMalformedInput) {
+  EXPECT_EQ(LoadText("0 1 2 3\n", GRAPH_FORMAT_EDGE_LIST), nullptr);
+  EXPECT_EQ(LoadText("0 -1\n", GRAPH_FORMAT_EDGE_LIST), nullptr);
+  EXPECT_EQ(LoadText("a 1 2 3\n", GRAPH_FORMAT_DIMACS), nullptr);
+  EXPECT_EQ(LoadText("p sp 2 1\na 1 3 1\n", GRAPH_FORMAT_DIMACS), nullptr);
+  EXPECT_EQ(LoadText("p sp 2 1\nx\n", GRAPH_FORMAT_DIMACS), nullptr);
+  EXPECT_EQ(LoadText("3 1\n2\n1\n", GRAPH_FORMAT_METIS), nullptr);
+  EXPECT_EQ(LoadText("2 1\n3\n1\n", GRAPH_FORMAT_METIS), nullptr);
+  EXPECT_EQ(load_csr_graph_from_file("missing.gr", GRAPH_FORMAT_AUTO),
+            nullptr);
+}
@@ -1,4 +1,7 @@
+#include <climits>
+#include <cstdio>
 #include <fstream>
+#include <string>
 
 #include "../../test/main_test.h"
 #include "wrapper_for_gtest/graph_wrapper.h"
@@ -112,3 +115,179 @@ TEST(ExportGraphToDotTest, ExportSimpleGraph3) {
   ASSERT_TRUE(file.is_open())
       << "Failed to open exported DOT file: " << kOutputFile;
 }
+
+TEST(GraphMatrixLayoutTest, RowsShareOneAlignedBlock) {
+  const int kSize = 37;
+  GraphWrapper graph;
+  graph.createGraph(kSize);
+  const matrix_t* adjacency = graph.getGraph()->adjacency;
+
+  ASSERT_NE(adjacency->cells, nullptr);
+  EXPECT_EQ(adjacency->stride, matrix_row_stride(kSize));
+  EXPECT_GE(adjacency->stride, kSize);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(adjacency->cells) % MATRIX_ALIGNMENT,
+            0u);
+  for (int i = 0; i < kSize; i++) {
+    EXPECT_EQ(adjacency->data[i], matrix_row(adjacency, i));
+    for (int j = 0; j < kSize; j++) {
+      EXPECT_EQ(adjacency->data[i][j], 0);
+    }
+  }
+}
+
+TEST(GraphMatrixLayoutTest, LoadedMatrixVisibleThroughFlatBuffer) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/graph_examples.txt"));
+  const matrix_t* adjacency = graph.getGraph()->adjacency;
+
+  EXPECT_EQ(adjacency->cells[0 * adjacency->stride + 5], 31);
+  EXPECT_EQ(matrix_row(adjacency, 0)[5], graph.getMatrixValue(0, 5));
+}
+
+namespace {
+const std::string kParserFile = "../data-samples/parser_test_matrix.txt";
+
+bool LoadText(GraphWrapper& graph, const std::string& text) {
+  {
+    std::ofstream file(kParserFile, std::ios::binary);
+    file << text;
+  }
+  bool result = graph.loadGraphFromFile(kParserFile);
+  std::remove(kParserFile.c_str());
+  return result;
+}
+}  // namespace
+
+TEST(LoadGraphTxtTest, ParsesSignsAndLineEndings) {
+  GraphWrapper graph;
+  ASSERT_TRUE(LoadText(graph, "  2\r\n-2147483648\t+7\r\n0 2147483647"));
+  EXPECT_EQ(graph.getMatrixValue(0, 0), INT_MIN);
+  EXPECT_EQ(graph.getMatrixValue(0, 1), 7);
+  EXPECT_EQ(graph.getMatrixValue(1, 1), INT_MAX);
+}
+
+TEST(LoadGraphTxtTest, RejectsMalformedInput) {
+  GraphWrapper graph;
+  EXPECT_FALSE(LoadText(graph, ""));
+  EXPECT_FALSE(LoadText(graph, "0\n"));
+  EXPECT_FALSE(LoadText(graph, "x\n"));
+  EXPECT_FALSE(LoadText(graph, "2\n1 2\n3\n"));
+  EXPECT_FALSE(LoadText(graph, "2\n1 2\n3 a\n"));
+  EXPECT_FALSE(LoadText(graph, "2\n1 2\n3 4b\n"));
+  EXPECT_FALSE(LoadText(graph, "2\n1 -\n3 4\n"));
+  EXPECT_FALSE(LoadText(graph, "2\n1 2147483648\n3 4\n"));
+  EXPECT_EQ(graph.getGraph()->adjacency, nullptr);
+}
+
+TEST(LoadGraphTxtTest, NumbersAcrossReadBlocks) {
+  // ~3 MB of text, numbers get split by the 1 MB read blocks
+  const int kSize = 700;
+  std::string text = std::to_string(kSize) + "\n";
+  for (int i = 0; i < kSize; i++) {
+    for (int j = 0; j < kSize; j++) {
+      text += std::to_string((i * 7919 + j * 104729) % 100000) + " ";
+    }
+    text += "\n";
+  }
+  GraphWrapper graph;
+  ASSERT_TRUE(LoadText(graph, text));
+  ASSERT_EQ(graph.getOrder(), kSize);
+  for (int i = 0; i < kSize; i++) {
+    for (int j = 0; j < kSize; j++) {
+      ASSERT_EQ(graph.getMatrixValue(i, j), (i * 7919 + j * 104729) % 100000);
+    }
+  }
+}
+
+namespace {
+bool LoadTextParallel(GraphWrapper& graph, const std::string& text,
+                      int threadCount) {
+  {
+    std::ofstream file(kParserFile, std::ios::binary);
+    file << text;
+  }
+  bool result = graph.loadGraphFromFileParallel(kParserFile, threadCount);
+  std::remove(kParserFile.c_str());
+  return result;
+}
+
+void ExpectSameGraph(const GraphWrapper& expected, const GraphWrapper& actual) {
+  ASSERT_EQ(expected.getOrder(), actual.getOrder());
+  for (int i = 0; i < expected.getOrder(); i++) {
+    for (int j = 0; j < expected.getOrder(); j++) {
+      ASSERT_EQ(expected.getMatrixValue(i, j), actual.getMatrixValue(i, j))
+          << "cell " << i << " " << j;
+    }
+  }
+}
+}  // namespace
+
+TEST(LoadGraphParallelTest, MatchesSequentialLoader) {
+  const std::string kInputFile =
+      "../datasets/incidence_matrix_src/graph_examples.txt";
+  GraphWrapper expected;
+  ASSERT_TRUE(expected.loadGraphFromFile(kInputFile));
+  for (int threads = 0; threads <= 8; threads++) {
+    GraphWrapper graph;
+    ASSERT_TRUE(graph.loadGraphFromFileParallel(kInputFile, threads));
+    ExpectSameGraph(expected, graph);
+  }
+}
+
+TEST(LoadGraphParallelTest, OtherLayoutsFallBackToSequential) {
+  GraphWrapper graph;
+  ASSERT_TRUE(LoadTextParallel(graph, "2 1 2 3 4", 4));
+  EXPECT_EQ(graph.getMatrixValue(1, 0), 3);
+  ASSERT_TRUE(LoadTextParallel(graph, "2\n1 2 3\n4\n", 4));
+  EXPECT_EQ(graph.getMatrixValue(1, 1), 4);
+  ASSERT_TRUE(LoadTextParallel(graph, "2\n1 2\n\n3 4\n", 4));
+  EXPECT_EQ(graph.getMatrixValue(1, 0), 3);
+  ASSERT_TRUE(LoadTextParallel(graph, "2\r\n1 2\r\n3 4\r\nextra", 3));
+  EXPECT_EQ(graph.getMatrixValue(1, 1), 4);
+}
+
+TEST(LoadGraphParallelTest, RejectsMalformedInput) {
+  GraphWrapper graph;
+  EXPECT_FALSE(LoadTextParallel(graph, "", 2));
+  EXPECT_FALSE(LoadTextParallel(graph, "-1\n", 2));
+  EXPECT_FALSE(LoadTextParallel(graph, "2\n1 2\n", 2));
+  EXPECT_FALSE(LoadTextParallel(graph, "2\n1 2\n3 x\n", 2));
+  EXPECT_FALSE(LoadTextParallel(graph, "2\n1 2 3\n4 x\n", 2));
+  EXPECT_EQ(graph.getGraph()->adjacency, nullptr);
+}
+
+TEST(LoadGraphParallelTest, RowsSplitAcrossManyChunks) {
+  const int kSize = 300;
+  std::string text = std::to_string(kSize) + "\n";
+  for (int i = 0; i < kSize; i++) {
+    for (int j = 0; j < kSize; j++) {
+      text += std::to_string((i * 31 + j * 17) % 1000 - 500) + " ";
+    }
+    text += "\n";
+  }
+  GraphWrapper graph;
+  ASSERT_TRUE(LoadTextParallel(graph, text, 7));
+  ASSERT_EQ(graph.getOrder(), kSize);
+  for (int i = 0; i < kSize; i++) {
+    for (int j = 0; j < kSize; j++) {
+      ASSERT_EQ(graph.getMatrixValue(i, j), (i * 31 + j * 17) % 1000 - 500);
+    }
+  }
+}
+
+TEST(GraphBitMatrixTest, OneBitPerCell) {
+  const int kSize = 1024;
+  GraphWrapper graph;
+  graph.createGraph(kSize);
+  matrix_row(graph.getGraph()->adjacency, 3)[700] = 5;
+  matrix_row(graph.getGraph()->adjacency, 1000)[0] = -1;
+  const bit_matrix_t* bits = graph.getBitMatrix();
+
+  EXPECT_TRUE(bit_matrix_test(bits, 3, 700));
+  EXPECT_TRUE(bit_matrix_test(bits, 1000, 0));
+  EXPECT_FALSE(bit_matrix_test(bits, 700, 3));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(bits->words) % MATRIX_ALIGNMENT, 0u);
+  EXPECT_EQ(bit_matrix_bytes(bits) * 32,
+            (size_t)kSize * graph.getGraph()->adjacency->stride * sizeof(int));
+}
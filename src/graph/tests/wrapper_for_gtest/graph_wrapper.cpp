@@ -2,22 +2,53 @@
 
 #include <stdexcept>
 
-GraphWrapper::GraphWrapper() : graph_(nullptr) {}
+GraphWrapper::GraphWrapper()
+    : graph_(nullptr), csr_(nullptr), bits_(nullptr) {}
 
 bool GraphWrapper::loadGraphFromFile(const std::string& filename) {
+  resetDerivedGraphs();
   if (!graph_) {
     graph_ = graph_create(0);
   }
   return load_graph_from_file(graph_, filename.c_str());
 }
 
+bool GraphWrapper::loadGraphFromFileParallel(const std::string& filename,
+                                             int threadCount) {
+  resetDerivedGraphs();
+  if (!graph_) {
+    graph_ = graph_create(0);
+  }
+  return load_graph_from_file_parallel(graph_, filename.c_str(), threadCount);
+}
+
+bool GraphWrapper::mapGraphFromBinaryFile(const std::string& filename,
+                                          bool verifyChecksum) {
+  resetDerivedGraphs();
+  graph_t* mapped = map_graph_from_binary_file(filename.c_str(), verifyChecksum);
+  if (!mapped) {
+    return false;
+  }
+  if (graph_) {
+    graph_delete(graph_);
+  }
+  graph_ = mapped;
+  return true;
+}
+
+bool GraphWrapper::saveGraphToBinaryFile(const std::string& filename) const {
+  return save_graph_to_binary_file(getGraph(), filename.c_str());
+}
+
 GraphWrapper::~GraphWrapper() {
+  resetDerivedGraphs();
   if (graph_) {
     graph_delete(graph_);
   }
 }
 
 void GraphWrapper::createGraph(int size) {
+  resetDerivedGraphs();
   if (graph_) {
     graph_delete(graph_);
   }
@@ -51,6 +82,14 @@ void GraphWrapper::exportGraphToDot(const std::string& filename) const {
   export_graph_to_dot(graph_, filename.c_str());
 }
 
+bool GraphWrapper::exportGraphToDot(const std::string& filename,
+                                    const dot_export_options_t& options) const {
+  if (!graph_) {
+    throw std::runtime_error("Graph is not initialized");
+  }
+  return export_graph_to_dot_with_options(graph_, filename.c_str(), &options);
+}
+
 void GraphWrapper::PrintGraphIncidenceMatrix() {
   for (int i = 0; i < graph_->adjacency->size; i++) {
     for (int n = 0; n < graph_->adjacency->size; n++) {
@@ -67,3 +106,30 @@ graph_t* GraphWrapper::getGraph() const {
   }
   return graph_;
 }
+
+csr_graph_t* GraphWrapper::getCsrGraph() const {
+  if (!csr_) {
+    csr_ = graph_to_csr(getGraph());
+    if (!csr_) {
+      throw std::runtime_error("Failed to build csr graph");
+    }
+  }
+  return csr_;
+}
+
+bit_matrix_t* GraphWrapper::getBitMatrix() const {
+  if (!bits_) {
+    bits_ = graph_to_bit_matrix(getGraph());
+    if (!bits_) {
+      throw std::runtime_error("Failed to build bit matrix");
+    }
+  }
+  return bits_;
+}
+
+void GraphWrapper::resetDerivedGraphs() {
+  csr_graph_delete(csr_);
+  csr_ = nullptr;
+  bit_matrix_delete(bits_);
+  bits_ = nullptr;
+}
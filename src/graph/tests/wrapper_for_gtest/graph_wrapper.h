@@ -19,12 +19,25 @@ class GraphWrapper {
   int getOrder() const;
   int getMatrixValue(int i, int j) const;
   bool loadGraphFromFile(const std::string& filename);
+  bool loadGraphFromFileParallel(const std::string& filename,
+                                 int threadCount = 0);
+  bool mapGraphFromBinaryFile(const std::string& filename,
+                              bool verifyChecksum = true);
+  bool saveGraphToBinaryFile(const std::string& filename) const;
   void exportGraphToDot(const std::string& filename) const;
+  bool exportGraphToDot(const std::string& filename,
+                        const dot_export_options_t& options) const;
   void PrintGraphIncidenceMatrix();
   graph_t* getGraph() const;
+  csr_graph_t* getCsrGraph() const;
+  bit_matrix_t* getBitMatrix() const;
 
  private:
+  void resetDerivedGraphs();
+
   graph_t* graph_;
+  mutable csr_graph_t* csr_;
+  mutable bit_matrix_t* bits_;
 };
 
 #endif  // GRAPH_WRAPPER_H
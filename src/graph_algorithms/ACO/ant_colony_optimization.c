@@ -39,8 +39,9 @@ int* get_unvisited_neighbors(const ant_t* ant, const graph_t* graph) {
   int* neighbors = (int*)malloc(graph->adjacency->size * sizeof(int));
   if (!neighbors) return NULL;
   int count = 0;
+  const int* row = matrix_row(graph->adjacency, ant->vertex_size);
   for (int to = 0; to < graph->adjacency->size; ++to) {
-    bool is_connected = graph->adjacency->data[ant->vertex_size][to] > 0;
+    bool is_connected = row[to] > 0;
     bool is_unvisited = ant->visited_vertices[to] == 0.0;
     if (is_connected && is_unvisited) {
       neighbors[count++] = to;
@@ -52,21 +53,15 @@ int* get_unvisited_neighbors(const ant_t* ant, const graph_t* graph) {
 
 void initialize_pheromone(double*** pheromone, double** local_pheromone,
                           int size, double initial_value) {
-  *pheromone = (double**)malloc(size * sizeof(double*));
+  *pheromone = allocate_matrix_double_with_value(size, initial_value);
   *local_pheromone = (double*)calloc(size, sizeof(double));
   for (int i = 0; i < size; ++i) {
-    (*pheromone)[i] = (double*)malloc(size * sizeof(double));
-    for (int j = 0; j < size; ++j) {
-      (*pheromone)[i][j] = (i == j) ? 0.0 : initial_value;
-    }
+    (*pheromone)[i][i] = 0.0;
   }
 }
 
 void free_pheromone(double*** pheromone, double* local_pheromone, int size) {
-  for (int i = 0; i < size; ++i) {
-    free((*pheromone)[i]);
-  }
-  free(*pheromone);
+  free_matrix_double(*pheromone, size);
   free(local_pheromone);
 }
 
@@ -108,11 +103,12 @@ void calculate_probabilities(const ant_t* ant, const graph_t* graph,
                              double* probabilities, int neighbor_count,
                              const int* neighbors) {
   double total = 0.0;
+  const int* row = matrix_row(graph->adjacency, ant->vertex_size);
   // calculate probabilities
   for (int i = 0; i < neighbor_count; ++i) {
     int to = neighbors[i];
     double pheromone_level = pheromone[ant->vertex_size][to];
-    double weight = graph->adjacency->data[ant->vertex_size][to];
+    double weight = row[to];
     double heuristic = 1.0 / weight;
     probabilities[i] = pow(pheromone_level, alpha) * pow(heuristic, beta);
     total += probabilities[i];
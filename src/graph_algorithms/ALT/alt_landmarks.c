@@ -0,0 +1,278 @@
+#include "alt_landmarks.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../data_structures/indexed_heap/indexed_heap.h"
+#include "../s21_graph_algorithms.h"
+
+/**
+ * @param dist distances from the query source, valid where stamp equals
+ * generation
+ * @param bound lower bound of every reached vertex towards the target
+ */
+struct alt_query {
+  indexed_heap_t *heap;
+  int *dist;
+  int *bound;
+  unsigned *stamp;
+  unsigned generation;
+};
+
+/**
+ * @brief copies the distances of a landmark's tree into column index of a
+ * vertex-major table
+ */
+static void store_column(int *table, int count, int index,
+                         const shortest_path_tree_t *tree) {
+  for (int v = 0; v < tree->size; v++) {
+    table[(size_t)v * (size_t)count + (size_t)index] = tree->dist[v];
+  }
+}
+
+/**
+ * @brief next landmark: the vertex with edges farthest from the landmarks
+ * chosen so far (the smallest distance to any of them), vertices no
+ * landmark reaches come first so every component gets one
+ */
+static int farthest_vertex(const alt_landmarks_t *landmarks, int chosen,
+                           const bool *is_landmark) {
+  int best = -1, best_score = -1;
+  for (int v = 0; v < landmarks->size; v++) {
+    if (is_landmark[v] || csr_degree(landmarks->graph, v) == 0) continue;
+    const int *from = landmarks->from_landmark + (size_t)v * landmarks->count;
+    int score = INT_MAX;
+    for (int i = 0; i < chosen; i++) {
+      if (from[i] >= 0 && from[i] < score) score = from[i];
+    }
+    if (score > best_score) {
+      best = v;
+      best_score = score;
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief first landmark: the vertex farthest from the vertex of highest
+ * out-degree, a vertex on the rim of the graph
+ */
+static int first_landmark(const csr_graph_t *graph,
+                          shortest_path_tree_t *tree) {
+  int seed = 0;
+  for (int v = 1; v < graph->size; v++) {
+    if (csr_degree(graph, v) > csr_degree(graph, seed)) seed = v;
+  }
+  if (!get_shortest_path_tree_csr(graph, seed, tree)) return -1;
+  int best = seed;
+  for (int v = 0; v < graph->size; v++) {
+    if (csr_degree(graph, v) > 0 && tree->dist[v] > tree->dist[best]) {
+      best = v;
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief picks the landmarks one after another and fills both distance
+ * tables with one forward and one backward search per landmark
+ * @return false if a search failed
+ */
+static bool compute_landmarks(alt_landmarks_t *landmarks,
+                              const csr_graph_t *reverse,
+                              shortest_path_tree_t *tree, bool *is_landmark) {
+  for (int i = 0; i < landmarks->count; i++) {
+    const int landmark = i == 0
+                             ? first_landmark(landmarks->graph, tree)
+                             : farthest_vertex(landmarks, i, is_landmark);
+    if (landmark < 0) return false;
+    landmarks->landmarks[i] = landmark;
+    is_landmark[landmark] = true;
+    if (!get_shortest_path_tree_csr(landmarks->graph, landmark, tree)) {
+      return false;
+    }
+    store_column(landmarks->from_landmark, landmarks->count, i, tree);
+    if (!get_shortest_path_tree_csr(reverse, landmark, tree)) return false;
+    store_column(landmarks->to_landmark, landmarks->count, i, tree);
+  }
+  return true;
+}
+
+static alt_query_t *alt_query_create(int size) {
+  alt_query_t *query = (alt_query_t *)calloc(1, sizeof(alt_query_t));
+  if (!query) return NULL;
+  query->heap = indexed_heap_create(size);
+  query->dist = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  query->bound = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  query->stamp = (unsigned *)calloc((size_t)size + 1, sizeof(unsigned));
+  if (!query->heap || !query->dist || !query->bound || !query->stamp) {
+    indexed_heap_delete(query->heap);
+    free(query->dist);
+    free(query->bound);
+    free(query->stamp);
+    free(query);
+    query = NULL;
+  }
+  return query;
+}
+
+/**
+ * @brief selects landmarks and precomputes the distances to and from them
+ * with the csr shortest-path tree, one forward search over the graph and
+ * one over its transpose per landmark, O(k SSSP) time and 2 k V ints.
+ *
+ * Landmarks are chosen farthest-first: the first one is the vertex farthest
+ * from the vertex of highest out-degree, every next one the vertex farthest
+ * from all chosen so far. Landmarks on the rim of the graph give the
+ * tightest triangle-inequality bounds.
+ * @param graph csr graph pointer, only positive edges count (0 means no
+ * edge); it must outlive the landmarks
+ * @param landmark_count landmarks to select, 0 or less picks
+ * ALT_DEFAULT_LANDMARKS; at most one per vertex with outgoing edges
+ * @return landmarks or NULL if error
+ */
+alt_landmarks_t *alt_landmarks_create(const csr_graph_t *graph,
+                                      int landmark_count) {
+  if (!graph) return NULL;
+  int candidates = 0;
+  for (int v = 0; v < graph->size; v++) candidates += csr_degree(graph, v) > 0;
+  int count = landmark_count > 0 ? landmark_count : ALT_DEFAULT_LANDMARKS;
+  if (count > candidates) count = candidates;
+  alt_landmarks_t *landmarks =
+      (alt_landmarks_t *)calloc(1, sizeof(alt_landmarks_t));
+  if (!landmarks) return NULL;
+  landmarks->graph = graph;
+  landmarks->size = graph->size;
+  landmarks->count = count;
+  const size_t cells = (size_t)graph->size * (size_t)count + 1;
+  landmarks->landmarks = (int *)malloc(((size_t)count + 1) * sizeof(int));
+  landmarks->from_landmark = (int *)malloc(cells * sizeof(int));
+  landmarks->to_landmark = (int *)malloc(cells * sizeof(int));
+  landmarks->query = alt_query_create(graph->size);
+  csr_graph_t *reverse = count > 0 ? csr_graph_transpose(graph) : NULL;
+  shortest_path_tree_t *tree = shortest_path_tree_create(graph->size);
+  bool *is_landmark = (bool *)calloc((size_t)graph->size + 1, sizeof(bool));
+  bool success = landmarks->landmarks && landmarks->from_landmark &&
+                 landmarks->to_landmark && landmarks->query && tree &&
+                 is_landmark && (count == 0 || reverse);
+  success = success && compute_landmarks(landmarks, reverse, tree,
+                                         is_landmark);
+  csr_graph_delete(reverse);
+  shortest_path_tree_delete(tree);
+  free(is_landmark);
+  if (!success) {
+    alt_landmarks_delete(landmarks);
+    landmarks = NULL;
+  }
+  return landmarks;
+}
+
+/**
+ * @brief delete landmarks
+ * @param landmarks landmarks pointer
+ */
+void alt_landmarks_delete(alt_landmarks_t *landmarks) {
+  if (landmarks) {
+    if (landmarks->query) {
+      indexed_heap_delete(landmarks->query->heap);
+      free(landmarks->query->dist);
+      free(landmarks->query->bound);
+      free(landmarks->query->stamp);
+      free(landmarks->query);
+    }
+    free(landmarks->landmarks);
+    free(landmarks->from_landmark);
+    free(landmarks->to_landmark);
+    free(landmarks);
+  }
+}
+
+/**
+ * @brief triangle-inequality lower bound of the distance from vertex to
+ * target: d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L)
+ * for every landmark L, the largest of them is taken
+ * @param landmarks landmarks pointer
+ * @param vertex start of the estimated path
+ * @param target end of the estimated path
+ * @return the bound, INT_MAX if a landmark proves that target is
+ * unreachable from vertex
+ */
+int alt_lower_bound(const alt_landmarks_t *landmarks, int vertex,
+                    int target) {
+  const size_t count = (size_t)landmarks->count;
+  const int *from_v = landmarks->from_landmark + (size_t)vertex * count;
+  const int *from_t = landmarks->from_landmark + (size_t)target * count;
+  const int *to_v = landmarks->to_landmark + (size_t)vertex * count;
+  const int *to_t = landmarks->to_landmark + (size_t)target * count;
+  int bound = 0;
+  for (size_t i = 0; i < count; i++) {
+    // L reaches v but not t, or t reaches L but v does not
+    if ((from_v[i] >= 0 && from_t[i] < 0) || (to_t[i] >= 0 && to_v[i] < 0)) {
+      return INT_MAX;
+    }
+    if (from_v[i] >= 0 && from_t[i] - from_v[i] > bound) {
+      bound = from_t[i] - from_v[i];
+    }
+    if (to_t[i] >= 0 && to_v[i] - to_t[i] > bound) {
+      bound = to_v[i] - to_t[i];
+    }
+  }
+  return bound;
+}
+
+/**
+ * @brief shortest path length with A* guided by the landmark bounds, only
+ * with positive edges. Returns the same values as
+ * get_shortest_path_between_vertices.
+ *
+ * The bounds are consistent, so a settled vertex is final and the search
+ * ends when vertex2 is settled. Vertices a landmark proves unable to reach
+ * vertex2 are never queued, which also ends hopeless queries early.
+ * @param landmarks landmarks pointer, its query buffers are reused
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_alt(alt_landmarks_t *landmarks, int vertex1,
+                          int vertex2) {
+  if (!landmarks || vertex1 < 0 || vertex1 >= landmarks->size ||
+      vertex2 < 0 || vertex2 >= landmarks->size) {
+    return -1;
+  }
+  if (vertex1 == vertex2) return 0;
+  alt_query_t *query = landmarks->query;
+  if (++query->generation == 0) {
+    memset(query->stamp, 0, (size_t)landmarks->size * sizeof(unsigned));
+    query->generation = 1;
+  }
+  const unsigned generation = query->generation;
+  const csr_graph_t *graph = landmarks->graph;
+  indexed_heap_t *heap = query->heap;
+  indexed_heap_clear(heap);
+  const int start_bound = alt_lower_bound(landmarks, vertex1, vertex2);
+  if (start_bound == INT_MAX) return -1;
+  query->stamp[vertex1] = generation;
+  query->dist[vertex1] = 0;
+  indexed_heap_push(heap, vertex1, start_bound);
+  while (!indexed_heap_is_empty(heap)) {
+    const int u = indexed_heap_pop(heap);
+    if (u == vertex2) return query->dist[u];
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+      if (graph->weights[e] <= 0) continue;
+      const int v = graph->targets[e];
+      const int new_dist = query->dist[u] + graph->weights[e];
+      if (query->stamp[v] != generation) {
+        query->stamp[v] = generation;
+        query->bound[v] = alt_lower_bound(landmarks, v, vertex2);
+        query->dist[v] = new_dist;
+        if (query->bound[v] != INT_MAX) {
+          indexed_heap_push(heap, v, new_dist + query->bound[v]);
+        }
+      } else if (new_dist < query->dist[v] &&
+                 indexed_heap_contains(heap, v)) {
+        query->dist[v] = new_dist;
+        indexed_heap_decrease(heap, v, new_dist + query->bound[v]);
+      }
+    }
+  }
+  return -1;
+}
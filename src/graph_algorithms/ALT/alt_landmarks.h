@@ -0,0 +1,60 @@
+#ifndef S21_ALT_LANDMARKS_H
+#define S21_ALT_LANDMARKS_H
+
+#include <stdbool.h>
+
+#include "../../graph/s21_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief landmarks chosen by alt_landmarks_create when the caller passes 0
+ */
+#define ALT_DEFAULT_LANDMARKS 16
+
+/**
+ * @brief scratch buffers of the queries, private to alt_landmarks.c
+ */
+typedef struct alt_query alt_query_t;
+
+/**
+ * @brief landmark distances of the ALT (A*, landmarks, triangle inequality)
+ * search.
+ *
+ * Distances are stored vertex-major, the count distances of one vertex are
+ * contiguous, so the heuristic of a vertex reads one or two cache lines.
+ * @param graph graph the landmarks were computed on, must outlive them
+ * @param size number of vertices
+ * @param count number of landmarks
+ * @param landmarks the landmark vertices
+ * @param from_landmark from_landmark[v * count + i] is the distance from
+ * landmarks[i] to v, -1 if v is unreachable from it
+ * @param to_landmark to_landmark[v * count + i] is the distance from v to
+ * landmarks[i], -1 if it is unreachable from v
+ * @param query scratch reused by every query, so one set of landmarks
+ * answers one query at a time
+ */
+typedef struct {
+  const csr_graph_t *graph;
+  int size;
+  int count;
+  int *landmarks;
+  int *from_landmark;
+  int *to_landmark;
+  alt_query_t *query;
+} alt_landmarks_t;
+
+alt_landmarks_t *alt_landmarks_create(const csr_graph_t *graph,
+                                      int landmark_count);
+void alt_landmarks_delete(alt_landmarks_t *landmarks);
+int alt_lower_bound(const alt_landmarks_t *landmarks, int vertex, int target);
+int get_shortest_path_alt(alt_landmarks_t *landmarks, int vertex1,
+                          int vertex2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_ALT_LANDMARKS_H
@@ -0,0 +1,92 @@
+#include <climits>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+/**
+ * @brief every bound against the true distance: never above it, INT_MAX
+ * only for a target that is really unreachable
+ * @return number of pairs proven unreachable by INT_MAX
+ */
+int ExpectBoundsAdmissible(GraphWrapper& graph,
+                           const alt_landmarks_t* landmarks) {
+  shortest_path_tree_t* tree = shortest_path_tree_create(graph.getOrder());
+  EXPECT_NE(tree, nullptr);
+  int proven = 0;
+  for (int from = 0; tree && from < graph.getOrder(); from++) {
+    EXPECT_TRUE(get_shortest_path_tree(graph.getGraph(), from, tree));
+    for (int to = 0; to < graph.getOrder(); to++) {
+      const int bound = alt_lower_bound(landmarks, from, to);
+      if (tree->dist[to] >= 0) {
+        EXPECT_LE(bound, tree->dist[to]) << from << " -> " << to;
+      } else if (bound == INT_MAX) {
+        proven++;
+      }
+    }
+  }
+  shortest_path_tree_delete(tree);
+  return proven;
+}
+
+}  // namespace
+
+TEST(AltLandmarksTest, LandmarksAreDistinct) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 150, 3, true, 17u);
+  alt_landmarks_t* landmarks = alt_landmarks_create(graph.getCsrGraph(), 0);
+  ASSERT_NE(landmarks, nullptr);
+  EXPECT_EQ(landmarks->count, ALT_DEFAULT_LANDMARKS);
+  for (int i = 0; i < landmarks->count; i++) {
+    for (int j = i + 1; j < landmarks->count; j++) {
+      ASSERT_NE(landmarks->landmarks[i], landmarks->landmarks[j]);
+    }
+  }
+  alt_landmarks_delete(landmarks);
+}
+
+TEST(AltLandmarksTest, LowerBoundNeverExceedsDistance) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 120, 4, false, 5u);
+  alt_landmarks_t* landmarks = alt_landmarks_create(graph.getCsrGraph(), 6);
+  ASSERT_NE(landmarks, nullptr);
+  ExpectBoundsAdmissible(graph, landmarks);
+  alt_landmarks_delete(landmarks);
+}
+
+TEST(AltLandmarksTest, LowerBoundProvesUnreachable) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt"));
+  // every vertex is a landmark, so every unreachable pair is proven
+  alt_landmarks_t* landmarks =
+      alt_landmarks_create(graph.getCsrGraph(), graph.getOrder());
+  ASSERT_NE(landmarks, nullptr);
+  EXPECT_GT(ExpectBoundsAdmissible(graph, landmarks), 0);
+  EXPECT_EQ(get_shortest_path_alt(landmarks, 0, graph.getOrder() - 1), -1);
+  alt_landmarks_delete(landmarks);
+}
+
+TEST(AltLandmarksTest, LandmarkCountIsClamped) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 12, 30, false, 41u);
+  alt_landmarks_t* landmarks = alt_landmarks_create(graph.getCsrGraph(), 50);
+  ASSERT_NE(landmarks, nullptr);
+  EXPECT_LE(landmarks->count, graph.getOrder());
+  ExpectAllPairsMatchTree(graph, [landmarks](int from, int to) {
+    return get_shortest_path_alt(landmarks, from, to);
+  });
+  alt_landmarks_delete(landmarks);
+}
+
+TEST(AltLandmarksTest, EmptyGraph) {
+  GraphWrapper empty;
+  empty.createGraph(5);
+  alt_landmarks_t* landmarks = alt_landmarks_create(empty.getCsrGraph(), 4);
+  ASSERT_NE(landmarks, nullptr);
+  EXPECT_EQ(landmarks->count, 0);
+  EXPECT_EQ(get_shortest_path_alt(landmarks, 0, 3), -1);
+  EXPECT_EQ(get_shortest_path_alt(landmarks, 2, 2), 0);
+  alt_landmarks_delete(landmarks);
+}
@@ -1,4 +1,4 @@
-#include "../data_structures/queue/queue.h"
+#include "../data_structures/ring_queue/ring_queue.h"
 #include "../s21_graph_algorithms.h"
 
 /**
@@ -15,27 +15,264 @@ void breadth_first_search(graph_t* graph, int start_vertex,
       start_vertex >= graph->adjacency->size) {
     return;
   }
-  queue* q = queue_create();
+  ring_queue_t* q = ring_queue_create(graph->adjacency->size);
   if (!q) return;
   int* visited = (int*)calloc(graph->adjacency->size, sizeof(int));
   if (!visited) {
-    queue_delete(q);
+    ring_queue_delete(q);
     return;
   }
-  queue_push(q, start_vertex);
+  ring_queue_push(q, start_vertex);
   visited[start_vertex] = 1;
   result->size = 0;
-  while (!queue_is_empty(q)) {
-    int current_vertex = queue_front(q);
-    queue_pop(q);
+  while (!ring_queue_is_empty(q)) {
+    int current_vertex = ring_queue_front(q);
+    ring_queue_pop(q);
     result->visited_vertices[result->size++] = current_vertex;
+    const int* row = matrix_row(graph->adjacency, current_vertex);
     for (int n = 0; n < graph->adjacency->size; n++) {
-      if (graph->adjacency->data[current_vertex][n] && !visited[n]) {
-        queue_push(q, n);
+      if (row[n] && !visited[n]) {
+        ring_queue_push(q, n);
         visited[n] = 1;
       }
     }
   }
-  queue_delete(q);
+  ring_queue_delete(q);
   free(visited);
 }
+
+/**
+ * @brief breadth first search (BFS) over compressed sparse rows, O(V + E)
+ * @param graph csr graph pointer
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @return void
+ */
+void breadth_first_search_csr(const csr_graph_t* graph, int start_vertex,
+                              graph_traversal_result_t* result) {
+  if (!graph || !result || graph->size == 0 || start_vertex < 0 ||
+      start_vertex >= graph->size) {
+    return;
+  }
+  ring_queue_t* q = ring_queue_create(graph->size);
+  if (!q) return;
+  int* visited = (int*)calloc(graph->size, sizeof(int));
+  if (!visited) {
+    ring_queue_delete(q);
+    return;
+  }
+  ring_queue_push(q, start_vertex);
+  visited[start_vertex] = 1;
+  result->size = 0;
+  while (!ring_queue_is_empty(q)) {
+    int current_vertex = ring_queue_front(q);
+    ring_queue_pop(q);
+    result->visited_vertices[result->size++] = current_vertex;
+    for (int e = graph->offsets[current_vertex];
+         e < graph->offsets[current_vertex + 1]; e++) {
+      const int n = graph->targets[e];
+      if (!visited[n]) {
+        ring_queue_push(q, n);
+        visited[n] = 1;
+      }
+    }
+  }
+  ring_queue_delete(q);
+  free(visited);
+}
+
+/**
+ * @brief breadth first search (BFS) over a bit matrix, same visiting order
+ * as breadth_first_search. Unvisited neighbours are found 64 at a time as
+ * row & ~visited and walked with count-trailing-zeros.
+ * @param graph bit matrix pointer
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @return void
+ */
+void breadth_first_search_bits(const bit_matrix_t* graph, int start_vertex,
+                               graph_traversal_result_t* result) {
+  if (!graph || !result || graph->size == 0 || start_vertex < 0 ||
+      start_vertex >= graph->size) {
+    return;
+  }
+  uint64_t* visited =
+      (uint64_t*)calloc((size_t)graph->words_per_row, sizeof(uint64_t));
+  if (!visited) return;
+  // every vertex is enqueued once, the result array doubles as the queue
+  int* queue = result->visited_vertices;
+  int head = 0, tail = 0;
+  queue[tail++] = start_vertex;
+  visited[start_vertex / BIT_MATRIX_WORD_BITS] |=
+      (uint64_t)1 << (start_vertex % BIT_MATRIX_WORD_BITS);
+  while (head < tail) {
+    const uint64_t* row = bit_matrix_row(graph, queue[head++]);
+    for (int w = 0; w < graph->words_per_row; w++) {
+      uint64_t fresh = row[w] & ~visited[w];
+      visited[w] |= fresh;
+      while (fresh) {
+        queue[tail++] = w * BIT_MATRIX_WORD_BITS + bit_scan_forward(fresh);
+        fresh &= fresh - 1;
+      }
+    }
+  }
+  result->size = tail;
+  free(visited);
+}
+
+/**
+ * @brief breadth first search (BFS) with scratch taken from an arena, same
+ * visiting order as breadth_first_search and no heap allocation
+ * @param graph graph structure pointer
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @param arena scratch memory, everything taken from it is released on return
+ * @return void
+ */
+void breadth_first_search_arena(graph_t* graph, int start_vertex,
+                                graph_traversal_result_t* result,
+                                arena_t* arena) {
+  if (!graph || !result || !arena || !graph->adjacency ||
+      !graph->adjacency->data || graph->adjacency->size == 0 ||
+      start_vertex < 0 || start_vertex >= graph->adjacency->size) {
+    return;
+  }
+  const int size = graph->adjacency->size;
+  const arena_mark_t mark = arena_mark(arena);
+  unsigned char* visited =
+      (unsigned char*)arena_calloc(arena, (size_t)size, sizeof(char));
+  if (visited) {
+    // every vertex is enqueued once, the result array doubles as the queue
+    int* queue = result->visited_vertices;
+    int head = 0, tail = 0;
+    queue[tail++] = start_vertex;
+    visited[start_vertex] = 1;
+    while (head < tail) {
+      const int* row = matrix_row(graph->adjacency, queue[head++]);
+      for (int n = 0; n < size; n++) {
+        if (row[n] && !visited[n]) {
+          queue[tail++] = n;
+          visited[n] = 1;
+        }
+      }
+    }
+    result->size = tail;
+  }
+  arena_release(arena, mark);
+}
+
+/**
+ * @brief breadth first search (BFS) reusing the buffers of a workspace, same
+ * visiting order as breadth_first_search without allocation or clearing
+ * @param workspace workspace of the graph to search
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @return void
+ */
+void breadth_first_search_with_workspace(graph_workspace_t* workspace,
+                                         int start_vertex,
+                                         graph_traversal_result_t* result) {
+  if (!result || !graph_workspace_begin(workspace) || start_vertex < 0 ||
+      start_vertex >= workspace->size) {
+    return;
+  }
+  const matrix_t* adjacency = workspace->graph->adjacency;
+  // every vertex is enqueued once, the result array doubles as the queue
+  int* queue = result->visited_vertices;
+  int head = 0, tail = 0;
+  queue[tail++] = start_vertex;
+  workspace_visit(workspace, start_vertex);
+  while (head < tail) {
+    const int* row = matrix_row(adjacency, queue[head++]);
+    for (int n = 0; n < workspace->size; n++) {
+      if (row[n] && !workspace_is_visited(workspace, n)) {
+        queue[tail++] = n;
+        workspace_visit(workspace, n);
+      }
+    }
+  }
+  result->size = tail;
+}
+
+/**
+ * @brief records a newly visited vertex one level below its parent
+ */
+static void visit_level(graph_levels_result_t* result, int vertex,
+                        int parent) {
+  result->levels[vertex] = parent < 0 ? 0 : result->levels[parent] + 1;
+  result->parents[vertex] = parent;
+  result->order[result->reached++] = vertex;
+}
+
+/**
+ * @brief breadth first search (BFS) filling levels and parents, stops as soon
+ * as the target is visited or the visit budget is spent. Only the vertices of
+ * the previous query are cleared, so a bounded query costs O(k * V) for k
+ * visited vertices instead of O(V^2).
+ * @param graph graph structure pointer
+ * @param start_vertex start vertex
+ * @param limits stop conditions, NULL to visit every reachable vertex
+ * @param result levels result of the same size as the graph, order lists the
+ * vertices in the order of breadth_first_search
+ * @return void
+ */
+void breadth_first_search_levels(graph_t* graph, int start_vertex,
+                                 const traversal_limits_t* limits,
+                                 graph_levels_result_t* result) {
+  if (!graph || !result || !graph->adjacency || !graph->adjacency->data ||
+      graph->adjacency->size != result->size || start_vertex < 0 ||
+      start_vertex >= result->size) {
+    return;
+  }
+  levels_result_reset(result);
+  // every vertex is enqueued once, the order array doubles as the queue
+  int head = 0;
+  visit_level(result, start_vertex, -1);
+  bool done = traversal_limits_reached(limits, start_vertex, result->reached);
+  while (!done && head < result->reached) {
+    const int current_vertex = result->order[head++];
+    const int* row = matrix_row(graph->adjacency, current_vertex);
+    for (int n = 0; n < result->size && !done; n++) {
+      if (row[n] && result->levels[n] < 0) {
+        visit_level(result, n, current_vertex);
+        done = traversal_limits_reached(limits, n, result->reached);
+      }
+    }
+  }
+}
+
+/**
+ * @brief breadth first search (BFS) over compressed sparse rows filling levels
+ * and parents, stops as soon as the target is visited or the visit budget is
+ * spent, a bounded query only touches the edges of the explored region
+ * @param graph csr graph pointer
+ * @param start_vertex start vertex
+ * @param limits stop conditions, NULL to visit every reachable vertex
+ * @param result levels result of the same size as the graph, order lists the
+ * vertices in the order of breadth_first_search_csr
+ * @return void
+ */
+void breadth_first_search_levels_csr(const csr_graph_t* graph,
+                                     int start_vertex,
+                                     const traversal_limits_t* limits,
+                                     graph_levels_result_t* result) {
+  if (!graph || !result || graph->size != result->size || start_vertex < 0 ||
+      start_vertex >= graph->size) {
+    return;
+  }
+  levels_result_reset(result);
+  int head = 0;
+  visit_level(result, start_vertex, -1);
+  bool done = traversal_limits_reached(limits, start_vertex, result->reached);
+  while (!done && head < result->reached) {
+    const int current_vertex = result->order[head++];
+    for (int e = graph->offsets[current_vertex];
+         e < graph->offsets[current_vertex + 1] && !done; e++) {
+      const int n = graph->targets[e];
+      if (result->levels[n] < 0) {
+        visit_level(result, n, current_vertex);
+        done = traversal_limits_reached(limits, n, result->reached);
+      }
+    }
+  }
+}
@@ -0,0 +1,173 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "../s21_graph_algorithms.h"
+
+/**
+ * @brief switch to bottom-up when the edges out of the frontier exceed
+ * 1/ALPHA of the edges into unvisited vertices
+ */
+#define DIRECTION_OPTIMIZING_ALPHA 14
+
+/**
+ * @brief switch back to top-down when the frontier shrinks below V/BETA
+ */
+#define DIRECTION_OPTIMIZING_BETA 24
+
+/**
+ * @brief state of one direction-optimizing search
+ * @param graph out-edges, read by top-down steps
+ * @param reverse in-edges, read by bottom-up steps
+ * @param frontier vertices of the current level
+ * @param next vertices of the next level
+ * @param in_frontier bitmap of frontier, filled for bottom-up steps
+ * @param unvisited_edges in-edges of vertices not reached yet
+ */
+typedef struct {
+  const csr_graph_t *graph;
+  const csr_graph_t *reverse;
+  graph_levels_result_t *result;
+  int *frontier;
+  int frontier_size;
+  int *next;
+  int next_size;
+  uint64_t *in_frontier;
+  long long unvisited_edges;
+} direction_bfs_t;
+
+static void visit(direction_bfs_t *bfs, int vertex, int parent, int level) {
+  bfs->result->levels[vertex] = level;
+  bfs->result->parents[vertex] = parent;
+  bfs->result->order[bfs->result->reached++] = vertex;
+  bfs->next[bfs->next_size++] = vertex;
+  bfs->unvisited_edges -= csr_degree(bfs->reverse, vertex);
+}
+
+/**
+ * @brief expands every frontier vertex along its out-edges
+ * @return sum of out-degrees of the next frontier, the cost of the next
+ * top-down step
+ */
+static long long top_down_step(direction_bfs_t *bfs, int level) {
+  const csr_graph_t *graph = bfs->graph;
+  const int *levels = bfs->result->levels;
+  long long next_edges = 0;
+  for (int i = 0; i < bfs->frontier_size; i++) {
+    const int u = bfs->frontier[i];
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+      const int v = graph->targets[e];
+      if (levels[v] < 0) {
+        visit(bfs, v, u, level + 1);
+        next_edges += csr_degree(graph, v);
+      }
+    }
+  }
+  return next_edges;
+}
+
+/**
+ * @brief lets every unvisited vertex look for any parent in the frontier,
+ * stopping at the first one found
+ */
+static void bottom_up_step(direction_bfs_t *bfs, int level) {
+  const csr_graph_t *reverse = bfs->reverse;
+  const int size = reverse->size;
+  memset(bfs->in_frontier, 0, ((size_t)size + 63) / 64 * sizeof(uint64_t));
+  for (int i = 0; i < bfs->frontier_size; i++) {
+    const int u = bfs->frontier[i];
+    bfs->in_frontier[u >> 6] |= 1ull << (u & 63);
+  }
+  const int *levels = bfs->result->levels;
+  for (int v = 0; v < size; v++) {
+    if (levels[v] >= 0) continue;
+    for (int e = reverse->offsets[v]; e < reverse->offsets[v + 1]; e++) {
+      const int u = reverse->targets[e];
+      if (bfs->in_frontier[u >> 6] >> (u & 63) & 1ull) {
+        visit(bfs, v, u, level + 1);
+        break;
+      }
+    }
+  }
+}
+
+static void swap_frontiers(direction_bfs_t *bfs) {
+  int *swap = bfs->frontier;
+  bfs->frontier = bfs->next;
+  bfs->frontier_size = bfs->next_size;
+  bfs->next = swap;
+  bfs->next_size = 0;
+}
+
+/**
+ * @brief runs the levels, switching between top-down and bottom-up steps
+ * with the heuristic of Beamer et al.
+ */
+static void run_levels(direction_bfs_t *bfs, int start_vertex) {
+  const int size = bfs->graph->size;
+  long long frontier_edges = csr_degree(bfs->graph, start_vertex);
+  visit(bfs, start_vertex, -1, 0);
+  swap_frontiers(bfs);
+  for (int level = 0; bfs->frontier_size > 0; level++) {
+    if (frontier_edges > bfs->unvisited_edges / DIRECTION_OPTIMIZING_ALPHA) {
+      int previous_size;
+      do {
+        previous_size = bfs->frontier_size;
+        bottom_up_step(bfs, level++);
+        swap_frontiers(bfs);
+      } while (bfs->frontier_size > 0 &&
+               (bfs->frontier_size >= previous_size ||
+                bfs->frontier_size > size / DIRECTION_OPTIMIZING_BETA));
+      level--;
+      frontier_edges = 0;
+      for (int i = 0; i < bfs->frontier_size; i++) {
+        frontier_edges += csr_degree(bfs->graph, bfs->frontier[i]);
+      }
+    } else {
+      frontier_edges = top_down_step(bfs, level);
+      swap_frontiers(bfs);
+    }
+  }
+}
+
+/**
+ * @brief direction-optimizing breadth first search over compressed sparse
+ * rows.
+ *
+ * Levels whose frontier is small expand frontier vertices along their
+ * out-edges (top-down). When the frontier covers a large part of the graph
+ * the search switches to bottom-up steps: every unvisited vertex scans its
+ * in-edges and stops at the first parent found in the frontier, which skips
+ * most edges on low-diameter graphs.
+ * @param graph csr graph pointer
+ * @param reverse in-edges of graph (csr_graph_transpose), NULL if graph is
+ * symmetric
+ * @param start_vertex start vertex
+ * @param result receives levels and parents of every vertex, parents may
+ * differ from breadth_first_search_csr but always form a BFS tree
+ * @return void
+ */
+void breadth_first_search_direction_optimizing(const csr_graph_t *graph,
+                                               const csr_graph_t *reverse,
+                                               int start_vertex,
+                                               graph_levels_result_t *result) {
+  if (!graph || !result || result->size != graph->size || start_vertex < 0 ||
+      start_vertex >= graph->size ||
+      (reverse && reverse->size != graph->size)) {
+    return;
+  }
+  const int size = graph->size;
+  direction_bfs_t bfs = {graph, reverse ? reverse : graph, result, NULL, 0,
+                         NULL, 0, NULL, 0};
+  bfs.frontier = (int *)malloc((size_t)size * sizeof(int));
+  bfs.next = (int *)malloc((size_t)size * sizeof(int));
+  bfs.in_frontier =
+      (uint64_t *)malloc(((size_t)size + 63) / 64 * sizeof(uint64_t));
+  if (bfs.frontier && bfs.next && bfs.in_frontier) {
+    levels_result_reset(result);
+    bfs.unvisited_edges = bfs.reverse->edge_count;
+    run_levels(&bfs, start_vertex);
+  }
+  free(bfs.frontier);
+  free(bfs.next);
+  free(bfs.in_frontier);
+}
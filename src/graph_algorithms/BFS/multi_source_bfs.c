@@ -0,0 +1,116 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "../s21_graph_algorithms.h"
+
+/**
+ * @brief per-vertex source bitsets of one batch, bit i stands for source i
+ * @param seen sources that reached the vertex
+ * @param visit sources whose frontier contains the vertex
+ * @param visit_next sources that reach the vertex on the next level
+ */
+typedef struct {
+  uint64_t *seen;
+  uint64_t *visit;
+  uint64_t *visit_next;
+} source_sets_t;
+
+/**
+ * @brief one level of every source at once: each edge scan moves all
+ * frontier bits of its source vertex
+ * @return true if some source reached a new vertex
+ */
+static bool expand_level(const csr_graph_t *graph, source_sets_t *sets,
+                         int level, int *distances, int first_source) {
+  const int size = graph->size;
+  for (int v = 0; v < size; v++) {
+    const uint64_t visit = sets->visit[v];
+    if (!visit) continue;
+    for (int e = graph->offsets[v]; e < graph->offsets[v + 1]; e++) {
+      sets->visit_next[graph->targets[e]] |= visit;
+    }
+  }
+  bool advanced = false;
+  for (int v = 0; v < size; v++) {
+    uint64_t fresh = sets->visit_next[v] & ~sets->seen[v];
+    sets->visit_next[v] = fresh;
+    sets->seen[v] |= fresh;
+    advanced |= fresh != 0;
+    while (fresh) {
+      const int source = first_source + bit_scan_forward(fresh);
+      distances[(size_t)source * size + v] = level;
+      fresh &= fresh - 1;
+    }
+  }
+  return advanced;
+}
+
+static void run_batch(const csr_graph_t *graph, const int *sources,
+                      int first_source, int batch_size, source_sets_t *sets,
+                      int *distances) {
+  const size_t bytes = (size_t)graph->size * sizeof(uint64_t);
+  memset(sets->seen, 0, bytes);
+  memset(sets->visit, 0, bytes);
+  memset(sets->visit_next, 0, bytes);
+  for (int i = 0; i < batch_size; i++) {
+    const int vertex = sources[first_source + i];
+    sets->seen[vertex] |= 1ull << i;
+    sets->visit[vertex] |= 1ull << i;
+    distances[(size_t)(first_source + i) * graph->size + vertex] = 0;
+  }
+  for (int level = 1;
+       expand_level(graph, sets, level, distances, first_source); level++) {
+    uint64_t *swap = sets->visit;
+    sets->visit = sets->visit_next;
+    sets->visit_next = swap;
+    memset(sets->visit_next, 0, bytes);
+  }
+}
+
+/**
+ * @brief bit-parallel breadth first search from many sources (MS-BFS).
+ *
+ * Sources are processed in batches of MULTI_SOURCE_BFS_BATCH. Every vertex
+ * keeps one bit per source of the batch for "seen", "in frontier" and "in
+ * next frontier", so one scan of an edge advances every source whose
+ * frontier contains the edge's tail, and a level costs one pass over the
+ * graph for the whole batch.
+ * @param graph csr graph pointer
+ * @param sources start vertices, duplicates are allowed
+ * @param source_count number of sources
+ * @param distances source_count rows of graph->size hop distances,
+ * distances[i * size + v] is the distance from sources[i] to v, -1 if v is
+ * unreachable
+ * @return true on success, false on invalid input or allocation failure
+ */
+bool multi_source_breadth_first_search(const csr_graph_t *graph,
+                                       const int *sources, int source_count,
+                                       int *distances) {
+  if (!graph || !distances || source_count < 0 ||
+      (source_count > 0 && !sources)) {
+    return false;
+  }
+  for (int i = 0; i < source_count; i++) {
+    if (sources[i] < 0 || sources[i] >= graph->size) return false;
+  }
+  const size_t bytes = ((size_t)graph->size + 1) * sizeof(uint64_t);
+  source_sets_t sets = {(uint64_t *)malloc(bytes), (uint64_t *)malloc(bytes),
+                        (uint64_t *)malloc(bytes)};
+  const bool success = sets.seen && sets.visit && sets.visit_next;
+  if (success) {
+    for (size_t i = 0; i < (size_t)source_count * graph->size; i++) {
+      distances[i] = -1;
+    }
+    for (int first = 0; first < source_count;
+         first += MULTI_SOURCE_BFS_BATCH) {
+      const int batch = source_count - first < MULTI_SOURCE_BFS_BATCH
+                            ? source_count - first
+                            : MULTI_SOURCE_BFS_BATCH;
+      run_batch(graph, sources, first, batch, &sets, distances);
+    }
+  }
+  free(sets.seen);
+  free(sets.visit);
+  free(sets.visit_next);
+  return success;
+}
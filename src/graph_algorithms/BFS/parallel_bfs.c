@@ -0,0 +1,211 @@
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../s21_graph_algorithms.h"
+
+/**
+ * @brief frontier vertices a thread takes at once, small enough to balance
+ * hubs of power-law graphs, large enough to keep the counter cold
+ */
+#define PARALLEL_BFS_CHUNK 64
+
+/**
+ * @brief vertices claimed by one thread during the current level
+ */
+typedef struct {
+  int *vertices;
+  int count;
+  int capacity;
+  int offset;
+} local_frontier_t;
+
+/**
+ * @brief state shared by the threads of one search
+ * @param order BFS order, the frontier of the current level is
+ * order[frontier_begin, frontier_end)
+ * @param visited one bit per vertex, claimed with atomic fetch-or
+ * @param next_chunk index of the next frontier chunk to take
+ * @param failed set when a local frontier could not grow
+ */
+typedef struct {
+  const csr_graph_t *graph;
+  int *order;
+  int *levels;
+  int *parents;
+  _Atomic uint64_t *visited;
+  local_frontier_t *locals;
+  int frontier_begin;
+  int frontier_end;
+  int level;
+  atomic_int next_chunk;
+  atomic_bool failed;
+} parallel_bfs_t;
+
+/**
+ * @brief sets the bit of vertex
+ * @return true if this call set it, false if it was already set
+ */
+static bool claim(_Atomic uint64_t *visited, int vertex) {
+  const uint64_t mask = 1ull << (vertex & 63);
+  _Atomic uint64_t *word = &visited[vertex >> 6];
+  if (atomic_load_explicit(word, memory_order_relaxed) & mask) return false;
+  return !(atomic_fetch_or_explicit(word, mask, memory_order_relaxed) & mask);
+}
+
+static bool local_push(local_frontier_t *local, int vertex) {
+  if (local->count == local->capacity) {
+    const int capacity = local->capacity ? local->capacity * 2 : 1024;
+    int *vertices =
+        (int *)realloc(local->vertices, (size_t)capacity * sizeof(int));
+    if (!vertices) return false;
+    local->vertices = vertices;
+    local->capacity = capacity;
+  }
+  local->vertices[local->count++] = vertex;
+  return true;
+}
+
+/**
+ * @brief task: expands chunks of the frontier into the thread's local
+ * frontier
+ */
+static void expand_level(void *arg, int thread_index) {
+  parallel_bfs_t *bfs = (parallel_bfs_t *)arg;
+  const csr_graph_t *graph = bfs->graph;
+  local_frontier_t *local = &bfs->locals[thread_index];
+  local->count = 0;
+  for (;;) {
+    const int begin =
+        bfs->frontier_begin +
+        atomic_fetch_add_explicit(&bfs->next_chunk, PARALLEL_BFS_CHUNK,
+                                  memory_order_relaxed);
+    if (begin >= bfs->frontier_end) break;
+    const int end = begin + PARALLEL_BFS_CHUNK < bfs->frontier_end
+                        ? begin + PARALLEL_BFS_CHUNK
+                        : bfs->frontier_end;
+    for (int i = begin; i < end; i++) {
+      const int u = bfs->order[i];
+      for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+        const int v = graph->targets[e];
+        if (!claim(bfs->visited, v)) continue;
+        if (bfs->levels) {
+          bfs->levels[v] = bfs->level + 1;
+          bfs->parents[v] = u;
+        }
+        if (!local_push(local, v)) {
+          atomic_store(&bfs->failed, true);
+          return;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief task: copies the thread's local frontier to its slot after the
+ * current frontier, the slots were assigned by a prefix sum
+ */
+static void append_level(void *arg, int thread_index) {
+  parallel_bfs_t *bfs = (parallel_bfs_t *)arg;
+  const local_frontier_t *local = &bfs->locals[thread_index];
+  if (local->count > 0) {
+    memcpy(bfs->order + bfs->frontier_end + local->offset, local->vertices,
+           (size_t)local->count * sizeof(int));
+  }
+}
+
+static void run_levels(parallel_bfs_t *bfs, thread_pool_t *pool,
+                       int start_vertex) {
+  const int thread_count = thread_pool_size(pool);
+  bfs->order[0] = start_vertex;
+  claim(bfs->visited, start_vertex);
+  if (bfs->levels) bfs->levels[start_vertex] = 0;
+  bfs->frontier_begin = 0;
+  bfs->frontier_end = 1;
+  for (bfs->level = 0; bfs->frontier_begin < bfs->frontier_end; bfs->level++) {
+    atomic_store(&bfs->next_chunk, 0);
+    thread_pool_run(pool, expand_level, bfs);
+    if (atomic_load(&bfs->failed)) return;
+    int next_size = 0;
+    for (int t = 0; t < thread_count; t++) {
+      bfs->locals[t].offset = next_size;
+      next_size += bfs->locals[t].count;
+    }
+    thread_pool_run(pool, append_level, bfs);
+    bfs->frontier_begin = bfs->frontier_end;
+    bfs->frontier_end += next_size;
+  }
+}
+
+/**
+ * @brief lists the claimed vertices in levels->order. After a failed search
+ * the claims are not all in the order array, so every vertex is cleared.
+ */
+static void record_levels_order(const parallel_bfs_t *bfs,
+                                graph_levels_result_t *levels) {
+  if (atomic_load(&bfs->failed)) {
+    for (int v = 0; v < levels->size; v++) {
+      levels->levels[v] = -1;
+      levels->parents[v] = -1;
+    }
+  } else {
+    memcpy(levels->order, bfs->order, (size_t)bfs->frontier_end * sizeof(int));
+    levels->reached = bfs->frontier_end;
+  }
+}
+
+/**
+ * @brief level-synchronous parallel breadth first search over compressed
+ * sparse rows.
+ *
+ * Every level is expanded by all threads of the pool, which take chunks of
+ * the frontier from an atomic counter and claim vertices in an atomic
+ * visited bitmap, so each vertex is claimed by exactly one thread. Claimed
+ * vertices go to per-thread buffers that are appended after the frontier at
+ * offsets from a prefix sum, without locks.
+ * @param graph csr graph pointer
+ * @param start_vertex start vertex
+ * @param pool threads to use, NULL runs on the calling thread
+ * @param result receives a BFS order: vertices by non-decreasing level, the
+ * order inside a level depends on scheduling
+ * @param levels receives levels and parents, may be NULL
+ * @return void
+ */
+void breadth_first_search_parallel(const csr_graph_t *graph, int start_vertex,
+                                   thread_pool_t *pool,
+                                   graph_traversal_result_t *result,
+                                   graph_levels_result_t *levels) {
+  if (!graph || !result || start_vertex < 0 || start_vertex >= graph->size ||
+      (levels && levels->size != graph->size)) {
+    return;
+  }
+  const int thread_count = thread_pool_size(pool);
+  const size_t words = ((size_t)graph->size + 63) / 64;
+  parallel_bfs_t bfs;
+  memset(&bfs, 0, sizeof(bfs));
+  bfs.graph = graph;
+  bfs.order = result->visited_vertices;
+  bfs.levels = levels ? levels->levels : NULL;
+  bfs.parents = levels ? levels->parents : NULL;
+  bfs.visited = (_Atomic uint64_t *)malloc(words * sizeof(uint64_t));
+  bfs.locals = (local_frontier_t *)calloc((size_t)thread_count,
+                                          sizeof(local_frontier_t));
+  atomic_init(&bfs.next_chunk, 0);
+  atomic_init(&bfs.failed, false);
+  if (bfs.visited && bfs.locals) {
+    for (size_t w = 0; w < words; w++) atomic_init(&bfs.visited[w], 0);
+    if (levels) levels_result_reset(levels);
+    run_levels(&bfs, pool, start_vertex);
+    if (!atomic_load(&bfs.failed)) {
+      result->size = bfs.frontier_end;
+    }
+    if (levels) record_levels_order(&bfs, levels);
+  }
+  for (int t = 0; bfs.locals && t < thread_count; t++) {
+    free(bfs.locals[t].vertices);
+  }
+  free(bfs.locals);
+  free((void *)bfs.visited);
+}
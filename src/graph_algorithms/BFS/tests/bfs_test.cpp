@@ -123,3 +123,142 @@ TEST(GraphAlgorithmsTest, BreadthFirstSearch_ComplexGraph) {
 
   ASSERT_EQ((int)unique_vertices.size(), 6);
 }
+
+TEST(GraphAlgorithmsTest, BreadthFirstSearchCsr_MatchesMatrix) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/graph_examples.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  for (int start = 0; start < graph.getOrder(); start++) {
+    ASSERT_EQ(algorithms.breadthFirstSearchCsr(graph, start),
+              algorithms.breadthFirstSearch(graph, start));
+  }
+}
+
+TEST(GraphAlgorithmsTest, BreadthFirstSearchCsr_DisconnectedGraph) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  std::vector<int> expected = {3, 4, 5};
+
+  ASSERT_EQ(algorithms.breadthFirstSearchCsr(graph, 3), expected);
+}
+
+TEST(GraphAlgorithmsTest, BreadthFirstSearchBits_MatchesMatrix) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/graph_examples.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  for (int start = 0; start < graph.getOrder(); start++) {
+    ASSERT_EQ(algorithms.breadthFirstSearchBits(graph, start),
+              algorithms.breadthFirstSearch(graph, start));
+  }
+}
+
+TEST(GraphAlgorithmsTest, BreadthFirstSearchBits_RowsOfSeveralWords) {
+  const int kSize = 150;
+  GraphWrapper graph;
+  FillRandomGraph(graph, kSize, 2, false, 12345u, 9);
+
+  GraphAlgorithmsWrapper algorithms;
+  for (int start = 0; start < kSize; start += 7) {
+    ASSERT_EQ(algorithms.breadthFirstSearchBits(graph, start),
+              algorithms.breadthFirstSearch(graph, start));
+  }
+}
+
+TEST(GraphAlgorithmsTest, BreadthFirstSearchLevels_MatchesOrderAndHops) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/graph_examples.txt");
+  GraphAlgorithmsWrapper algorithms;
+  const int size = graph.getOrder();
+  graph_levels_result_t* result = levels_result_create(size);
+  ASSERT_NE(result, nullptr);
+  for (int start = 0; start < size; start++) {
+    breadth_first_search_levels(graph.getGraph(), start, nullptr, result);
+    const std::vector<int> expected =
+        algorithms.breadthFirstSearch(graph, start);
+    ASSERT_EQ(std::vector<int>(result->order, result->order + result->reached),
+              expected);
+    EXPECT_EQ(result->levels[start], 0);
+    EXPECT_EQ(result->parents[start], -1);
+    for (int i = 1; i < result->reached; i++) {
+      const int v = result->order[i];
+      const int parent = result->parents[v];
+      ASSERT_GE(parent, 0);
+      EXPECT_EQ(result->levels[v], result->levels[parent] + 1);
+      EXPECT_NE(graph.getMatrixValue(parent, v), 0);
+      EXPECT_GE(result->levels[v], result->levels[result->order[i - 1]]);
+    }
+  }
+  levels_result_delete(result);
+}
+
+TEST(GraphAlgorithmsTest, BreadthFirstSearchLevels_StopsAtTarget) {
+  const int kSize = 50;
+  GraphWrapper graph;
+  graph.createGraph(kSize);
+  for (int i = 0; i + 1 < kSize; i++) {
+    matrix_row(graph.getGraph()->adjacency, i)[i + 1] = 1;
+    matrix_row(graph.getGraph()->adjacency, i + 1)[i] = 1;
+  }
+  graph_levels_result_t* result = levels_result_create(kSize);
+  ASSERT_NE(result, nullptr);
+  traversal_limits_t limits = {7, 0};
+  breadth_first_search_levels(graph.getGraph(), 3, &limits, result);
+  EXPECT_EQ(result->levels[7], 4);
+  EXPECT_EQ(result->order[result->reached - 1], 7);
+  EXPECT_EQ(result->levels[8], -1);
+  EXPECT_LT(result->reached, kSize);
+  std::vector<int> path(kSize);
+  ASSERT_EQ(levels_result_path(result, 7, path.data()), 5);
+  EXPECT_EQ(std::vector<int>(path.begin(), path.begin() + 5),
+            std::vector<int>({3, 4, 5, 6, 7}));
+  EXPECT_EQ(levels_result_path(result, 20, path.data()), -1);
+
+  limits = {-1, 4};
+  breadth_first_search_levels(graph.getGraph(), 20, &limits, result);
+  EXPECT_EQ(result->reached, 4);
+  int reached = 0;
+  for (int v = 0; v < kSize; v++) reached += result->levels[v] >= 0;
+  EXPECT_EQ(reached, 4);
+  EXPECT_EQ(result->levels[3], -1);
+  EXPECT_EQ(result->levels[7], -1);
+
+  limits = {20, 0};
+  breadth_first_search_levels(graph.getGraph(), 20, &limits, result);
+  EXPECT_EQ(result->reached, 1);
+  ASSERT_EQ(levels_result_path(result, 20, path.data()), 1);
+  EXPECT_EQ(path[0], 20);
+  levels_result_delete(result);
+}
+
+TEST(GraphAlgorithmsTest, BreadthFirstSearchLevelsCsr_MatchesMatrix) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt");
+  const int size = graph.getOrder();
+  graph_levels_result_t* matrix = levels_result_create(size);
+  graph_levels_result_t* csr = levels_result_create(size);
+  ASSERT_NE(matrix, nullptr);
+  ASSERT_NE(csr, nullptr);
+  for (int start = 0; start < size; start++) {
+    for (int target = -1; target < size; target++) {
+      const traversal_limits_t limits = {target, 0};
+      breadth_first_search_levels(graph.getGraph(), start, &limits, matrix);
+      breadth_first_search_levels_csr(graph.getCsrGraph(), start, &limits,
+                                      csr);
+      ASSERT_EQ(csr->reached, matrix->reached);
+      for (int v = 0; v < size; v++) {
+        ASSERT_EQ(csr->levels[v], matrix->levels[v]);
+        ASSERT_EQ(csr->parents[v], matrix->parents[v]);
+      }
+    }
+  }
+  breadth_first_search_levels_csr(graph.getCsrGraph(), size, nullptr, csr);
+  EXPECT_EQ(csr->reached, matrix->reached);
+  levels_result_delete(matrix);
+  levels_result_delete(csr);
+}
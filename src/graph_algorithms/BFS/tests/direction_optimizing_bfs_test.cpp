@@ -0,0 +1,109 @@
+#include <vector>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+/**
+ * @brief undirected preferential attachment graph, degrees follow a power
+ * law and the diameter is small
+ */
+csr_graph_t* PowerLawGraph(int size, int edges_per_vertex, unsigned seed) {
+  std::vector<int> sources, targets, endpoints = {0};
+  unsigned state = seed;
+  for (int v = 1; v < size; v++) {
+    for (int k = 0; k < edges_per_vertex; k++) {
+      state = state * 1103515245u + 12345u;
+      const int u = endpoints[(state >> 8) % endpoints.size()];
+      sources.push_back(v);
+      targets.push_back(u);
+      sources.push_back(u);
+      targets.push_back(v);
+      endpoints.push_back(u);
+      endpoints.push_back(v);
+    }
+  }
+  std::vector<int> weights(sources.size(), 1);
+  return csr_graph_from_edges(size, (int)sources.size(), sources.data(),
+                              targets.data(), weights.data());
+}
+
+bool HasEdge(const csr_graph_t* graph, int u, int v) {
+  for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+    if (graph->targets[e] == v) return true;
+  }
+  return false;
+}
+
+void ExpectBfsTree(const csr_graph_t* graph, int start,
+                   const graph_levels_result_t* result) {
+  const std::vector<int> expected = ReferenceBfsLevels(graph, start);
+  int reached = 0;
+  for (int v = 0; v < graph->size; v++) {
+    ASSERT_EQ(result->levels[v], expected[v]) << "vertex " << v;
+    reached += expected[v] >= 0;
+    const int parent = result->parents[v];
+    if (v == start || expected[v] < 0) {
+      EXPECT_EQ(parent, -1);
+    } else {
+      ASSERT_GE(parent, 0);
+      EXPECT_EQ(result->levels[parent], result->levels[v] - 1);
+      EXPECT_TRUE(HasEdge(graph, parent, v));
+    }
+  }
+  EXPECT_EQ(result->reached, reached);
+}
+
+}  // namespace
+
+TEST(DirectionOptimizingBfsTest, PowerLawGraphLevelsAndParents) {
+  csr_graph_t* graph = PowerLawGraph(3000, 4, 11u);
+  ASSERT_NE(graph, nullptr);
+  graph_levels_result_t* result = levels_result_create(graph->size);
+  ASSERT_NE(result, nullptr);
+  for (int start : {0, 1, 17, 2999}) {
+    breadth_first_search_direction_optimizing(graph, nullptr, start, result);
+    ExpectBfsTree(graph, start, result);
+  }
+  levels_result_delete(result);
+  csr_graph_delete(graph);
+}
+
+TEST(DirectionOptimizingBfsTest, DirectedGraphUsesReverseEdges) {
+  const int kSize = 400;
+  csr_graph_t* graph = RandomCsrGraph(kSize, kSize * 12, 3, 99u);
+  ASSERT_NE(graph, nullptr);
+  csr_graph_t* reverse = csr_graph_transpose(graph);
+  ASSERT_NE(reverse, nullptr);
+  graph_levels_result_t* result = levels_result_create(kSize);
+  ASSERT_NE(result, nullptr);
+  for (int start = 0; start < kSize; start += 37) {
+    breadth_first_search_direction_optimizing(graph, reverse, start, result);
+    ExpectBfsTree(graph, start, result);
+  }
+  levels_result_delete(result);
+  csr_graph_delete(reverse);
+  csr_graph_delete(graph);
+}
+
+TEST(DirectionOptimizingBfsTest, DisconnectedGraph) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt"));
+  csr_graph_t* csr = graph.getCsrGraph();
+  csr_graph_t* reverse = csr_graph_transpose(csr);
+  ASSERT_NE(reverse, nullptr);
+  graph_levels_result_t* result = levels_result_create(csr->size);
+  ASSERT_NE(result, nullptr);
+  for (int start = 0; start < csr->size; start++) {
+    breadth_first_search_direction_optimizing(csr, reverse, start, result);
+    ExpectBfsTree(csr, start, result);
+  }
+
+  result->reached = 42;
+  breadth_first_search_direction_optimizing(csr, reverse, csr->size, result);
+  EXPECT_EQ(result->reached, 42);
+  levels_result_delete(result);
+  csr_graph_delete(reverse);
+}
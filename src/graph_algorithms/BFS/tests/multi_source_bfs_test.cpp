@@ -0,0 +1,50 @@
+#include <vector>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+TEST(MultiSourceBfsTest, MatchesSingleSourceAcrossBatches) {
+  const int kSize = 600;
+  csr_graph_t* graph = RandomCsrGraph(kSize, kSize * 3, 1, 21u);
+  ASSERT_NE(graph, nullptr);
+
+  // 150 sources: two full batches and a partial one, with duplicates
+  std::vector<int> starts;
+  for (int i = 0; i < 150; i++) starts.push_back((i * 37) % kSize);
+  starts.push_back(starts[3]);
+  std::vector<int> distances(starts.size() * kSize, 7);
+  ASSERT_TRUE(multi_source_breadth_first_search(
+      graph, starts.data(), (int)starts.size(), distances.data()));
+  for (size_t i = 0; i < starts.size(); i++) {
+    const std::vector<int> expected = ReferenceBfsLevels(graph, starts[i]);
+    ASSERT_EQ(std::vector<int>(distances.begin() + i * kSize,
+                               distances.begin() + (i + 1) * kSize),
+              expected)
+        << "source " << starts[i];
+  }
+  csr_graph_delete(graph);
+}
+
+TEST(MultiSourceBfsTest, DisconnectedGraphAndInvalidInput) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt"));
+  csr_graph_t* csr = graph.getCsrGraph();
+  std::vector<int> starts;
+  for (int v = 0; v < csr->size; v++) starts.push_back(v);
+  std::vector<int> distances(starts.size() * csr->size);
+  ASSERT_TRUE(multi_source_breadth_first_search(
+      csr, starts.data(), (int)starts.size(), distances.data()));
+  for (int v = 0; v < csr->size; v++) {
+    const std::vector<int> expected = ReferenceBfsLevels(csr, v);
+    EXPECT_EQ(std::vector<int>(distances.begin() + v * csr->size,
+                               distances.begin() + (v + 1) * csr->size),
+              expected);
+  }
+
+  const int invalid[] = {0, csr->size};
+  EXPECT_FALSE(multi_source_breadth_first_search(csr, invalid, 2,
+                                                 distances.data()));
+  EXPECT_TRUE(multi_source_breadth_first_search(csr, nullptr, 0,
+                                                distances.data()));
+}
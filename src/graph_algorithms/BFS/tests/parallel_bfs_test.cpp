@@ -0,0 +1,95 @@
+#include <vector>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+/**
+ * @brief checks levels against a sequential BFS and that the order lists
+ * every reached vertex once, by non-decreasing level, after its parent
+ */
+void ExpectValidBfs(const csr_graph_t* graph, int start,
+                    const graph_traversal_result_t* order,
+                    const graph_levels_result_t* result) {
+  const std::vector<int> expected = ReferenceBfsLevels(graph, start);
+  int reached = 0;
+  for (int v = 0; v < graph->size; v++) {
+    ASSERT_EQ(result->levels[v], expected[v]) << "vertex " << v;
+    reached += expected[v] >= 0;
+  }
+  ASSERT_EQ(order->size, reached);
+  EXPECT_EQ(result->reached, reached);
+  ASSERT_EQ(order->visited_vertices[0], start);
+  std::vector<int> position(graph->size, -1);
+  for (int i = 0; i < order->size; i++) {
+    const int v = order->visited_vertices[i];
+    ASSERT_EQ(position[v], -1) << "vertex " << v << " listed twice";
+    position[v] = i;
+    if (i > 0) {
+      const int previous = order->visited_vertices[i - 1];
+      ASSERT_LE(expected[previous], expected[v]);
+      ASSERT_GE(result->parents[v], 0);
+      ASSERT_LT(position[result->parents[v]], i);
+      ASSERT_EQ(expected[result->parents[v]], expected[v] - 1);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ParallelBfsTest, MatchesSequentialLevels) {
+  csr_graph_t* graph = RandomCsrGraph(5000, 40000, 1, 3u);
+  ASSERT_NE(graph, nullptr);
+  thread_pool_t* pool = thread_pool_create(4);
+  ASSERT_NE(pool, nullptr);
+  graph_traversal_result_t* order = traversal_result_create(graph->size);
+  graph_levels_result_t* levels = levels_result_create(graph->size);
+  ASSERT_NE(order, nullptr);
+  ASSERT_NE(levels, nullptr);
+  for (int start : {0, 1, 2500, 4999}) {
+    breadth_first_search_parallel(graph, start, pool, order, levels);
+    ExpectValidBfs(graph, start, order, levels);
+  }
+  traversal_result_delete(order);
+  levels_result_delete(levels);
+  thread_pool_delete(pool);
+  csr_graph_delete(graph);
+}
+
+TEST(ParallelBfsTest, WithoutPoolMatchesSequentialOrder) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/graph_examples.txt"));
+  GraphAlgorithmsWrapper algorithms;
+  csr_graph_t* csr = graph.getCsrGraph();
+  graph_traversal_result_t* order = traversal_result_create(csr->size);
+  ASSERT_NE(order, nullptr);
+  for (int start = 0; start < csr->size; start++) {
+    // one thread takes the frontier in order, like the sequential queue
+    breadth_first_search_parallel(csr, start, nullptr, order, nullptr);
+    EXPECT_EQ(std::vector<int>(order->visited_vertices,
+                               order->visited_vertices + order->size),
+              algorithms.breadthFirstSearchCsr(graph, start));
+  }
+  traversal_result_delete(order);
+}
+
+TEST(ParallelBfsTest, SparseGraphWithUnreachedVertices) {
+  csr_graph_t* graph = RandomCsrGraph(3000, 2500, 1, 8u);
+  ASSERT_NE(graph, nullptr);
+  thread_pool_t* pool = thread_pool_create(3);
+  ASSERT_NE(pool, nullptr);
+  graph_traversal_result_t* order = traversal_result_create(graph->size);
+  graph_levels_result_t* levels = levels_result_create(graph->size);
+  ASSERT_NE(order, nullptr);
+  ASSERT_NE(levels, nullptr);
+  for (int start = 0; start < graph->size; start += 301) {
+    breadth_first_search_parallel(graph, start, pool, order, levels);
+    ExpectValidBfs(graph, start, order, levels);
+  }
+  traversal_result_delete(order);
+  levels_result_delete(levels);
+  thread_pool_delete(pool);
+  csr_graph_delete(graph);
+}
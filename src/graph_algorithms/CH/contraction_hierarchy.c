@@ -0,0 +1,708 @@
+#include "contraction_hierarchy.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../graph/binary/graph_binary.h"
+#include "../data_structures/indexed_heap/indexed_heap.h"
+
+_Static_assert(sizeof(contraction_hierarchy_header_t) == 64,
+               "contraction hierarchy header must not contain padding");
+
+#define CONTRACTION_HIERARCHY_SECTIONS 7
+
+/**
+ * @brief weight of the edge difference against the contracted neighbors
+ * and the level in the contraction priority
+ */
+#define EDGE_DIFFERENCE_WEIGHT 4
+
+/**
+ * @brief neighbors with more in x out arc pairs keep their queue key after
+ * a contraction, re-estimating them costs more than the better order gains
+ */
+#define NEIGHBOR_UPDATE_LIMIT 16
+
+/**
+ * @brief edge between two vertices that are not contracted yet
+ */
+typedef struct {
+  int vertex;
+  int weight;
+} arc_t;
+
+typedef struct {
+  arc_t *arcs;
+  int count;
+  int capacity;
+} arc_list_t;
+
+typedef struct {
+  int *sources;
+  int *targets;
+  int *weights;
+  int count;
+  int capacity;
+} edge_list_t;
+
+/**
+ * @brief state of the preprocessing
+ * @param out arcs leaving every vertex that is not contracted yet
+ * @param in arcs entering every vertex that is not contracted yet
+ * @param contracted_neighbors neighbors of every vertex contracted so far,
+ * spreads the contraction evenly over the graph
+ * @param level one more than the highest level of a contracted neighbor,
+ * bounds the depth of the hierarchy
+ * @param queue vertices left, keyed by priority
+ * @param witness_heap queue of the witness searches
+ * @param witness_dist distances of the witness search, valid where
+ * witness_stamp equals generation
+ * @param target_stamp marks the vertices the witness search looks for
+ * @param upward edges recorded for the upward graph
+ * @param downward edges recorded (reversed) for the downward graph
+ * @param shortcuts shortcuts found for the vertex being contracted
+ */
+typedef struct {
+  int size;
+  arc_list_t *out;
+  arc_list_t *in;
+  int *contracted_neighbors;
+  int *level;
+  indexed_heap_t *queue;
+  indexed_heap_t *witness_heap;
+  int *witness_dist;
+  unsigned *witness_stamp;
+  unsigned *target_stamp;
+  unsigned generation;
+  edge_list_t upward;
+  edge_list_t downward;
+  edge_list_t shortcuts;
+  int shortcut_count;
+} contraction_t;
+
+/**
+ * @brief one direction of the query
+ * @param dist distances, valid where stamp equals the query generation
+ */
+typedef struct {
+  const csr_graph_t *graph;
+  indexed_heap_t *heap;
+  int *dist;
+  unsigned *stamp;
+} upward_search_t;
+
+struct contraction_query {
+  upward_search_t forward;
+  upward_search_t backward;
+  unsigned generation;
+};
+
+static bool arc_list_append(arc_list_t *list, int vertex, int weight) {
+  if (list->count == list->capacity) {
+    const int capacity = list->capacity ? list->capacity * 2 : 4;
+    arc_t *arcs =
+        (arc_t *)realloc(list->arcs, (size_t)capacity * sizeof(arc_t));
+    if (!arcs) return false;
+    list->arcs = arcs;
+    list->capacity = capacity;
+  }
+  list->arcs[list->count++] = (arc_t){vertex, weight};
+  return true;
+}
+
+/**
+ * @brief adds the arc or lowers the weight of the one already there
+ */
+static bool arc_list_set(arc_list_t *list, int vertex, int weight) {
+  for (int i = 0; i < list->count; i++) {
+    if (list->arcs[i].vertex == vertex) {
+      if (weight < list->arcs[i].weight) list->arcs[i].weight = weight;
+      return true;
+    }
+  }
+  return arc_list_append(list, vertex, weight);
+}
+
+static void arc_list_remove(arc_list_t *list, int vertex) {
+  for (int i = 0; i < list->count; i++) {
+    if (list->arcs[i].vertex == vertex) {
+      list->arcs[i] = list->arcs[--list->count];
+      return;
+    }
+  }
+}
+
+static bool edge_list_push(edge_list_t *list, int source, int target,
+                           int weight) {
+  if (list->count == list->capacity) {
+    const int capacity = list->capacity ? list->capacity * 2 : 1024;
+    int *sources =
+        (int *)realloc(list->sources, (size_t)capacity * sizeof(int));
+    if (sources) list->sources = sources;
+    int *targets =
+        (int *)realloc(list->targets, (size_t)capacity * sizeof(int));
+    if (targets) list->targets = targets;
+    int *weights =
+        (int *)realloc(list->weights, (size_t)capacity * sizeof(int));
+    if (weights) list->weights = weights;
+    if (!sources || !targets || !weights) return false;
+    list->capacity = capacity;
+  }
+  list->sources[list->count] = source;
+  list->targets[list->count] = target;
+  list->weights[list->count++] = weight;
+  return true;
+}
+
+static void edge_list_free(edge_list_t *list) {
+  free(list->sources);
+  free(list->targets);
+  free(list->weights);
+}
+
+/**
+ * @brief starts a witness search, stamps of earlier searches become stale
+ */
+static void next_generation(contraction_t *c) {
+  if (++c->generation == 0) {
+    memset(c->witness_stamp, 0, (size_t)c->size * sizeof(unsigned));
+    memset(c->target_stamp, 0, (size_t)c->size * sizeof(unsigned));
+    c->generation = 1;
+  }
+}
+
+/**
+ * @brief local Dijkstra from source that avoids skipped, it stops once the
+ * targets (the out-neighbors of skipped) are settled, past max_dist or
+ * after limit settled vertices. Every reached vertex gets the length of a
+ * real path, maybe not the shortest one, which is all a witness needs.
+ * @param targets number of out-neighbors of skipped other than source
+ * @param limit largest number of settled vertices
+ */
+static void witness_search(contraction_t *c, int source, int skipped,
+                           int max_dist, int targets, int limit) {
+  indexed_heap_t *heap = c->witness_heap;
+  indexed_heap_clear(heap);
+  c->witness_stamp[source] = c->generation;
+  c->witness_dist[source] = 0;
+  indexed_heap_push(heap, source, 0);
+  int settled = 0;
+  while (targets > 0 && !indexed_heap_is_empty(heap) &&
+         indexed_heap_min_key(heap) <= max_dist &&
+         settled < limit) {
+    const int u = indexed_heap_pop(heap);
+    settled++;
+    if (c->target_stamp[u] == c->generation) targets--;
+    const arc_list_t *out = &c->out[u];
+    for (int i = 0; i < out->count; i++) {
+      const int v = out->arcs[i].vertex;
+      if (v == skipped) continue;
+      const int new_dist = c->witness_dist[u] + out->arcs[i].weight;
+      if (c->witness_stamp[v] != c->generation) {
+        c->witness_stamp[v] = c->generation;
+        c->witness_dist[v] = new_dist;
+        indexed_heap_push(heap, v, new_dist);
+      } else if (new_dist < c->witness_dist[v] &&
+                 indexed_heap_contains(heap, v)) {
+        c->witness_dist[v] = new_dist;
+        indexed_heap_decrease(heap, v, new_dist);
+      }
+    }
+  }
+}
+
+static int witness_distance(const contraction_t *c, int vertex) {
+  return c->witness_stamp[vertex] == c->generation ? c->witness_dist[vertex]
+                                                   : INT_MAX;
+}
+
+/**
+ * @brief finds the shortcuts u -> w that contracting v needs: one for every
+ * path u -> v -> w that no witness path avoiding v matches
+ * @param add insert the shortcuts into the remaining graph
+ * @return number of shortcuts, -1 if memory allocation failed
+ */
+static int find_shortcuts(contraction_t *c, int v, bool add) {
+  const arc_list_t *in = &c->in[v];
+  const arc_list_t *out = &c->out[v];
+  c->shortcuts.count = 0;
+  for (int i = 0; i < in->count; i++) {
+    const int u = in->arcs[i].vertex;
+    const int weight_in = in->arcs[i].weight;
+    int max_dist = 0, targets = 0;
+    next_generation(c);
+    for (int j = 0; j < out->count; j++) {
+      const int via = weight_in + out->arcs[j].weight;
+      if (out->arcs[j].vertex == u) continue;
+      c->target_stamp[out->arcs[j].vertex] = c->generation;
+      if (via > max_dist) max_dist = via;
+      targets++;
+    }
+    witness_search(c, u, v, max_dist, targets,
+                   add ? CONTRACTION_HIERARCHY_WITNESS_LIMIT
+                       : CONTRACTION_HIERARCHY_ESTIMATE_LIMIT);
+    for (int j = 0; j < out->count; j++) {
+      const int w = out->arcs[j].vertex;
+      const int via = weight_in + out->arcs[j].weight;
+      if (w != u && witness_distance(c, w) > via &&
+          !edge_list_push(&c->shortcuts, u, w, via)) {
+        return -1;
+      }
+    }
+  }
+  const edge_list_t *found = &c->shortcuts;
+  for (int s = 0; add && s < found->count; s++) {
+    if (!arc_list_set(&c->out[found->sources[s]], found->targets[s],
+                      found->weights[s]) ||
+        !arc_list_set(&c->in[found->targets[s]], found->sources[s],
+                      found->weights[s])) {
+      return -1;
+    }
+  }
+  return found->count;
+}
+
+/**
+ * @brief contraction priority: edge difference (shortcuts added minus arcs
+ * removed) plus the contracted neighbors and the level, lower is contracted
+ * first. The shortcuts are only estimated, with witness searches bounded by
+ * CONTRACTION_HIERARCHY_ESTIMATE_LIMIT.
+ * @return false if memory allocation failed
+ */
+static bool vertex_priority(contraction_t *c, int v, int *priority) {
+  const int shortcuts = find_shortcuts(c, v, false);
+  *priority = EDGE_DIFFERENCE_WEIGHT *
+                  (shortcuts - c->in[v].count - c->out[v].count) +
+              c->contracted_neighbors[v] + c->level[v];
+  return shortcuts >= 0;
+}
+
+/**
+ * @brief accounts a contracted neighbor and lowers the queue key of a small
+ * vertex if its priority dropped, rises and large vertices are caught
+ * lazily when the vertex is popped
+ * @param level level of the contracted neighbor plus one
+ */
+static bool update_neighbor(contraction_t *c, int vertex, int level) {
+  c->contracted_neighbors[vertex]++;
+  if (c->level[vertex] < level) c->level[vertex] = level;
+  if (c->in[vertex].count * c->out[vertex].count > NEIGHBOR_UPDATE_LIMIT) {
+    return true;
+  }
+  int priority;
+  if (!vertex_priority(c, vertex, &priority)) return false;
+  if (priority < c->queue->key[vertex]) {
+    indexed_heap_decrease(c->queue, vertex, priority);
+  }
+  return true;
+}
+
+/**
+ * @brief contracts v: adds its shortcuts, records its remaining arcs (all to
+ * higher ranked vertices) and removes it from the graph
+ * @return false if memory allocation failed
+ */
+static bool contract_vertex(contraction_t *c, int v) {
+  if (find_shortcuts(c, v, true) < 0) return false;
+  c->shortcut_count += c->shortcuts.count;
+  arc_list_t *out = &c->out[v];
+  arc_list_t *in = &c->in[v];
+  bool success = true;
+  for (int i = 0; success && i < out->count; i++) {
+    success = edge_list_push(&c->upward, v, out->arcs[i].vertex,
+                             out->arcs[i].weight);
+    arc_list_remove(&c->in[out->arcs[i].vertex], v);
+  }
+  for (int i = 0; success && i < in->count; i++) {
+    success = edge_list_push(&c->downward, v, in->arcs[i].vertex,
+                             in->arcs[i].weight);
+    arc_list_remove(&c->out[in->arcs[i].vertex], v);
+  }
+  for (int i = 0; success && i < out->count; i++) {
+    success = update_neighbor(c, out->arcs[i].vertex, c->level[v] + 1);
+  }
+  for (int i = 0; success && i < in->count; i++) {
+    success = update_neighbor(c, in->arcs[i].vertex, c->level[v] + 1);
+  }
+  free(out->arcs);
+  free(in->arcs);
+  *out = *in = (arc_list_t){NULL, 0, 0};
+  return success;
+}
+
+/**
+ * @brief contracts every vertex, always the one of lowest priority
+ * @param rank receives the contraction order
+ * @return false if memory allocation failed
+ */
+static bool contract_graph(contraction_t *c, int *rank) {
+  for (int v = 0; v < c->size; v++) {
+    int priority;
+    if (!vertex_priority(c, v, &priority)) return false;
+    indexed_heap_push(c->queue, v, priority);
+  }
+  int next_rank = 0;
+  while (!indexed_heap_is_empty(c->queue)) {
+    const int v = indexed_heap_pop(c->queue);
+    int priority;
+    if (!vertex_priority(c, v, &priority)) return false;
+    if (!indexed_heap_is_empty(c->queue) &&
+        priority > indexed_heap_min_key(c->queue)) {
+      indexed_heap_push(c->queue, v, priority);
+      continue;
+    }
+    rank[v] = next_rank++;
+    if (!contract_vertex(c, v)) return false;
+  }
+  return true;
+}
+
+static bool contraction_init(contraction_t *c, const csr_graph_t *graph) {
+  memset(c, 0, sizeof(*c));
+  c->size = graph->size;
+  c->out = (arc_list_t *)calloc((size_t)graph->size, sizeof(arc_list_t));
+  c->in = (arc_list_t *)calloc((size_t)graph->size, sizeof(arc_list_t));
+  c->contracted_neighbors = (int *)calloc((size_t)graph->size, sizeof(int));
+  c->level = (int *)calloc((size_t)graph->size, sizeof(int));
+  c->queue = indexed_heap_create(graph->size);
+  c->witness_heap = indexed_heap_create(graph->size);
+  c->witness_dist = (int *)malloc((size_t)graph->size * sizeof(int));
+  c->witness_stamp = (unsigned *)calloc((size_t)graph->size, sizeof(unsigned));
+  c->target_stamp = (unsigned *)calloc((size_t)graph->size, sizeof(unsigned));
+  bool success = c->out && c->in && c->contracted_neighbors && c->level &&
+                 c->queue &&
+                 c->witness_heap && c->witness_dist && c->witness_stamp &&
+                 c->target_stamp;
+  for (int u = 0; success && u < graph->size; u++) {
+    for (int e = graph->offsets[u]; success && e < graph->offsets[u + 1];
+         e++) {
+      const int v = graph->targets[e];
+      if (graph->weights[e] <= 0 || v == u) continue;
+      success = arc_list_append(&c->out[u], v, graph->weights[e]) &&
+                arc_list_append(&c->in[v], u, graph->weights[e]);
+    }
+  }
+  return success;
+}
+
+static void contraction_free(contraction_t *c) {
+  for (int v = 0; v < c->size; v++) {
+    if (c->out) free(c->out[v].arcs);
+    if (c->in) free(c->in[v].arcs);
+  }
+  free(c->out);
+  free(c->in);
+  free(c->contracted_neighbors);
+  free(c->level);
+  indexed_heap_delete(c->queue);
+  indexed_heap_delete(c->witness_heap);
+  free(c->witness_dist);
+  free(c->witness_stamp);
+  free(c->target_stamp);
+  edge_list_free(&c->upward);
+  edge_list_free(&c->downward);
+  edge_list_free(&c->shortcuts);
+}
+
+static bool upward_search_init(upward_search_t *side, int size) {
+  side->heap = indexed_heap_create(size);
+  side->dist = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  side->stamp = (unsigned *)calloc((size_t)size + 1, sizeof(unsigned));
+  return side->heap && side->dist && side->stamp;
+}
+
+static void upward_search_free(upward_search_t *side) {
+  indexed_heap_delete(side->heap);
+  free(side->dist);
+  free(side->stamp);
+}
+
+/**
+ * @brief allocates a hierarchy with its rank array and query scratch, the
+ * graphs are set by the caller
+ */
+static contraction_hierarchy_t *hierarchy_alloc(int size) {
+  contraction_hierarchy_t *hierarchy =
+      (contraction_hierarchy_t *)calloc(1, sizeof(contraction_hierarchy_t));
+  if (!hierarchy) return NULL;
+  hierarchy->size = size;
+  hierarchy->rank = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  hierarchy->query =
+      (contraction_query_t *)calloc(1, sizeof(contraction_query_t));
+  if (!hierarchy->rank || !hierarchy->query ||
+      !upward_search_init(&hierarchy->query->forward, size) ||
+      !upward_search_init(&hierarchy->query->backward, size)) {
+    contraction_hierarchy_delete(hierarchy);
+    hierarchy = NULL;
+  }
+  return hierarchy;
+}
+
+/**
+ * @brief builds the contraction hierarchy of a graph, only with positive
+ * edges (0 means no edge).
+ *
+ * Vertices are taken from a queue ordered by edge difference, contracted
+ * neighbors and level, with the priority of a popped vertex recomputed
+ * before it is contracted. Witness searches are local Dijkstras bounded by
+ * CONTRACTION_HIERARCHY_WITNESS_LIMIT settled vertices; when one gives up
+ * the shortcut is kept, which costs space but never correctness.
+ * @param graph csr graph pointer
+ * @return hierarchy or NULL if error
+ */
+contraction_hierarchy_t *contraction_hierarchy_create(
+    const csr_graph_t *graph) {
+  if (!graph) return NULL;
+  contraction_hierarchy_t *hierarchy = hierarchy_alloc(graph->size);
+  contraction_t c;
+  bool success = hierarchy && contraction_init(&c, graph) &&
+                 contract_graph(&c, hierarchy->rank);
+  if (success) {
+    hierarchy->shortcut_count = c.shortcut_count;
+    hierarchy->upward =
+        csr_graph_from_edges(graph->size, c.upward.count, c.upward.sources,
+                             c.upward.targets, c.upward.weights);
+    hierarchy->downward = csr_graph_from_edges(
+        graph->size, c.downward.count, c.downward.sources,
+        c.downward.targets, c.downward.weights);
+    success = hierarchy->upward && hierarchy->downward;
+  }
+  if (hierarchy) contraction_free(&c);
+  if (!success) {
+    contraction_hierarchy_delete(hierarchy);
+    hierarchy = NULL;
+  }
+  return hierarchy;
+}
+
+/**
+ * @brief delete contraction hierarchy
+ * @param hierarchy hierarchy pointer
+ */
+void contraction_hierarchy_delete(contraction_hierarchy_t *hierarchy) {
+  if (hierarchy) {
+    if (hierarchy->query) {
+      upward_search_free(&hierarchy->query->forward);
+      upward_search_free(&hierarchy->query->backward);
+      free(hierarchy->query);
+    }
+    csr_graph_delete(hierarchy->upward);
+    csr_graph_delete(hierarchy->downward);
+    free(hierarchy->rank);
+    free(hierarchy);
+  }
+}
+
+static bool upward_reached(const upward_search_t *side, unsigned generation,
+                           int vertex) {
+  return side->stamp[vertex] == generation;
+}
+
+static void upward_reach(upward_search_t *side, unsigned generation,
+                         int vertex, int dist) {
+  side->stamp[vertex] = generation;
+  side->dist[vertex] = dist;
+  indexed_heap_push(side->heap, vertex, dist);
+}
+
+/**
+ * @brief settles the nearest vertex of one side and relaxes its upward
+ * edges, every relaxed vertex already reached by the other side is a
+ * candidate meeting point
+ */
+static void settle_upward(upward_search_t *side, const upward_search_t *other,
+                          unsigned generation, long long *best) {
+  const int u = indexed_heap_pop(side->heap);
+  const csr_graph_t *graph = side->graph;
+  for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+    const int v = graph->targets[e];
+    const int new_dist = side->dist[u] + graph->weights[e];
+    if (!upward_reached(side, generation, v)) {
+      upward_reach(side, generation, v, new_dist);
+    } else if (new_dist < side->dist[v] &&
+               indexed_heap_contains(side->heap, v)) {
+      side->dist[v] = new_dist;
+      indexed_heap_decrease(side->heap, v, new_dist);
+    } else {
+      continue;
+    }
+    if (upward_reached(other, generation, v) &&
+        (long long)new_dist + other->dist[v] < *best) {
+      *best = (long long)new_dist + other->dist[v];
+    }
+  }
+}
+
+/**
+ * @brief shortest path length over a contraction hierarchy, the same value
+ * get_shortest_path_between_vertices returns for the original graph.
+ *
+ * Runs a forward search from vertex1 over the upward graph and a backward
+ * search from vertex2 over the downward graph, always extending the side
+ * with the smaller queued distance. A side stops once its smallest queued
+ * distance reaches the best candidate, both searches only climb in rank so
+ * they settle a small fraction of the graph.
+ * @param hierarchy hierarchy pointer, its query buffers are reused
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_contraction_hierarchy(
+    contraction_hierarchy_t *hierarchy, int vertex1, int vertex2) {
+  if (!hierarchy || vertex1 < 0 || vertex1 >= hierarchy->size ||
+      vertex2 < 0 || vertex2 >= hierarchy->size) {
+    return -1;
+  }
+  if (vertex1 == vertex2) return 0;
+  contraction_query_t *query = hierarchy->query;
+  upward_search_t *forward = &query->forward;
+  upward_search_t *backward = &query->backward;
+  if (++query->generation == 0) {
+    memset(forward->stamp, 0, (size_t)hierarchy->size * sizeof(unsigned));
+    memset(backward->stamp, 0, (size_t)hierarchy->size * sizeof(unsigned));
+    query->generation = 1;
+  }
+  forward->graph = hierarchy->upward;
+  backward->graph = hierarchy->downward;
+  indexed_heap_clear(forward->heap);
+  indexed_heap_clear(backward->heap);
+  upward_reach(forward, query->generation, vertex1, 0);
+  upward_reach(backward, query->generation, vertex2, 0);
+  long long best = INT_MAX;
+  for (;;) {
+    const bool forward_open = !indexed_heap_is_empty(forward->heap) &&
+                              indexed_heap_min_key(forward->heap) < best;
+    const bool backward_open = !indexed_heap_is_empty(backward->heap) &&
+                               indexed_heap_min_key(backward->heap) < best;
+    if (forward_open &&
+        (!backward_open || indexed_heap_min_key(forward->heap) <=
+                               indexed_heap_min_key(backward->heap))) {
+      settle_upward(forward, backward, query->generation, &best);
+    } else if (backward_open) {
+      settle_upward(backward, forward, query->generation, &best);
+    } else {
+      break;
+    }
+  }
+  return best < INT_MAX ? (int)best : -1;
+}
+
+static void hierarchy_sections(const contraction_hierarchy_t *hierarchy,
+                               graph_binary_section_t *sections) {
+  const csr_graph_t *graphs[2] = {hierarchy->upward, hierarchy->downward};
+  sections[0] =
+      (graph_binary_section_t){hierarchy->rank, (size_t)hierarchy->size};
+  for (int g = 0; g < 2; g++) {
+    const size_t edges = (size_t)graphs[g]->edge_count;
+    sections[1 + 3 * g] = (graph_binary_section_t){
+        graphs[g]->offsets, (size_t)hierarchy->size + 1};
+    sections[2 + 3 * g] = (graph_binary_section_t){graphs[g]->targets, edges};
+    sections[3 + 3 * g] = (graph_binary_section_t){graphs[g]->weights, edges};
+  }
+}
+
+/**
+ * @brief save contraction hierarchy, meant to be kept next to the graph
+ * file it was built from
+ * @param hierarchy hierarchy pointer
+ * @param filename Name of file
+ * @return true if success false if error
+ */
+bool save_contraction_hierarchy_to_file(
+    const contraction_hierarchy_t *hierarchy, const char *filename) {
+  if (!hierarchy || !filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return false;
+  }
+  graph_binary_section_t sections[CONTRACTION_HIERARCHY_SECTIONS];
+  hierarchy_sections(hierarchy, sections);
+  contraction_hierarchy_header_t header;
+  memset(&header, 0, sizeof(header));
+  graph_binary_section_prefix_init(&header.prefix, CONTRACTION_HIERARCHY_MAGIC,
+                                   CONTRACTION_HIERARCHY_VERSION);
+  header.vertex_count = hierarchy->size;
+  header.upward_edge_count = hierarchy->upward->edge_count;
+  header.downward_edge_count = hierarchy->downward->edge_count;
+  header.shortcut_count = hierarchy->shortcut_count;
+  header.checksum =
+      graph_binary_sections_checksum(sections, CONTRACTION_HIERARCHY_SECTIONS);
+  return graph_binary_write_sections(filename, &header, sizeof(header),
+                                     sections, CONTRACTION_HIERARCHY_SECTIONS);
+}
+
+static bool validate_hierarchy_header(
+    const contraction_hierarchy_header_t *header) {
+  return header->vertex_count >= 0 && header->vertex_count < INT_MAX &&
+         header->upward_edge_count >= 0 &&
+         header->upward_edge_count < INT_MAX &&
+         header->downward_edge_count >= 0 &&
+         header->downward_edge_count < INT_MAX;
+}
+
+/**
+ * @brief checks that the rows and targets of a loaded graph stay in range,
+ * so a damaged file can not make a query read out of bounds
+ */
+static bool validate_loaded_graph(csr_graph_t *graph) {
+  bool valid = graph->offsets[0] == 0 &&
+               graph->offsets[graph->size] == graph->edge_count;
+  for (int v = 0; valid && v < graph->size; v++) {
+    valid = graph->offsets[v] <= graph->offsets[v + 1];
+  }
+  for (int e = 0; valid && e < graph->edge_count; e++) {
+    valid = graph->targets[e] >= 0 && graph->targets[e] < graph->size &&
+            graph->weights[e] > 0;
+  }
+  if (valid) graph->max_weight = csr_graph_scan_max_weight(graph);
+  return valid;
+}
+
+/**
+ * @brief load contraction hierarchy saved by
+ * save_contraction_hierarchy_to_file, the checksum is always verified
+ * @param filename Name of file
+ * @return hierarchy or NULL if error
+ */
+contraction_hierarchy_t *load_contraction_hierarchy_from_file(
+    const char *filename) {
+  if (!filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return NULL;
+  }
+  FILE *file = fopen(filename, "rb");
+  if (!file) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return NULL;
+  }
+  contraction_hierarchy_header_t header;
+  contraction_hierarchy_t *hierarchy = NULL;
+  bool success = graph_binary_read_section_header(
+                     file, CONTRACTION_HIERARCHY_MAGIC,
+                     CONTRACTION_HIERARCHY_VERSION, &header, sizeof(header)) &&
+                 validate_hierarchy_header(&header);
+  if (success) {
+    hierarchy = hierarchy_alloc((int)header.vertex_count);
+    if (hierarchy) {
+      hierarchy->shortcut_count = (int)header.shortcut_count;
+      hierarchy->upward = csr_graph_create(hierarchy->size,
+                                           (int)header.upward_edge_count);
+      hierarchy->downward = csr_graph_create(
+          hierarchy->size, (int)header.downward_edge_count);
+    }
+    success = hierarchy && hierarchy->upward && hierarchy->downward;
+  }
+  graph_binary_section_t sections[CONTRACTION_HIERARCHY_SECTIONS];
+  if (success) hierarchy_sections(hierarchy, sections);
+  success = success && graph_binary_read_sections(
+                           file, sections, CONTRACTION_HIERARCHY_SECTIONS,
+                           header.checksum);
+  fclose(file);
+  success = success && validate_loaded_graph(hierarchy->upward) &&
+            validate_loaded_graph(hierarchy->downward);
+  if (!success) {
+    fprintf(stderr, "Invalid contraction hierarchy file\n");
+    contraction_hierarchy_delete(hierarchy);
+    hierarchy = NULL;
+  }
+  return hierarchy;
+}
@@ -0,0 +1,99 @@
+#ifndef S21_CONTRACTION_HIERARCHY_H
+#define S21_CONTRACTION_HIERARCHY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../../graph/binary/graph_binary.h"
+#include "../../graph/s21_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Contraction hierarchy file:
+ * [header][rank][upward offsets, targets, weights]
+ * [downward offsets, targets, weights]
+ * All sections are native ints, the checksum covers every section.
+ */
+#define CONTRACTION_HIERARCHY_MAGIC "S21CHIER"
+#define CONTRACTION_HIERARCHY_VERSION 1u
+
+/**
+ * @brief largest number of vertices a witness search settles before it
+ * gives up and the shortcut is added anyway
+ */
+#define CONTRACTION_HIERARCHY_WITNESS_LIMIT 256
+
+/**
+ * @brief witness search limit while only the shortcuts of a vertex are
+ * counted for its priority, an estimate is enough there
+ */
+#define CONTRACTION_HIERARCHY_ESTIMATE_LIMIT 16
+
+/**
+ * @brief header of the contraction hierarchy file
+ * @param prefix magic CONTRACTION_HIERARCHY_MAGIC, version
+ * CONTRACTION_HIERARCHY_VERSION
+ * @param vertex_count number of vertices
+ * @param upward_edge_count edges of the upward graph
+ * @param downward_edge_count edges of the downward graph
+ * @param shortcut_count shortcuts added by the contraction
+ * @param checksum graph_binary_sections_checksum of the sections
+ */
+typedef struct {
+  graph_binary_section_prefix_t prefix;
+  int64_t vertex_count;
+  int64_t upward_edge_count;
+  int64_t downward_edge_count;
+  int64_t shortcut_count;
+  uint64_t checksum;
+} contraction_hierarchy_header_t;
+
+/**
+ * @brief scratch buffers of the queries, private to contraction_hierarchy.c
+ */
+typedef struct contraction_query contraction_query_t;
+
+/**
+ * @brief contraction hierarchy of a weighted graph.
+ *
+ * Vertices are contracted one by one in rank order; contracting a vertex
+ * adds a shortcut u -> w for every path u -> v -> w that no witness path
+ * avoiding v beats. Every edge and shortcut then points from its lower to
+ * its higher ranked end in exactly one of the two graphs below, so a query
+ * only searches upwards from both ends.
+ * @param size number of vertices
+ * @param rank contraction order of every vertex, 0 is contracted first
+ * @param upward edges u -> w with rank[u] < rank[w], forward search
+ * @param downward edges u -> w with rank[u] > rank[w] stored as w -> u,
+ * backward search
+ * @param shortcut_count number of shortcuts among the edges
+ * @param query scratch reused by every query, so one hierarchy answers one
+ * query at a time
+ */
+typedef struct {
+  int size;
+  int *rank;
+  csr_graph_t *upward;
+  csr_graph_t *downward;
+  int shortcut_count;
+  contraction_query_t *query;
+} contraction_hierarchy_t;
+
+contraction_hierarchy_t *contraction_hierarchy_create(
+    const csr_graph_t *graph);
+void contraction_hierarchy_delete(contraction_hierarchy_t *hierarchy);
+int get_shortest_path_contraction_hierarchy(
+    contraction_hierarchy_t *hierarchy, int vertex1, int vertex2);
+bool save_contraction_hierarchy_to_file(
+    const contraction_hierarchy_t *hierarchy, const char *filename);
+contraction_hierarchy_t *load_contraction_hierarchy_from_file(
+    const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_CONTRACTION_HIERARCHY_H
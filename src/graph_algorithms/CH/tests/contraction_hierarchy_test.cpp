@@ -0,0 +1,86 @@
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+const std::string kHierarchyFile = "../data-samples/weighted_graph.s21ch";
+
+/**
+ * @brief saves a hierarchy damaged by damage, the checksum is computed over
+ * the damaged arrays, so only the row checks of the loader can reject it
+ */
+void ExpectDamagedHierarchyRejected(
+    const std::function<void(contraction_hierarchy_t*)>& damage) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 40, 10, false, 7u);
+  contraction_hierarchy_t* hierarchy =
+      contraction_hierarchy_create(graph.getCsrGraph());
+  ASSERT_NE(hierarchy, nullptr);
+  ASSERT_GT(hierarchy->upward->edge_count, 0);
+  ASSERT_GT(hierarchy->downward->edge_count, 0);
+  damage(hierarchy);
+  ASSERT_TRUE(
+      save_contraction_hierarchy_to_file(hierarchy, kHierarchyFile.c_str()));
+  contraction_hierarchy_delete(hierarchy);
+  EXPECT_EQ(load_contraction_hierarchy_from_file(kHierarchyFile.c_str()),
+            nullptr);
+  std::remove(kHierarchyFile.c_str());
+}
+
+}  // namespace
+
+TEST(ContractionHierarchyTest, UpwardEdgesClimbInRank) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 150, 3, true, 17u);
+  contraction_hierarchy_t* hierarchy =
+      contraction_hierarchy_create(graph.getCsrGraph());
+  ASSERT_NE(hierarchy, nullptr);
+  for (int v = 0; v < graph.getOrder(); v++) {
+    for (int e = hierarchy->upward->offsets[v];
+         e < hierarchy->upward->offsets[v + 1]; e++) {
+      ASSERT_LT(hierarchy->rank[v],
+                hierarchy->rank[hierarchy->upward->targets[e]]);
+    }
+  }
+  contraction_hierarchy_delete(hierarchy);
+}
+
+TEST(ContractionHierarchyTest, FileKeepsShortcuts) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 90, 5, false, 31u);
+  contraction_hierarchy_t* built =
+      contraction_hierarchy_create(graph.getCsrGraph());
+  ASSERT_NE(built, nullptr);
+  ASSERT_TRUE(
+      save_contraction_hierarchy_to_file(built, kHierarchyFile.c_str()));
+  contraction_hierarchy_t* loaded =
+      load_contraction_hierarchy_from_file(kHierarchyFile.c_str());
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->shortcut_count, built->shortcut_count);
+  EXPECT_EQ(loaded->upward->edge_count, built->upward->edge_count);
+  EXPECT_EQ(loaded->downward->edge_count, built->downward->edge_count);
+  contraction_hierarchy_delete(loaded);
+  contraction_hierarchy_delete(built);
+  std::remove(kHierarchyFile.c_str());
+}
+
+TEST(ContractionHierarchyTest, CraftedFileWithValidChecksumIsRejected) {
+  ExpectDamagedHierarchyRejected([](contraction_hierarchy_t* hierarchy) {
+    hierarchy->upward->targets[0] = hierarchy->size;
+  });
+  ExpectDamagedHierarchyRejected([](contraction_hierarchy_t* hierarchy) {
+    hierarchy->downward->targets[0] = -1;
+  });
+  ExpectDamagedHierarchyRejected([](contraction_hierarchy_t* hierarchy) {
+    // row 0 ends after row 1 starts
+    csr_graph_t* upward = hierarchy->upward;
+    upward->offsets[1] = upward->edge_count + 1;
+  });
+  ExpectDamagedHierarchyRejected([](contraction_hierarchy_t* hierarchy) {
+    hierarchy->upward->weights[0] = 0;
+  });
+}
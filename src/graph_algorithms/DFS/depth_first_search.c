@@ -1,4 +1,4 @@
-#include "../data_structures/stack/stack.h"
+#include "../data_structures/array_stack/array_stack.h"
 #include "../s21_graph_algorithms.h"
 
 /**
@@ -16,27 +16,246 @@ void depth_first_search(graph_t* graph, int start_vertex,
       start_vertex >= graph->adjacency->size) {
     return;
   }
-  stack* st = stack_create();
+  array_stack_t* st = array_stack_create(graph->adjacency->size);
   if (!st) return;
   int* visited = (int*)calloc(graph->adjacency->size, sizeof(int));
   if (!visited) {
-    stack_delete(st);
+    array_stack_delete(st);
     return;
   }
-  stack_push(st, start_vertex);
+  array_stack_push(st, start_vertex);
   visited[start_vertex] = 1;
   result->size = 0;
-  while (!stack_is_empty(st)) {
-    int current_vertex = stack_top(st);
-    stack_pop(st);
+  while (!array_stack_is_empty(st)) {
+    int current_vertex = array_stack_top(st);
+    array_stack_pop(st);
     result->visited_vertices[result->size++] = current_vertex;
+    const int* row = matrix_row(graph->adjacency, current_vertex);
     for (int n = graph->adjacency->size - 1; n >= 0; n--) {
-      if (graph->adjacency->data[current_vertex][n] && !visited[n]) {
-        stack_push(st, n);
+      if (row[n] && !visited[n]) {
+        array_stack_push(st, n);
         visited[n] = 1;
       }
     }
   }
-  stack_delete(st);
+  array_stack_delete(st);
   free(visited);
 }
+
+/**
+ * Depth first search over compressed sparse rows, O(V + E)
+ * @brief depth first search, same visiting order as depth_first_search
+ * @param graph csr graph pointer
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @return void
+ */
+void depth_first_search_csr(const csr_graph_t* graph, int start_vertex,
+                            graph_traversal_result_t* result) {
+  if (!graph || !result || graph->size == 0 || start_vertex < 0 ||
+      start_vertex >= graph->size) {
+    return;
+  }
+  array_stack_t* st = array_stack_create(graph->size);
+  if (!st) return;
+  int* visited = (int*)calloc(graph->size, sizeof(int));
+  if (!visited) {
+    array_stack_delete(st);
+    return;
+  }
+  array_stack_push(st, start_vertex);
+  visited[start_vertex] = 1;
+  result->size = 0;
+  while (!array_stack_is_empty(st)) {
+    int current_vertex = array_stack_top(st);
+    array_stack_pop(st);
+    result->visited_vertices[result->size++] = current_vertex;
+    for (int e = graph->offsets[current_vertex + 1] - 1;
+         e >= graph->offsets[current_vertex]; e--) {
+      const int n = graph->targets[e];
+      if (!visited[n]) {
+        array_stack_push(st, n);
+        visited[n] = 1;
+      }
+    }
+  }
+  array_stack_delete(st);
+  free(visited);
+}
+
+/**
+ * Depth first search over a bit matrix
+ * @brief depth first search, same visiting order as depth_first_search.
+ * Unvisited neighbours are found 64 at a time as row & ~visited and pushed
+ * from the highest index down with count-leading-zeros.
+ * @param graph bit matrix pointer
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @return void
+ */
+void depth_first_search_bits(const bit_matrix_t* graph, int start_vertex,
+                             graph_traversal_result_t* result) {
+  if (!graph || !result || graph->size == 0 || start_vertex < 0 ||
+      start_vertex >= graph->size) {
+    return;
+  }
+  uint64_t* visited =
+      (uint64_t*)calloc((size_t)graph->words_per_row, sizeof(uint64_t));
+  // vertices are marked when pushed, so the stack never exceeds size
+  int* stack = (int*)malloc((size_t)graph->size * sizeof(int));
+  if (!visited || !stack) {
+    free(visited);
+    free(stack);
+    return;
+  }
+  int top = 0;
+  stack[top++] = start_vertex;
+  visited[start_vertex / BIT_MATRIX_WORD_BITS] |=
+      (uint64_t)1 << (start_vertex % BIT_MATRIX_WORD_BITS);
+  result->size = 0;
+  while (top > 0) {
+    const int current_vertex = stack[--top];
+    result->visited_vertices[result->size++] = current_vertex;
+    const uint64_t* row = bit_matrix_row(graph, current_vertex);
+    for (int w = graph->words_per_row - 1; w >= 0; w--) {
+      uint64_t fresh = row[w] & ~visited[w];
+      visited[w] |= fresh;
+      while (fresh) {
+        const int bit = bit_scan_reverse(fresh);
+        stack[top++] = w * BIT_MATRIX_WORD_BITS + bit;
+        fresh &= ~((uint64_t)1 << bit);
+      }
+    }
+  }
+  free(stack);
+  free(visited);
+}
+
+/**
+ * Depth first search with scratch taken from an arena
+ * @brief depth first search, same visiting order as depth_first_search and
+ * no heap allocation
+ * @param graph graph structure pointer
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @param arena scratch memory, everything taken from it is released on return
+ * @return void
+ */
+void depth_first_search_arena(graph_t* graph, int start_vertex,
+                              graph_traversal_result_t* result,
+                              arena_t* arena) {
+  if (!graph || !result || !arena || !graph->adjacency ||
+      !graph->adjacency->data || graph->adjacency->size == 0 ||
+      start_vertex < 0 || start_vertex >= graph->adjacency->size) {
+    return;
+  }
+  const int size = graph->adjacency->size;
+  const arena_mark_t mark = arena_mark(arena);
+  unsigned char* visited =
+      (unsigned char*)arena_calloc(arena, (size_t)size, sizeof(char));
+  // vertices are marked when pushed, so the stack never exceeds size
+  int* stack = (int*)arena_alloc(arena, (size_t)size * sizeof(int));
+  if (visited && stack) {
+    int top = 0;
+    stack[top++] = start_vertex;
+    visited[start_vertex] = 1;
+    result->size = 0;
+    while (top > 0) {
+      const int current_vertex = stack[--top];
+      result->visited_vertices[result->size++] = current_vertex;
+      const int* row = matrix_row(graph->adjacency, current_vertex);
+      for (int n = size - 1; n >= 0; n--) {
+        if (row[n] && !visited[n]) {
+          stack[top++] = n;
+          visited[n] = 1;
+        }
+      }
+    }
+  }
+  arena_release(arena, mark);
+}
+
+/**
+ * Depth first search reusing the buffers of a workspace
+ * @brief depth first search, same visiting order as depth_first_search
+ * without allocation or clearing
+ * @param workspace workspace of the graph to search
+ * @param start_vertex start vertex
+ * @param result result structure pointer
+ * @return void
+ */
+void depth_first_search_with_workspace(graph_workspace_t* workspace,
+                                       int start_vertex,
+                                       graph_traversal_result_t* result) {
+  if (!result || !graph_workspace_begin(workspace) || start_vertex < 0 ||
+      start_vertex >= workspace->size) {
+    return;
+  }
+  const matrix_t* adjacency = workspace->graph->adjacency;
+  // vertices are marked when pushed, so the stack never exceeds size
+  int* stack = workspace->buffer;
+  int top = 0;
+  stack[top++] = start_vertex;
+  workspace_visit(workspace, start_vertex);
+  result->size = 0;
+  while (top > 0) {
+    const int current_vertex = stack[--top];
+    result->visited_vertices[result->size++] = current_vertex;
+    const int* row = matrix_row(adjacency, current_vertex);
+    for (int n = workspace->size - 1; n >= 0; n--) {
+      if (row[n] && !workspace_is_visited(workspace, n)) {
+        stack[top++] = n;
+        workspace_visit(workspace, n);
+      }
+    }
+  }
+}
+
+/**
+ * Depth first search filling levels and parents
+ * @brief depth first search, same visiting order as depth_first_search, stops
+ * as soon as the target is visited or the visit budget is spent. The level of
+ * a vertex is its depth in the DFS tree. Vertices still on the stack when the
+ * search stops were not visited and are left unreached.
+ * @param graph graph structure pointer
+ * @param start_vertex start vertex
+ * @param limits stop conditions, NULL to visit every reachable vertex
+ * @param result levels result of the same size as the graph
+ * @return void
+ */
+void depth_first_search_levels(graph_t* graph, int start_vertex,
+                               const traversal_limits_t* limits,
+                               graph_levels_result_t* result) {
+  if (!graph || !result || !graph->adjacency || !graph->adjacency->data ||
+      graph->adjacency->size != result->size || start_vertex < 0 ||
+      start_vertex >= result->size) {
+    return;
+  }
+  array_stack_t* st = array_stack_create(result->size);
+  if (!st) return;
+  levels_result_reset(result);
+  // vertices are marked when pushed, level >= 0 doubles as the mark
+  array_stack_push(st, start_vertex);
+  result->levels[start_vertex] = 0;
+  bool done = false;
+  while (!done && !array_stack_is_empty(st)) {
+    const int current_vertex = array_stack_top(st);
+    array_stack_pop(st);
+    result->order[result->reached++] = current_vertex;
+    done = traversal_limits_reached(limits, current_vertex, result->reached);
+    const int* row = matrix_row(graph->adjacency, current_vertex);
+    for (int n = result->size - 1; n >= 0 && !done; n--) {
+      if (row[n] && result->levels[n] < 0) {
+        array_stack_push(st, n);
+        result->levels[n] = result->levels[current_vertex] + 1;
+        result->parents[n] = current_vertex;
+      }
+    }
+  }
+  while (!array_stack_is_empty(st)) {
+    result->levels[array_stack_top(st)] = -1;
+    result->parents[array_stack_top(st)] = -1;
+    array_stack_pop(st);
+  }
+  array_stack_delete(st);
+}
@@ -95,3 +95,99 @@ TEST(GraphAlgorithmsTest, DepthFirstSearch_LinearGraph) {
 
   ASSERT_EQ(result, expected);
 }
+
+TEST(GraphAlgorithmsTest, DepthFirstSearchCsr_MatchesMatrix) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/graph_examples.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  for (int start = 0; start < graph.getOrder(); start++) {
+    ASSERT_EQ(algorithms.depthFirstSearchCsr(graph, start),
+              algorithms.depthFirstSearch(graph, start));
+  }
+}
+
+TEST(GraphAlgorithmsTest, DepthFirstSearchCsr_TestGraph) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/test_graph.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  std::vector<int> expected = {0, 1, 3, 2, 4};
+
+  ASSERT_EQ(algorithms.depthFirstSearchCsr(graph, 0), expected);
+}
+
+TEST(GraphAlgorithmsTest, DepthFirstSearchBits_MatchesMatrix) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/graph_examples.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  for (int start = 0; start < graph.getOrder(); start++) {
+    ASSERT_EQ(algorithms.depthFirstSearchBits(graph, start),
+              algorithms.depthFirstSearch(graph, start));
+  }
+}
+
+TEST(GraphAlgorithmsTest, DepthFirstSearchBits_RowsOfSeveralWords) {
+  const int kSize = 200;
+  GraphWrapper graph;
+  FillRandomGraph(graph, kSize, 3, false, 777u, 1);
+
+  GraphAlgorithmsWrapper algorithms;
+  for (int start = 0; start < kSize; start += 9) {
+    ASSERT_EQ(algorithms.depthFirstSearchBits(graph, start),
+              algorithms.depthFirstSearch(graph, start));
+  }
+}
+
+TEST(GraphAlgorithmsTest, DepthFirstSearchLevels_MatchesOrderAndDepths) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/graph_examples.txt");
+  GraphAlgorithmsWrapper algorithms;
+  const int size = graph.getOrder();
+  graph_levels_result_t* result = levels_result_create(size);
+  ASSERT_NE(result, nullptr);
+  std::vector<int> path(size);
+  for (int start = 0; start < size; start++) {
+    depth_first_search_levels(graph.getGraph(), start, nullptr, result);
+    ASSERT_EQ(std::vector<int>(result->order, result->order + result->reached),
+              algorithms.depthFirstSearch(graph, start));
+    for (int i = 0; i < result->reached; i++) {
+      const int v = result->order[i];
+      const int length = levels_result_path(result, v, path.data());
+      ASSERT_EQ(length, result->levels[v] + 1);
+      EXPECT_EQ(path[0], start);
+      for (int k = 1; k < length; k++) {
+        EXPECT_NE(graph.getMatrixValue(path[k - 1], path[k]), 0);
+      }
+    }
+  }
+  levels_result_delete(result);
+}
+
+TEST(GraphAlgorithmsTest, DepthFirstSearchLevels_EarlyStop) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile("../datasets/incidence_matrix_src/test_graph.txt");
+  graph_levels_result_t* result = levels_result_create(graph.getOrder());
+  ASSERT_NE(result, nullptr);
+  // full order from 0 is {0, 1, 3, 2, 4}
+  traversal_limits_t limits = {3, 0};
+  depth_first_search_levels(graph.getGraph(), 0, &limits, result);
+  ASSERT_EQ(result->reached, 3);
+  EXPECT_EQ(std::vector<int>(result->order, result->order + 3),
+            std::vector<int>({0, 1, 3}));
+  int reached = 0;
+  for (int v = 0; v < graph.getOrder(); v++) {
+    reached += result->levels[v] >= 0;
+    if (result->levels[v] < 0) {
+      EXPECT_EQ(result->parents[v], -1);
+    }
+  }
+  EXPECT_EQ(reached, 3);
+
+  limits = {-1, 2};
+  depth_first_search_levels(graph.getGraph(), 0, &limits, result);
+  EXPECT_EQ(result->reached, 2);
+  EXPECT_EQ(result->levels[3], -1);
+  levels_result_delete(result);
+}
@@ -0,0 +1,180 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../s21_graph_algorithms.h"
+
+/**
+ * @brief queries of a batch grouped by source with a counting sort
+ * @param sources distinct valid sources, ascending
+ * @param group_begin the queries of sources[i] are
+ * members[group_begin[i], group_begin[i + 1])
+ * @param members query indices, ascending within a group
+ */
+typedef struct {
+  int *sources;
+  int *group_begin;
+  int *members;
+  int source_count;
+} query_groups_t;
+
+/**
+ * @brief state shared by the threads of one batch
+ * @param trees one shortest-path tree per thread
+ * @param next_source index of the next group a thread takes
+ * @param failed set when a search failed
+ */
+typedef struct {
+  const csr_graph_t *graph;
+  const shortest_path_query_t *queries;
+  int *results;
+  const query_groups_t *groups;
+  shortest_path_tree_t **trees;
+  atomic_int next_source;
+  atomic_bool failed;
+} batch_search_t;
+
+static bool valid_query(const csr_graph_t *graph,
+                        const shortest_path_query_t *query) {
+  return query->source >= 0 && query->source < graph->size &&
+         query->target >= 0 && query->target < graph->size;
+}
+
+/**
+ * @brief groups the valid queries by source in O(V + Q), the others get -1
+ * @return false if memory allocation failed
+ */
+static bool group_queries(const csr_graph_t *graph,
+                          const shortest_path_query_t *queries,
+                          int query_count, int *results,
+                          query_groups_t *groups) {
+  int *offsets = (int *)calloc((size_t)graph->size + 1, sizeof(int));
+  groups->members = (int *)malloc(((size_t)query_count + 1) * sizeof(int));
+  if (!offsets || !groups->members) {
+    free(offsets);
+    return false;
+  }
+  for (int q = 0; q < query_count; q++) {
+    if (valid_query(graph, &queries[q])) {
+      offsets[queries[q].source + 1]++;
+    } else {
+      results[q] = -1;
+    }
+  }
+  int source_count = 0;
+  for (int v = 0; v < graph->size; v++) {
+    source_count += offsets[v + 1] > 0;
+    offsets[v + 1] += offsets[v];
+  }
+  groups->sources = (int *)malloc(((size_t)source_count + 1) * sizeof(int));
+  groups->group_begin =
+      (int *)malloc(((size_t)source_count + 1) * sizeof(int));
+  const bool ok = groups->sources && groups->group_begin;
+  if (ok) {
+    groups->source_count = 0;
+    for (int v = 0; v < graph->size; v++) {
+      if (offsets[v + 1] == offsets[v]) continue;
+      groups->sources[groups->source_count] = v;
+      groups->group_begin[groups->source_count++] = offsets[v];
+    }
+    groups->group_begin[source_count] = offsets[graph->size];
+    for (int q = 0; q < query_count; q++) {
+      if (valid_query(graph, &queries[q])) {
+        groups->members[offsets[queries[q].source]++] = q;
+      }
+    }
+  }
+  free(offsets);
+  return ok;
+}
+
+static void query_groups_free(query_groups_t *groups) {
+  free(groups->sources);
+  free(groups->group_begin);
+  free(groups->members);
+}
+
+/**
+ * @brief task: takes the groups one by one from an atomic counter, grows
+ * the shortest-path tree of the group's source and answers its queries
+ */
+static void answer_groups(void *arg, int thread_index) {
+  batch_search_t *batch = (batch_search_t *)arg;
+  const query_groups_t *groups = batch->groups;
+  shortest_path_tree_t *tree = batch->trees[thread_index];
+  for (;;) {
+    const int i =
+        atomic_fetch_add_explicit(&batch->next_source, 1, memory_order_relaxed);
+    if (i >= groups->source_count ||
+        atomic_load_explicit(&batch->failed, memory_order_relaxed)) {
+      break;
+    }
+    if (!get_shortest_path_tree_engine(batch->graph, groups->sources[i],
+                                       SHORTEST_PATH_ENGINE_AUTO, tree)) {
+      atomic_store(&batch->failed, true);
+      break;
+    }
+    for (int m = groups->group_begin[i]; m < groups->group_begin[i + 1];
+         m++) {
+      const int q = groups->members[m];
+      batch->results[q] = tree->dist[batch->queries[q].target];
+    }
+  }
+}
+
+/**
+ * @brief answers a batch of (source, target) queries with one
+ * single-source search per distinct source instead of one search per query.
+ *
+ * The queries are grouped by source with a counting sort, then the threads
+ * of the pool take the groups from an atomic counter; each thread grows a
+ * shortest-path tree of its own (SHORTEST_PATH_ENGINE_AUTO) and writes the
+ * distances of the group's targets. Every query has its own result slot, so
+ * the threads never write to the same place. The cost is one search per
+ * distinct source, the more often sources repeat the cheaper a query gets.
+ * @param graph csr graph pointer, only positive edges count (0 means no
+ * edge)
+ * @param queries query_count (source, target) pairs
+ * @param pool threads to use, NULL runs on the calling thread
+ * @param results receives query_count distances in query order, -1 if the
+ * target is unreachable or a vertex is out of range
+ * @return false on invalid input or memory allocation failure
+ */
+bool get_shortest_paths_batch(const csr_graph_t *graph,
+                              const shortest_path_query_t *queries,
+                              int query_count, thread_pool_t *pool,
+                              int *results) {
+  if (!graph || query_count < 0 ||
+      (query_count > 0 && (!queries || !results))) {
+    return false;
+  }
+  const int thread_count = thread_pool_size(pool);
+  query_groups_t groups;
+  memset(&groups, 0, sizeof(groups));
+  shortest_path_tree_t **trees = (shortest_path_tree_t **)calloc(
+      (size_t)thread_count, sizeof(shortest_path_tree_t *));
+  bool ok = trees &&
+            group_queries(graph, queries, query_count, results, &groups);
+  for (int t = 0; ok && groups.source_count > 0 && t < thread_count; t++) {
+    trees[t] = shortest_path_tree_create(graph->size);
+    ok = trees[t] != NULL;
+  }
+  if (ok && groups.source_count > 0) {
+    batch_search_t batch;
+    batch.graph = graph;
+    batch.queries = queries;
+    batch.results = results;
+    batch.groups = &groups;
+    batch.trees = trees;
+    atomic_init(&batch.next_source, 0);
+    atomic_init(&batch.failed, false);
+    thread_pool_run(pool, answer_groups, &batch);
+    ok = !atomic_load(&batch.failed);
+  }
+  for (int t = 0; trees && t < thread_count; t++) {
+    shortest_path_tree_delete(trees[t]);
+  }
+  free(trees);
+  query_groups_free(&groups);
+  return ok;
+}
@@ -0,0 +1,106 @@
+#include "../data_structures/indexed_heap/indexed_heap.h"
+#include "../s21_graph_algorithms.h"
+
+/**
+ * @brief one direction of the search
+ * @param graph edges followed by this side, the reverse graph for the
+ * backward search
+ */
+typedef struct {
+  const csr_graph_t* graph;
+  indexed_heap_t* heap;
+  int* dist;
+} search_side_t;
+
+/**
+ * @brief settles the nearest vertex of one side and relaxes its edges,
+ * every relaxed vertex already reached by the other side is a candidate
+ * meeting point
+ * @param best length of the shortest path found so far, INT_MAX if none
+ */
+static void settle_next(search_side_t* side, const search_side_t* other,
+                        long long* best) {
+  const int u = indexed_heap_pop(side->heap);
+  const csr_graph_t* graph = side->graph;
+  for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+    if (graph->weights[e] <= 0) continue;
+    const int v = graph->targets[e];
+    const int new_dist = side->dist[u] + graph->weights[e];
+    if (side->dist[v] == INT_MAX) {
+      indexed_heap_push(side->heap, v, new_dist);
+    } else if (new_dist < side->dist[v]) {
+      indexed_heap_decrease(side->heap, v, new_dist);
+    } else {
+      continue;
+    }
+    side->dist[v] = new_dist;
+    if (other->dist[v] != INT_MAX &&
+        (long long)new_dist + other->dist[v] < *best) {
+      *best = (long long)new_dist + other->dist[v];
+    }
+  }
+}
+
+static int run_bidirectional(search_side_t* forward, search_side_t* backward,
+                             int vertex1, int vertex2, int size) {
+  for (int v = 0; v < size; v++) {
+    forward->dist[v] = INT_MAX;
+    backward->dist[v] = INT_MAX;
+  }
+  forward->dist[vertex1] = 0;
+  backward->dist[vertex2] = 0;
+  indexed_heap_push(forward->heap, vertex1, 0);
+  indexed_heap_push(backward->heap, vertex2, 0);
+  long long best = INT_MAX;
+  while (!indexed_heap_is_empty(forward->heap) &&
+         !indexed_heap_is_empty(backward->heap) &&
+         (long long)indexed_heap_min_key(forward->heap) +
+                 indexed_heap_min_key(backward->heap) <
+             best) {
+    // the side with fewer queued vertices has the cheaper frontier
+    if (forward->heap->count <= backward->heap->count) {
+      settle_next(forward, backward, &best);
+    } else {
+      settle_next(backward, forward, &best);
+    }
+  }
+  return best < INT_MAX ? (int)best : -1;
+}
+
+/**
+ * Bidirectional Dijkstra’s algorithm, only with positive edges
+ * @brief searches forward from vertex1 over graph and backward from vertex2
+ * over reverse at the same time, always extending the side with the smaller
+ * queue. Every edge relaxed into a vertex reached by the other side is a
+ * candidate path, and the search stops once the two smallest queued
+ * distances add up to the best candidate, so the settled region is two
+ * balls of about half the radius instead of one.
+ * @param graph csr graph structure pointer
+ * @param reverse in-edges of graph (csr_graph_transpose), NULL if the graph
+ * is symmetric
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_bidirectional(const csr_graph_t* graph,
+                                    const csr_graph_t* reverse, int vertex1,
+                                    int vertex2) {
+  if (!graph || vertex1 < 0 || vertex1 >= graph->size || vertex2 < 0 ||
+      vertex2 >= graph->size || (reverse && reverse->size != graph->size)) {
+    return -1;
+  }
+  if (vertex1 == vertex2) return 0;
+  search_side_t forward = {graph, indexed_heap_create(graph->size),
+                           (int*)malloc((size_t)graph->size * sizeof(int))};
+  search_side_t backward = {reverse ? reverse : graph,
+                            indexed_heap_create(graph->size),
+                            (int*)malloc((size_t)graph->size * sizeof(int))};
+  int result = -1;
+  if (forward.heap && forward.dist && backward.heap && backward.dist) {
+    result =
+        run_bidirectional(&forward, &backward, vertex1, vertex2, graph->size);
+  }
+  indexed_heap_delete(forward.heap);
+  indexed_heap_delete(backward.heap);
+  free(forward.dist);
+  free(backward.dist);
+  return result;
+}
@@ -0,0 +1,285 @@
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../s21_graph_algorithms.h"
+
+/**
+ * @brief vertices a thread takes at once from the frontier
+ */
+#define DELTA_STEPPING_CHUNK 64
+
+/**
+ * @brief growable list of vertices
+ */
+typedef struct {
+  int *vertices;
+  int count;
+  int capacity;
+} vertex_list_t;
+
+/**
+ * @brief state shared by the threads of one search
+ * @param dist tentative distances, INT_MAX if unreached, lowered with
+ * compare-and-swap
+ * @param buckets bucket_count circular buckets, bucket i holds the vertices
+ * of tentative distance in [i * delta, (i + 1) * delta) and may also hold
+ * stale entries that are skipped when the bucket is taken
+ * @param frontier vertices of the current bucket relaxed by the next step
+ * @param settled vertices removed from the current bucket, their heavy edges
+ * are relaxed once the bucket stays empty
+ * @param improved per-thread lists of vertices whose distance dropped
+ * @param stamp per-vertex mark of the last step or bucket that listed it
+ */
+typedef struct {
+  const csr_graph_t *graph;
+  int delta;
+  atomic_int *dist;
+  vertex_list_t *buckets;
+  int bucket_count;
+  vertex_list_t frontier;
+  vertex_list_t settled;
+  vertex_list_t *improved;
+  int *frontier_stamp;
+  int *settled_stamp;
+  const vertex_list_t *relaxed;
+  bool heavy;
+  atomic_int next_chunk;
+  atomic_bool failed;
+} delta_stepping_t;
+
+static bool list_push(vertex_list_t *list, int vertex) {
+  if (list->count == list->capacity) {
+    const int capacity = list->capacity ? list->capacity * 2 : 1024;
+    int *vertices =
+        (int *)realloc(list->vertices, (size_t)capacity * sizeof(int));
+    if (!vertices) return false;
+    list->vertices = vertices;
+    list->capacity = capacity;
+  }
+  list->vertices[list->count++] = vertex;
+  return true;
+}
+
+/**
+ * @brief lowers dist to value if it is smaller
+ * @return true if this call lowered it
+ */
+static bool atomic_lower(atomic_int *dist, int value) {
+  int current = atomic_load_explicit(dist, memory_order_relaxed);
+  while (value < current) {
+    if (atomic_compare_exchange_weak_explicit(
+            dist, &current, value, memory_order_relaxed,
+            memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief task: relaxes the light (weight <= delta) or heavy edges of chunks
+ * of the relaxed list, improved targets go to the thread's list
+ */
+static void relax_edges(void *arg, int thread_index) {
+  delta_stepping_t *ds = (delta_stepping_t *)arg;
+  const csr_graph_t *graph = ds->graph;
+  vertex_list_t *improved = &ds->improved[thread_index];
+  for (;;) {
+    const int begin = atomic_fetch_add_explicit(
+        &ds->next_chunk, DELTA_STEPPING_CHUNK, memory_order_relaxed);
+    if (begin >= ds->relaxed->count) break;
+    const int end = begin + DELTA_STEPPING_CHUNK < ds->relaxed->count
+                        ? begin + DELTA_STEPPING_CHUNK
+                        : ds->relaxed->count;
+    for (int i = begin; i < end; i++) {
+      const int u = ds->relaxed->vertices[i];
+      const int dist_u =
+          atomic_load_explicit(&ds->dist[u], memory_order_relaxed);
+      for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+        const int weight = graph->weights[e];
+        if (weight <= 0 || (weight > ds->delta) != ds->heavy) continue;
+        const int v = graph->targets[e];
+        if (atomic_lower(&ds->dist[v], dist_u + weight) &&
+            !list_push(improved, v)) {
+          atomic_store(&ds->failed, true);
+          return;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief relaxes the edges of the relaxed list on every thread of the pool
+ */
+static bool run_step(delta_stepping_t *ds, thread_pool_t *pool,
+                     const vertex_list_t *relaxed, bool heavy) {
+  const int thread_count = thread_pool_size(pool);
+  for (int t = 0; t < thread_count; t++) ds->improved[t].count = 0;
+  ds->relaxed = relaxed;
+  ds->heavy = heavy;
+  atomic_store(&ds->next_chunk, 0);
+  thread_pool_run(pool, relax_edges, ds);
+  return !atomic_load(&ds->failed);
+}
+
+/**
+ * @brief sorts the improved vertices: the ones still in bucket current join
+ * the next frontier (once per step), the others go to their bucket
+ * @return false if memory allocation failed
+ */
+static bool distribute(delta_stepping_t *ds, int thread_count, int current,
+                       int step, int *pending) {
+  ds->frontier.count = 0;
+  for (int t = 0; t < thread_count; t++) {
+    const vertex_list_t *improved = &ds->improved[t];
+    for (int i = 0; i < improved->count; i++) {
+      const int v = improved->vertices[i];
+      const int bucket = atomic_load(&ds->dist[v]) / ds->delta;
+      bool ok = true;
+      if (bucket != current) {
+        ok = list_push(&ds->buckets[bucket % ds->bucket_count], v);
+        (*pending)++;
+      } else if (ds->frontier_stamp[v] != step) {
+        ds->frontier_stamp[v] = step;
+        ok = list_push(&ds->frontier, v);
+      }
+      if (!ok) return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief moves the live entries of bucket current to the frontier
+ */
+static void take_bucket(delta_stepping_t *ds, int current, int step,
+                        int *pending) {
+  vertex_list_t *bucket = &ds->buckets[current % ds->bucket_count];
+  ds->frontier.count = 0;
+  for (int i = 0; i < bucket->count; i++) {
+    const int v = bucket->vertices[i];
+    if (atomic_load(&ds->dist[v]) / ds->delta == current &&
+        ds->frontier_stamp[v] != step) {
+      ds->frontier_stamp[v] = step;
+      ds->frontier.vertices[ds->frontier.count++] = v;
+    }
+  }
+  *pending -= bucket->count;
+  bucket->count = 0;
+}
+
+/**
+ * @brief processes buckets in increasing order until all are empty
+ * @return false if memory allocation failed
+ */
+static bool run_buckets(delta_stepping_t *ds, thread_pool_t *pool,
+                        int source) {
+  const int thread_count = thread_pool_size(pool);
+  int pending = 1, step = 0;
+  if (!list_push(&ds->buckets[0], source)) return false;
+  for (int current = 0; pending > 0; current++) {
+    if (ds->buckets[current % ds->bucket_count].count == 0) continue;
+    take_bucket(ds, current, ++step, &pending);
+    ds->settled.count = 0;
+    while (ds->frontier.count > 0) {
+      for (int i = 0; i < ds->frontier.count; i++) {
+        const int v = ds->frontier.vertices[i];
+        if (ds->settled_stamp[v] != current + 1) {
+          ds->settled_stamp[v] = current + 1;
+          if (!list_push(&ds->settled, v)) return false;
+        }
+      }
+      if (!run_step(ds, pool, &ds->frontier, false) ||
+          !distribute(ds, thread_count, current, ++step, &pending)) {
+        return false;
+      }
+    }
+    if (!run_step(ds, pool, &ds->settled, true) ||
+        !distribute(ds, thread_count, current, ++step, &pending)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief delta used when the caller passes none: the largest weight over
+ * the average out-degree (Meyer and Sanders)
+ */
+static int default_delta(const csr_graph_t *graph) {
+  const int degree =
+      graph->size > 0 ? (graph->edge_count + graph->size - 1) / graph->size
+                      : 1;
+  const int delta = csr_graph_max_weight(graph) / (degree > 0 ? degree : 1);
+  return delta > 0 ? delta : 1;
+}
+
+/**
+ * @brief parallel delta-stepping single-source shortest paths over
+ * compressed sparse rows, only with positive edges (0 means no edge).
+ *
+ * Tentative distances are kept in buckets of width delta. The buckets are
+ * processed in increasing order: the light edges (weight <= delta) of the
+ * current bucket are relaxed in parallel, again and again while relaxations
+ * refill the bucket, then the heavy edges of every vertex removed from it
+ * are relaxed once. Threads take 64-vertex chunks of the frontier from an
+ * atomic counter and lower distances with compare-and-swap, the improved
+ * vertices are sorted into buckets between the steps. A small delta
+ * approaches Dijkstra, a large one Bellman-Ford with more parallel work.
+ * @param graph csr graph pointer
+ * @param source start vertex
+ * @param delta bucket width, 0 or less picks max_weight / average degree
+ * @param pool threads to use, NULL runs on the calling thread
+ * @param dist receives graph->size distances, -1 for unreachable vertices
+ * @return false on invalid input or memory allocation failure
+ */
+bool shortest_paths_delta_stepping(const csr_graph_t *graph, int source,
+                                   int delta, thread_pool_t *pool,
+                                   int *dist) {
+  if (!graph || !dist || source < 0 || source >= graph->size) return false;
+  const int thread_count = thread_pool_size(pool);
+  delta_stepping_t ds;
+  memset(&ds, 0, sizeof(ds));
+  ds.graph = graph;
+  ds.delta = delta > 0 ? delta : default_delta(graph);
+  // pending distances lie within max_weight + delta of the current bucket
+  ds.bucket_count = csr_graph_max_weight(graph) / ds.delta + 2;
+  ds.dist = (atomic_int *)malloc((size_t)graph->size * sizeof(atomic_int));
+  ds.buckets =
+      (vertex_list_t *)calloc((size_t)ds.bucket_count, sizeof(vertex_list_t));
+  ds.improved =
+      (vertex_list_t *)calloc((size_t)thread_count, sizeof(vertex_list_t));
+  ds.frontier_stamp = (int *)calloc((size_t)graph->size, sizeof(int));
+  ds.settled_stamp = (int *)calloc((size_t)graph->size, sizeof(int));
+  ds.frontier.vertices = (int *)malloc((size_t)graph->size * sizeof(int));
+  ds.frontier.capacity = graph->size;
+  atomic_init(&ds.next_chunk, 0);
+  atomic_init(&ds.failed, false);
+  bool ok = ds.dist && ds.buckets && ds.improved && ds.frontier_stamp &&
+            ds.settled_stamp && ds.frontier.vertices;
+  if (ok) {
+    for (int v = 0; v < graph->size; v++) atomic_init(&ds.dist[v], INT_MAX);
+    atomic_store(&ds.dist[source], 0);
+    ok = run_buckets(&ds, pool, source);
+  }
+  for (int v = 0; ok && v < graph->size; v++) {
+    const int d = atomic_load(&ds.dist[v]);
+    dist[v] = d == INT_MAX ? -1 : d;
+  }
+  for (int b = 0; ds.buckets && b < ds.bucket_count; b++) {
+    free(ds.buckets[b].vertices);
+  }
+  for (int t = 0; ds.improved && t < thread_count; t++) {
+    free(ds.improved[t].vertices);
+  }
+  free(ds.buckets);
+  free(ds.improved);
+  free(ds.settled.vertices);
+  free(ds.frontier.vertices);
+  free(ds.settled_stamp);
+  free(ds.frontier_stamp);
+  free((void *)ds.dist);
+  return ok;
+}
@@ -32,13 +32,15 @@ static int find_min_distance_vertex(int vertex_count, const int* dist,
 }
 
 static void update_neighbor_distances(graph_t* graph, int u, int* dist,
-                                      int* visited) {
+                                      int* visited, int* pred) {
+  const int* row = matrix_row(graph->adjacency, u);
   for (int v = 0; v < graph->adjacency->size; v++) {
-    const int edge_weight = graph->adjacency->data[u][v];
+    const int edge_weight = row[v];
     if (!visited[v] && edge_weight > 0 && dist[u] != INT_MAX) {
       const int new_dist = dist[u] + edge_weight;
       if (new_dist < dist[v]) {
         dist[v] = new_dist;
+        if (pred) pred[v] = u;
       }
     }
   }
@@ -63,10 +65,169 @@ int get_shortest_path_between_vertices(graph_t* graph, int vertex1,
     if (u == -1 || dist[u] == INT_MAX || u == vertex2) break;
 
     visited[u] = 1;
-    update_neighbor_distances(graph, u, dist, visited);
+    update_neighbor_distances(graph, u, dist, visited, NULL);
   }
   const int result = (dist[vertex2] == INT_MAX) ? -1 : dist[vertex2];
   free(dist);
   free(visited);
   return result;
 }
+
+/**
+ * Dijkstra’s algorithm over compressed sparse rows, only with positive edges
+ * @brief runs get_shortest_path_between_vertices_engine with the priority
+ * queue picked from the graph's largest weight
+ * @param graph csr graph structure pointer
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_between_vertices_csr(const csr_graph_t* graph,
+                                           int vertex1, int vertex2) {
+  return get_shortest_path_between_vertices_engine(
+      graph, vertex1, vertex2, SHORTEST_PATH_ENGINE_AUTO);
+}
+
+/**
+ * Dijkstra’s algorithm from one source to every vertex
+ * @brief one O(V²) search fills the distance and predecessor of every
+ * vertex, shortest_path_tree_path then rebuilds any path in O(path length)
+ * @param graph graph structure pointer
+ * @param source start vertex
+ * @param tree shortest-path tree of the same size as the graph
+ * @return false on invalid input or memory allocation failure
+ */
+bool get_shortest_path_tree(graph_t* graph, int source,
+                            shortest_path_tree_t* tree) {
+  if (validate_input(graph, source, source) < 0 || !tree ||
+      tree->size != graph->adjacency->size) {
+    return false;
+  }
+  const int vertex_count = tree->size;
+  int* dist = tree->dist;
+  int* visited = (int*)calloc(vertex_count, sizeof(int));
+  if (!visited) return false;
+  for (int i = 0; i < vertex_count; i++) {
+    dist[i] = INT_MAX;
+    tree->pred[i] = -1;
+  }
+  dist[source] = 0;
+  for (int i = 0; i < vertex_count; i++) {
+    int u = find_min_distance_vertex(vertex_count, dist, visited);
+    if (u == -1 || dist[u] == INT_MAX) break;
+
+    visited[u] = 1;
+    update_neighbor_distances(graph, u, dist, visited, tree->pred);
+  }
+  for (int i = 0; i < vertex_count; i++) {
+    if (dist[i] == INT_MAX) dist[i] = -1;
+  }
+  tree->source = source;
+  free(visited);
+  return true;
+}
+
+/**
+ * Single-source Dijkstra over compressed sparse rows
+ * @brief runs get_shortest_path_tree_engine with the priority queue picked
+ * from the graph's largest weight
+ * @param graph csr graph structure pointer
+ * @param source start vertex
+ * @param tree shortest-path tree of the same size as the graph
+ * @return false on invalid input or memory allocation failure
+ */
+bool get_shortest_path_tree_csr(const csr_graph_t* graph, int source,
+                                shortest_path_tree_t* tree) {
+  return get_shortest_path_tree_engine(graph, source,
+                                       SHORTEST_PATH_ENGINE_AUTO, tree);
+}
+
+/**
+ * Dijkstra’s algorithm with scratch taken from an arena
+ * @brief same result as get_shortest_path_between_vertices without heap
+ * allocation
+ * @param graph graph structure pointer
+ * @param arena scratch memory, everything taken from it is released on return
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_between_vertices_arena(graph_t* graph, int vertex1,
+                                             int vertex2, arena_t* arena) {
+  int validation = validate_input(graph, vertex1, vertex2);
+  if (validation != 1) return validation;
+  if (!arena) return -1;
+  const int vertex_count = graph->adjacency->size;
+  const arena_mark_t mark = arena_mark(arena);
+  int* dist = (int*)arena_alloc(arena, (size_t)vertex_count * sizeof(int));
+  int* visited = (int*)arena_calloc(arena, (size_t)vertex_count, sizeof(int));
+  int result = -1;
+  if (dist && visited) {
+    for (int i = 0; i < vertex_count; i++) dist[i] = INT_MAX;
+    dist[vertex1] = 0;
+    for (int i = 0; i < vertex_count - 1; i++) {
+      int u = find_min_distance_vertex(vertex_count, dist, visited);
+      if (u == -1 || dist[u] == INT_MAX || u == vertex2) break;
+
+      visited[u] = 1;
+      update_neighbor_distances(graph, u, dist, visited, NULL);
+    }
+    result = (dist[vertex2] == INT_MAX) ? -1 : dist[vertex2];
+  }
+  arena_release(arena, mark);
+  return result;
+}
+
+/**
+ * @brief removes and returns the frontier vertex of smallest distance
+ */
+static int pop_nearest(graph_workspace_t* workspace, int* count) {
+  int* frontier = workspace->buffer;
+  int best = 0;
+  for (int i = 1; i < *count; i++) {
+    if (workspace->dist[frontier[i]] < workspace->dist[frontier[best]]) {
+      best = i;
+    }
+  }
+  const int vertex = frontier[best];
+  frontier[best] = frontier[--*count];
+  return vertex;
+}
+
+/**
+ * Dijkstra’s algorithm reusing the buffers of a workspace
+ * @brief same result as get_shortest_path_between_vertices, only reached
+ * vertices are kept in the frontier, so a query that settles k vertices costs
+ * O(k * V) instead of O(V^2)
+ * @param workspace workspace of the graph to search
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_between_vertices_with_workspace(
+    graph_workspace_t* workspace, int vertex1, int vertex2) {
+  if (!graph_workspace_begin(workspace)) return -1;
+  int validation = validate_input(workspace->graph, vertex1, vertex2);
+  if (validation != 1) return validation;
+  int* dist = workspace->dist;
+  int count = 0;
+  workspace->buffer[count++] = vertex1;
+  workspace_reach(workspace, vertex1);
+  dist[vertex1] = 0;
+  int result = -1;
+  while (count > 0 && result == -1) {
+    const int u = pop_nearest(workspace, &count);
+    if (u == vertex2) {
+      result = dist[u];
+    } else {
+      workspace_visit(workspace, u);
+      const int* row = matrix_row(workspace->graph->adjacency, u);
+      for (int v = 0; v < workspace->size; v++) {
+        if (row[v] <= 0 || workspace_is_visited(workspace, v)) continue;
+        const int new_dist = dist[u] + row[v];
+        if (!workspace_is_reached(workspace, v)) {
+          workspace_reach(workspace, v);
+          workspace->buffer[count++] = v;
+          dist[v] = new_dist;
+        } else if (new_dist < dist[v]) {
+          dist[v] = new_dist;
+        }
+      }
+    }
+  }
+  return result;
+}
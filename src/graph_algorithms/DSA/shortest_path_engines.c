@@ -0,0 +1,329 @@
+#include <stdint.h>
+
+#include "../data_structures/indexed_heap/indexed_heap.h"
+#include "../s21_graph_algorithms.h"
+
+/** @brief buckets of the radix heap, one per bit of a key plus the minimum */
+#define RADIX_HEAP_BUCKETS 33
+
+/**
+ * @brief fills dist with INT_MAX and the source with 0, pred (may be NULL)
+ * with -1
+ */
+static void initialize_distances(int size, int source, int* dist, int* pred) {
+  for (int v = 0; v < size; v++) dist[v] = INT_MAX;
+  for (int v = 0; pred && v < size; v++) pred[v] = -1;
+  dist[source] = 0;
+}
+
+/**
+ * @brief Dijkstra with an indexed 4-ary heap and decrease-key,
+ * O((V + E) log V)
+ * @return false if memory allocation failed
+ */
+static bool dijkstra_heap(const csr_graph_t* graph, int source, int target,
+                          int* dist, int* pred) {
+  indexed_heap_t* heap = indexed_heap_create(graph->size);
+  if (!heap) return false;
+  initialize_distances(graph->size, source, dist, pred);
+  indexed_heap_push(heap, source, 0);
+  while (!indexed_heap_is_empty(heap)) {
+    const int u = indexed_heap_pop(heap);
+    if (u == target) break;
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+      const int v = graph->targets[e];
+      if (graph->weights[e] <= 0) continue;
+      // settled vertices are never improved, weights are positive
+      const int new_dist = dist[u] + graph->weights[e];
+      if (dist[v] == INT_MAX) {
+        indexed_heap_push(heap, v, new_dist);
+      } else if (new_dist < dist[v]) {
+        indexed_heap_decrease(heap, v, new_dist);
+      } else {
+        continue;
+      }
+      dist[v] = new_dist;
+      if (pred) pred[v] = u;
+    }
+  }
+  indexed_heap_delete(heap);
+  return true;
+}
+
+/**
+ * @brief Dial's buckets: max_weight + 1 circular buckets of intrusive doubly
+ * linked lists. Every reached vertex is within max_weight of the current
+ * distance, so bucket dist % span holds exactly the vertices at dist and
+ * decrease-key is an unlink and a push. O(E + D) for a farthest distance D.
+ */
+typedef struct {
+  int span;
+  int* head;
+  int* next;
+  int* prev;
+} dial_buckets_t;
+
+static void dial_insert(dial_buckets_t* buckets, int vertex, int distance) {
+  const int b = distance % buckets->span;
+  buckets->prev[vertex] = -1;
+  buckets->next[vertex] = buckets->head[b];
+  if (buckets->head[b] >= 0) buckets->prev[buckets->head[b]] = vertex;
+  buckets->head[b] = vertex;
+}
+
+static void dial_unlink(dial_buckets_t* buckets, int vertex, int distance) {
+  const int next = buckets->next[vertex], prev = buckets->prev[vertex];
+  if (prev >= 0) {
+    buckets->next[prev] = next;
+  } else {
+    buckets->head[distance % buckets->span] = next;
+  }
+  if (next >= 0) buckets->prev[next] = prev;
+}
+
+static void dial_relax(const csr_graph_t* graph, dial_buckets_t* buckets,
+                       int u, int* dist, int* pred, int* count) {
+  for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+    const int v = graph->targets[e];
+    if (graph->weights[e] <= 0) continue;
+    const int new_dist = dist[u] + graph->weights[e];
+    if (new_dist < dist[v]) {
+      if (dist[v] == INT_MAX) {
+        (*count)++;
+      } else {
+        dial_unlink(buckets, v, dist[v]);
+      }
+      dist[v] = new_dist;
+      if (pred) pred[v] = u;
+      dial_insert(buckets, v, new_dist);
+    }
+  }
+}
+
+/**
+ * @brief Dijkstra with Dial's buckets
+ * @return false if memory allocation failed
+ */
+static bool dijkstra_dial(const csr_graph_t* graph, int source, int target,
+                          int* dist, int* pred) {
+  dial_buckets_t buckets;
+  buckets.span = csr_graph_max_weight(graph) + 1;
+  buckets.head = (int*)malloc((size_t)buckets.span * sizeof(int));
+  buckets.next = (int*)malloc((size_t)graph->size * sizeof(int));
+  buckets.prev = (int*)malloc((size_t)graph->size * sizeof(int));
+  const bool allocated = buckets.head && buckets.next && buckets.prev;
+  if (allocated) {
+    for (int b = 0; b < buckets.span; b++) buckets.head[b] = -1;
+    initialize_distances(graph->size, source, dist, pred);
+    dial_insert(&buckets, source, 0);
+    int count = 1;
+    bool done = false;
+    for (int current = 0; count > 0 && !done; current++) {
+      const int b = current % buckets.span;
+      while (buckets.head[b] >= 0 && !done) {
+        const int u = buckets.head[b];
+        dial_unlink(&buckets, u, current);
+        count--;
+        done = u == target;
+        if (!done) dial_relax(graph, &buckets, u, dist, pred, &count);
+      }
+    }
+  }
+  free(buckets.head);
+  free(buckets.next);
+  free(buckets.prev);
+  return allocated;
+}
+
+/**
+ * @brief entry of the radix heap, a vertex may be pushed once per improvement
+ * and the stale entries are skipped when popped
+ */
+typedef struct {
+  unsigned key;
+  int vertex;
+} radix_item_t;
+
+/**
+ * @brief monotone radix heap (Ahuja et al.). Bucket b > 0 holds the keys whose
+ * highest bit differing from the last popped key is b - 1, bucket 0 the keys
+ * equal to it. Every key is moved at most 32 times, so a search costs
+ * O(E + V log C) for the largest weight C.
+ */
+typedef struct {
+  radix_item_t* items[RADIX_HEAP_BUCKETS];
+  int count[RADIX_HEAP_BUCKETS];
+  int capacity[RADIX_HEAP_BUCKETS];
+  unsigned last;
+  int size;
+} radix_heap_t;
+
+static int radix_bucket(const radix_heap_t* heap, unsigned key) {
+  return key == heap->last ? 0 : 1 + bit_scan_reverse(key ^ heap->last);
+}
+
+static bool radix_append(radix_heap_t* heap, int b, radix_item_t item) {
+  if (heap->count[b] == heap->capacity[b]) {
+    const int capacity = heap->capacity[b] ? 2 * heap->capacity[b] : 16;
+    radix_item_t* items = (radix_item_t*)realloc(
+        heap->items[b], (size_t)capacity * sizeof(radix_item_t));
+    if (!items) return false;
+    heap->items[b] = items;
+    heap->capacity[b] = capacity;
+  }
+  heap->items[b][heap->count[b]++] = item;
+  return true;
+}
+
+static bool radix_push(radix_heap_t* heap, unsigned key, int vertex) {
+  const radix_item_t item = {key, vertex};
+  if (!radix_append(heap, radix_bucket(heap, key), item)) return false;
+  heap->size++;
+  return true;
+}
+
+/**
+ * @brief removes an item of smallest key. When bucket 0 is empty, the
+ * smallest key of the first non-empty bucket becomes last and the bucket is
+ * spread over the lower buckets.
+ * @return false if memory allocation failed
+ */
+static bool radix_pop(radix_heap_t* heap, radix_item_t* top) {
+  if (heap->count[0] == 0) {
+    int b = 1;
+    while (heap->count[b] == 0) b++;
+    const radix_item_t* items = heap->items[b];
+    const int count = heap->count[b];
+    heap->last = items[0].key;
+    for (int i = 1; i < count; i++) {
+      if (items[i].key < heap->last) heap->last = items[i].key;
+    }
+    heap->count[b] = 0;
+    for (int i = 0; i < count; i++) {
+      if (!radix_append(heap, radix_bucket(heap, items[i].key), items[i])) {
+        return false;
+      }
+    }
+  }
+  *top = heap->items[0][--heap->count[0]];
+  heap->size--;
+  return true;
+}
+
+/**
+ * @brief Dijkstra with a radix heap
+ * @return false if memory allocation failed
+ */
+static bool dijkstra_radix(const csr_graph_t* graph, int source, int target,
+                           int* dist, int* pred) {
+  radix_heap_t heap = {0};
+  initialize_distances(graph->size, source, dist, pred);
+  bool ok = radix_push(&heap, 0, source);
+  while (ok && heap.size > 0) {
+    radix_item_t top;
+    ok = radix_pop(&heap, &top);
+    if (!ok || top.key != (unsigned)dist[top.vertex]) continue;
+    const int u = top.vertex;
+    if (u == target) break;
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1] && ok; e++) {
+      const int v = graph->targets[e];
+      if (graph->weights[e] <= 0) continue;
+      const int new_dist = dist[u] + graph->weights[e];
+      if (new_dist < dist[v]) {
+        dist[v] = new_dist;
+        if (pred) pred[v] = u;
+        ok = radix_push(&heap, (unsigned)new_dist, v);
+      }
+    }
+  }
+  for (int b = 0; b < RADIX_HEAP_BUCKETS; b++) free(heap.items[b]);
+  return ok;
+}
+
+/**
+ * @brief runs Dijkstra from source with the chosen priority queue, Dial's
+ * buckets only while max_weight + 1 fits SHORTEST_PATH_DIAL_MAX_BUCKETS
+ * @param target the search stops once it is settled, -1 to settle every
+ * reachable vertex
+ * @param dist receives the distances, INT_MAX for unreached vertices
+ * @param pred receives the previous vertex on a shortest path, -1 for the
+ * source and unreached vertices, may be NULL
+ * @return false on an unknown engine or memory allocation failure
+ */
+static bool run_engine(const csr_graph_t* graph, int source, int target,
+                       shortest_path_engine_t engine, int* dist, int* pred) {
+  const int max_weight = csr_graph_max_weight(graph);
+  if (engine == SHORTEST_PATH_ENGINE_AUTO) {
+    engine = max_weight <= SHORTEST_PATH_DIAL_MAX_WEIGHT
+                 ? SHORTEST_PATH_ENGINE_DIAL
+                 : SHORTEST_PATH_ENGINE_RADIX;
+  } else if (engine == SHORTEST_PATH_ENGINE_DIAL &&
+             max_weight >= SHORTEST_PATH_DIAL_MAX_BUCKETS) {
+    // max_weight + 1 buckets would not fit the cap (or int)
+    engine = SHORTEST_PATH_ENGINE_RADIX;
+  }
+  switch (engine) {
+    case SHORTEST_PATH_ENGINE_HEAP:
+      return dijkstra_heap(graph, source, target, dist, pred);
+    case SHORTEST_PATH_ENGINE_DIAL:
+      return dijkstra_dial(graph, source, target, dist, pred);
+    case SHORTEST_PATH_ENGINE_RADIX:
+      return dijkstra_radix(graph, source, target, dist, pred);
+    default:
+      return false;
+  }
+}
+
+/**
+ * Dijkstra’s algorithm over compressed sparse rows, only with positive edges
+ * @brief finds the shortest path with the chosen priority queue: an indexed
+ * 4-ary heap, Dial's buckets for small integer weights or a radix heap for
+ * any int weight. All engines return the same distances.
+ * @param graph csr graph structure pointer
+ * @param engine priority queue, SHORTEST_PATH_ENGINE_AUTO picks it from the
+ * largest edge weight recorded at load time
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_between_vertices_engine(const csr_graph_t* graph,
+                                              int vertex1, int vertex2,
+                                              shortest_path_engine_t engine) {
+  if (!graph || vertex1 < 0 || vertex1 >= graph->size || vertex2 < 0 ||
+      vertex2 >= graph->size) {
+    return -1;
+  }
+  if (vertex1 == vertex2) return 0;
+  int* dist = (int*)malloc((size_t)graph->size * sizeof(int));
+  int result = -1;
+  if (dist && run_engine(graph, vertex1, vertex2, engine, dist, NULL) &&
+      dist[vertex2] != INT_MAX) {
+    result = dist[vertex2];
+  }
+  free(dist);
+  return result;
+}
+
+/**
+ * @brief single-source shortest paths over compressed sparse rows with the
+ * chosen priority queue, one search answers every target
+ * @param graph csr graph structure pointer
+ * @param source start vertex
+ * @param engine priority queue, see get_shortest_path_between_vertices_engine
+ * @param tree shortest-path tree of the same size as the graph, receives
+ * dist and pred of every vertex
+ * @return false on invalid input or memory allocation failure
+ */
+bool get_shortest_path_tree_engine(const csr_graph_t* graph, int source,
+                                   shortest_path_engine_t engine,
+                                   shortest_path_tree_t* tree) {
+  if (!graph || !tree || tree->size != graph->size || source < 0 ||
+      source >= graph->size) {
+    return false;
+  }
+  const bool ok = run_engine(graph, source, -1, engine, tree->dist,
+                             tree->pred);
+  for (int v = 0; ok && v < graph->size; v++) {
+    if (tree->dist[v] == INT_MAX) tree->dist[v] = -1;
+  }
+  tree->source = ok ? source : -1;
+  return ok;
+}
@@ -0,0 +1,100 @@
+#include <vector>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+// few distinct sources, so most groups hold many queries
+std::vector<shortest_path_query_t> RandomQueries(int size, int count,
+                                                 int source_count,
+                                                 unsigned seed) {
+  std::vector<shortest_path_query_t> queries(count);
+  unsigned state = seed;
+  for (shortest_path_query_t& query : queries) {
+    state = state * 1103515245u + 12345u;
+    query.source = (int)((state >> 4) % (unsigned)source_count) * 7 % size;
+    state = state * 1103515245u + 12345u;
+    query.target = (int)((state >> 4) % (unsigned)size);
+  }
+  return queries;
+}
+
+}  // namespace
+
+TEST(BatchShortestPathsTest, MatchesSingleQueries) {
+  csr_graph_t* graph = RandomCsrGraph(2000, 9000, 300, 29u);
+  ASSERT_NE(graph, nullptr);
+  const std::vector<shortest_path_query_t> queries =
+      RandomQueries(graph->size, 5000, 40, 3u);
+  // one reference search per distinct source
+  std::vector<int> expected(queries.size());
+  std::vector<std::vector<int>> reference(graph->size);
+  for (size_t q = 0; q < queries.size(); q++) {
+    std::vector<int>& dist = reference[queries[q].source];
+    if (dist.empty()) {
+      dist = ReferenceDijkstraDistances(graph, queries[q].source);
+    }
+    expected[q] = dist[queries[q].target];
+  }
+  thread_pool_t* pool = thread_pool_create(4);
+  ASSERT_NE(pool, nullptr);
+  std::vector<int> results(queries.size(), -2);
+  ASSERT_TRUE(get_shortest_paths_batch(graph, queries.data(),
+                                       (int)queries.size(), pool,
+                                       results.data()));
+  EXPECT_EQ(results, expected);
+  results.assign(queries.size(), -2);
+  ASSERT_TRUE(get_shortest_paths_batch(graph, queries.data(),
+                                       (int)queries.size(), nullptr,
+                                       results.data()));
+  EXPECT_EQ(results, expected);
+  thread_pool_delete(pool);
+  csr_graph_delete(graph);
+}
+
+TEST(BatchShortestPathsTest, MatchesMatrixDijkstra) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt"));
+  GraphAlgorithmsWrapper algorithms;
+  std::vector<shortest_path_query_t> queries;
+  for (int source = graph.getOrder() - 1; source >= 0; source--) {
+    for (int target = 0; target < graph.getOrder(); target++) {
+      queries.push_back({source, target});
+    }
+  }
+  std::vector<int> results(queries.size());
+  thread_pool_t* pool = thread_pool_create(3);
+  ASSERT_NE(pool, nullptr);
+  ASSERT_TRUE(get_shortest_paths_batch(graph.getCsrGraph(), queries.data(),
+                                       (int)queries.size(), pool,
+                                       results.data()));
+  for (size_t q = 0; q < queries.size(); q++) {
+    EXPECT_EQ(results[q],
+              algorithms.getShortestPathBetweenVertices(
+                  graph, queries[q].source, queries[q].target));
+  }
+  thread_pool_delete(pool);
+}
+
+TEST(BatchShortestPathsTest, InvalidQueriesAndInput) {
+  const int sources[] = {0, 1, 2};
+  const int targets[] = {1, 2, 0};
+  const int weights[] = {4, 6, 0};
+  csr_graph_t* graph = csr_graph_from_edges(4, 3, sources, targets, weights);
+  ASSERT_NE(graph, nullptr);
+  const shortest_path_query_t queries[] = {
+      {0, 2}, {2, 0}, {-1, 1}, {1, 4}, {3, 3}, {0, 1}};
+  std::vector<int> results(6, -2);
+  ASSERT_TRUE(
+      get_shortest_paths_batch(graph, queries, 6, nullptr, results.data()));
+  EXPECT_EQ(results, std::vector<int>({10, -1, -1, -1, 0, 4}));
+  EXPECT_TRUE(get_shortest_paths_batch(graph, nullptr, 0, nullptr, nullptr));
+  EXPECT_FALSE(
+      get_shortest_paths_batch(graph, queries, -1, nullptr, results.data()));
+  EXPECT_FALSE(get_shortest_paths_batch(graph, queries, 6, nullptr, nullptr));
+  EXPECT_FALSE(
+      get_shortest_paths_batch(nullptr, queries, 6, nullptr, results.data()));
+  csr_graph_delete(graph);
+}
@@ -0,0 +1,51 @@
+#include <vector>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+TEST(BidirectionalDijkstraTest, DirectedGraphMatchesDijkstra) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 150, 3, false, 8u);
+  GraphAlgorithmsWrapper algorithms;
+  csr_graph_t* reverse = csr_graph_transpose(graph.getCsrGraph());
+  ASSERT_NE(reverse, nullptr);
+  for (int from = 0; from < graph.getOrder(); from += 3) {
+    for (int to = 0; to < graph.getOrder(); to++) {
+      ASSERT_EQ(get_shortest_path_bidirectional(graph.getCsrGraph(), reverse,
+                                                from, to),
+                algorithms.getShortestPathBetweenVertices(graph, from, to))
+          << from << " -> " << to;
+    }
+  }
+  csr_graph_delete(reverse);
+}
+
+TEST(BidirectionalDijkstraTest, SymmetricGraphWithoutReverse) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 120, 4, true, 21u);
+  GraphAlgorithmsWrapper algorithms;
+  for (int from = 0; from < graph.getOrder(); from += 5) {
+    for (int to = 0; to < graph.getOrder(); to++) {
+      ASSERT_EQ(get_shortest_path_bidirectional(graph.getCsrGraph(), nullptr,
+                                                from, to),
+                algorithms.getShortestPathBetweenVertices(graph, from, to));
+    }
+  }
+}
+
+TEST(BidirectionalDijkstraTest, NoPathAndInvalidInput) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt");
+  csr_graph_t* csr = graph.getCsrGraph();
+  EXPECT_EQ(get_shortest_path_bidirectional(csr, nullptr, 0, 3), -1);
+  EXPECT_EQ(get_shortest_path_bidirectional(csr, nullptr, 4, 4), 0);
+  EXPECT_EQ(get_shortest_path_bidirectional(csr, nullptr, -1, 2), -1);
+  EXPECT_EQ(get_shortest_path_bidirectional(nullptr, nullptr, 0, 1), -1);
+
+  GraphWrapper other;
+  other.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/weighted_graph.txt");
+  EXPECT_EQ(
+      get_shortest_path_bidirectional(csr, other.getCsrGraph(), 0, 1), -1);
+}
@@ -0,0 +1,62 @@
+#include <vector>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+TEST(DeltaSteppingTest, MatchesDijkstraForEveryDelta) {
+  csr_graph_t* graph = RandomCsrGraph(3000, 20000, 100, 17u);
+  ASSERT_NE(graph, nullptr);
+  thread_pool_t* pool = thread_pool_create(4);
+  ASSERT_NE(pool, nullptr);
+  std::vector<int> dist(graph->size);
+  for (int source : {0, 1234, 2999}) {
+    const std::vector<int> expected = ReferenceDijkstraDistances(graph, source);
+    for (int delta : {0, 1, 7, 50, 100, 1000000}) {
+      ASSERT_TRUE(shortest_paths_delta_stepping(graph, source, delta, pool,
+                                                dist.data()));
+      ASSERT_EQ(dist, expected) << "delta " << delta;
+      ASSERT_TRUE(shortest_paths_delta_stepping(graph, source, delta, nullptr,
+                                                dist.data()));
+      ASSERT_EQ(dist, expected) << "delta " << delta << " without pool";
+    }
+  }
+  thread_pool_delete(pool);
+  csr_graph_delete(graph);
+}
+
+TEST(DeltaSteppingTest, UnreachedVerticesAndNonPositiveEdges) {
+  const int sources[] = {0, 1, 0, 3, 4};
+  const int targets[] = {1, 2, 3, 4, 5};
+  const int weights[] = {5, 2, -4, 1, 1};
+  csr_graph_t* graph = csr_graph_from_edges(7, 5, sources, targets, weights);
+  ASSERT_NE(graph, nullptr);
+  thread_pool_t* pool = thread_pool_create(2);
+  ASSERT_NE(pool, nullptr);
+  std::vector<int> dist(7);
+  ASSERT_TRUE(
+      shortest_paths_delta_stepping(graph, 0, 0, pool, dist.data()));
+  EXPECT_EQ(dist, std::vector<int>({0, 5, 7, -1, -1, -1, -1}));
+
+  EXPECT_FALSE(shortest_paths_delta_stepping(graph, 7, 1, pool, dist.data()));
+  EXPECT_FALSE(shortest_paths_delta_stepping(graph, 0, 1, pool, nullptr));
+  EXPECT_FALSE(
+      shortest_paths_delta_stepping(nullptr, 0, 1, pool, dist.data()));
+  thread_pool_delete(pool);
+  csr_graph_delete(graph);
+}
+
+TEST(DeltaSteppingTest, MatchesMatrixDijkstra) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/graph_examples.txt"));
+  GraphAlgorithmsWrapper algorithms;
+  std::vector<int> dist(graph.getOrder());
+  for (int source = 0; source < graph.getOrder(); source++) {
+    ASSERT_TRUE(shortest_paths_delta_stepping(graph.getCsrGraph(), source, 3,
+                                              nullptr, dist.data()));
+    for (int target = 0; target < graph.getOrder(); target++) {
+      EXPECT_EQ(dist[target], algorithms.getShortestPathBetweenVertices(
+                                  graph, source, target));
+    }
+  }
+}
@@ -1,3 +1,5 @@
+#include <climits>
+
 #include "../../../test/main_test.h"
 #include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
 
@@ -84,3 +86,190 @@ TEST(GraphAlgorithmsTest, AboveDescribedGraphExamples) {
 
   ASSERT_EQ(distance1, 18);
 }
+
+TEST(GraphAlgorithmsTest, ShortestPathBetweenVerticesCsr_MatchesMatrix) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/graph_examples.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  for (int from = 0; from < graph.getOrder(); from++) {
+    for (int to = 0; to < graph.getOrder(); to++) {
+      ASSERT_EQ(algorithms.getShortestPathBetweenVerticesCsr(graph, from, to),
+                algorithms.getShortestPathBetweenVertices(graph, from, to));
+    }
+  }
+}
+
+TEST(GraphAlgorithmsTest, ShortestPathBetweenVerticesCsr_NoPathAndInvalid) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  ASSERT_EQ(algorithms.getShortestPathBetweenVerticesCsr(graph, 0, 3), -1);
+  ASSERT_EQ(algorithms.getShortestPathBetweenVerticesCsr(graph, -1, 3), -1);
+}
+
+TEST(GraphAlgorithmsTest, ShortestPathBetweenVerticesCsr_RandomDirected) {
+  const int kSize = 120;
+  GraphAlgorithmsWrapper algorithms;
+  for (int percent : {2, 10, 60}) {
+    GraphWrapper graph;
+    FillRandomGraph(graph, kSize, percent, false, 4242u + percent, 30);
+    for (int from = 0; from < kSize; from += 7) {
+      for (int to = 0; to < kSize; to++) {
+        ASSERT_EQ(algorithms.getShortestPathBetweenVerticesCsr(graph, from, to),
+                  algorithms.getShortestPathBetweenVertices(graph, from, to))
+            << percent << "% " << from << " -> " << to;
+      }
+    }
+  }
+}
+
+TEST(GraphAlgorithmsTest, ShortestPathEngines_MatchMatrix) {
+  const int kSize = 90;
+  const shortest_path_engine_t kEngines[] = {
+      SHORTEST_PATH_ENGINE_AUTO, SHORTEST_PATH_ENGINE_HEAP,
+      SHORTEST_PATH_ENGINE_DIAL, SHORTEST_PATH_ENGINE_RADIX};
+  GraphAlgorithmsWrapper algorithms;
+  for (int max_weight : {1, 7, 1000, 2000000}) {
+    GraphWrapper graph;
+    FillRandomGraph(graph, kSize, 8, false, 77u + max_weight, max_weight);
+    csr_graph_t* csr = graph.getCsrGraph();
+    for (int from = 0; from < kSize; from += 5) {
+      for (int to = 0; to < kSize; to++) {
+        const int expected =
+            algorithms.getShortestPathBetweenVertices(graph, from, to);
+        // Dial on 2000000 falls back to the radix heap
+        for (shortest_path_engine_t engine : kEngines) {
+          ASSERT_EQ(get_shortest_path_between_vertices_engine(csr, from, to,
+                                                              engine),
+                    expected)
+              << "engine " << engine << ", max weight " << max_weight;
+        }
+      }
+    }
+  }
+}
+
+TEST(GraphAlgorithmsTest, ShortestPathEngines_DialWithHugeWeights) {
+  const int sources[] = {0, 1, 0};
+  const int targets[] = {1, 2, 2};
+  const int weights[] = {INT_MAX / 2, 1, INT_MAX};
+  csr_graph_t* graph = csr_graph_from_edges(3, 3, sources, targets, weights);
+  ASSERT_NE(graph, nullptr);
+  EXPECT_EQ(get_shortest_path_between_vertices_engine(
+                graph, 0, 2, SHORTEST_PATH_ENGINE_DIAL),
+            INT_MAX / 2 + 1);
+  shortest_path_tree_t* tree = shortest_path_tree_create(3);
+  ASSERT_NE(tree, nullptr);
+  ASSERT_TRUE(get_shortest_path_tree_engine(graph, 0,
+                                            SHORTEST_PATH_ENGINE_DIAL, tree));
+  EXPECT_EQ(tree->dist[1], INT_MAX / 2);
+  EXPECT_EQ(tree->pred[2], 1);
+  shortest_path_tree_delete(tree);
+  csr_graph_delete(graph);
+}
+
+TEST(GraphAlgorithmsTest, ShortestPathEngines_InvalidInput) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/weighted_graph.txt");
+  csr_graph_t* csr = graph.getCsrGraph();
+  EXPECT_EQ(get_shortest_path_between_vertices_engine(
+                csr, 0, 2, (shortest_path_engine_t)42),
+            -1);
+  EXPECT_EQ(get_shortest_path_between_vertices_engine(
+                csr, 0, 9, SHORTEST_PATH_ENGINE_DIAL),
+            -1);
+  EXPECT_EQ(get_shortest_path_between_vertices_engine(
+                nullptr, 0, 1, SHORTEST_PATH_ENGINE_RADIX),
+            -1);
+  EXPECT_EQ(get_shortest_path_between_vertices_engine(
+                csr, 1, 1, SHORTEST_PATH_ENGINE_HEAP),
+            0);
+}
+
+namespace {
+
+/**
+ * @brief checks a tree against point-to-point queries and that every
+ * predecessor edge is tight
+ */
+void ExpectShortestPathTree(GraphWrapper& graph, int source,
+                            const shortest_path_tree_t* tree) {
+  GraphAlgorithmsWrapper algorithms;
+  std::vector<int> path(graph.getOrder());
+  ASSERT_EQ(tree->source, source);
+  for (int v = 0; v < graph.getOrder(); v++) {
+    ASSERT_EQ(tree->dist[v],
+              algorithms.getShortestPathBetweenVertices(graph, source, v));
+    const int length = shortest_path_tree_path(tree, v, path.data());
+    if (tree->dist[v] < 0) {
+      EXPECT_EQ(length, -1);
+      EXPECT_EQ(tree->pred[v], -1);
+      continue;
+    }
+    ASSERT_GE(length, 1);
+    EXPECT_EQ(path[0], source);
+    EXPECT_EQ(path[length - 1], v);
+    int walked = 0;
+    for (int i = 1; i < length; i++) {
+      const int weight = graph.getMatrixValue(path[i - 1], path[i]);
+      ASSERT_GT(weight, 0);
+      walked += weight;
+    }
+    EXPECT_EQ(walked, tree->dist[v]);
+  }
+}
+
+}  // namespace
+
+TEST(GraphAlgorithmsTest, ShortestPathTree_MatchesPointQueries) {
+  const int kSize = 80;
+  GraphWrapper graph;
+  FillRandomGraph(graph, kSize, 6, false, 2024u, 500);
+  shortest_path_tree_t* tree = shortest_path_tree_create(kSize);
+  ASSERT_NE(tree, nullptr);
+  for (int source = 0; source < kSize; source += 9) {
+    ASSERT_TRUE(get_shortest_path_tree(graph.getGraph(), source, tree));
+    ExpectShortestPathTree(graph, source, tree);
+    ASSERT_TRUE(get_shortest_path_tree_csr(graph.getCsrGraph(), source, tree));
+    ExpectShortestPathTree(graph, source, tree);
+    for (shortest_path_engine_t engine :
+         {SHORTEST_PATH_ENGINE_HEAP, SHORTEST_PATH_ENGINE_DIAL,
+          SHORTEST_PATH_ENGINE_RADIX}) {
+      ASSERT_TRUE(get_shortest_path_tree_engine(graph.getCsrGraph(), source,
+                                                engine, tree));
+      ExpectShortestPathTree(graph, source, tree);
+    }
+  }
+  shortest_path_tree_delete(tree);
+}
+
+TEST(GraphAlgorithmsTest, ShortestPathTree_InvalidInput) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt");
+  shortest_path_tree_t* tree = shortest_path_tree_create(graph.getOrder());
+  shortest_path_tree_t* small = shortest_path_tree_create(2);
+  ASSERT_NE(tree, nullptr);
+  ASSERT_NE(small, nullptr);
+  EXPECT_FALSE(get_shortest_path_tree(graph.getGraph(), -1, tree));
+  EXPECT_FALSE(get_shortest_path_tree(graph.getGraph(), 0, small));
+  EXPECT_FALSE(get_shortest_path_tree_csr(graph.getCsrGraph(), 0, small));
+  EXPECT_FALSE(get_shortest_path_tree_engine(
+      graph.getCsrGraph(), 0, (shortest_path_engine_t)9, tree));
+  EXPECT_EQ(tree->source, -1);
+  EXPECT_EQ(shortest_path_tree_create(-1), nullptr);
+
+  ASSERT_TRUE(get_shortest_path_tree(graph.getGraph(), 3, tree));
+  std::vector<int> path(graph.getOrder());
+  EXPECT_EQ(shortest_path_tree_path(tree, 0, path.data()), -1);
+  EXPECT_EQ(shortest_path_tree_path(tree, graph.getOrder(), path.data()), -1);
+  ASSERT_EQ(shortest_path_tree_path(tree, 3, path.data()), 1);
+  EXPECT_EQ(path[0], 3);
+  shortest_path_tree_delete(small);
+  shortest_path_tree_delete(tree);
+}
@@ -22,8 +22,9 @@ static void find_min_edge(graph_t* graph, const int* visited, int vertex_count,
   *dest = -1;
   for (int i = 0; i < vertex_count; i++) {
     if (visited[i]) {
+      const int* row = matrix_row(graph->adjacency, i);
       for (int j = 0; j < vertex_count; j++) {
-        int weight = graph->adjacency->data[i][j];
+        int weight = row[j];
         if (!visited[j] && weight != 0 && weight < *min_weight) {
           *min_weight = weight;
           *src = i;
@@ -65,3 +66,172 @@ int get_least_spanning_tree(graph_t* graph, int** mst) {
   free(visited);
   return 0;
 }
+
+/**
+ * @brief lowers the keys of the unvisited out-neighbours of a new tree vertex
+ * ties prefer the smaller parent, as the matrix version scans sources in order
+ */
+static void relax_tree_edges(const csr_graph_t* graph, int u,
+                             const int* visited, int* key, int* parent) {
+  for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+    const int v = graph->targets[e];
+    const int weight = graph->weights[e];
+    if (!visited[v] &&
+        (parent[v] == -1 || weight < key[v] ||
+         (weight == key[v] && u < parent[v]))) {
+      key[v] = weight;
+      parent[v] = u;
+    }
+  }
+}
+
+static int find_min_key_vertex(const int* visited, const int* key,
+                               const int* parent, int vertex_count) {
+  int best = -1;
+  for (int v = 0; v < vertex_count; v++) {
+    if (!visited[v] && parent[v] != -1 &&
+        (best == -1 || key[v] < key[best] ||
+         (key[v] == key[best] && parent[v] < parent[best]))) {
+      best = v;
+    }
+  }
+  return best;
+}
+
+/**
+ * Minimum Spanning Tree (Prim's algorithm) over compressed sparse rows
+ * @brief finds the same tree as get_least_spanning_tree in O(V² + E)
+ * @param graph csr graph pointer
+ * @param mst result matrix of mst
+ * @return 0 = success 1 = error
+ */
+int get_least_spanning_tree_csr(const csr_graph_t* graph, int** mst) {
+  if (!graph || !mst || graph->size <= 0) {
+    return 1;
+  }
+  const int vertex_count = graph->size;
+  int* visited = (int*)calloc(vertex_count, sizeof(int));
+  int* key = (int*)malloc(vertex_count * sizeof(int));
+  int* parent = (int*)malloc(vertex_count * sizeof(int));
+  int status = (visited && key && parent) ? 0 : 1;
+  if (status == 0) {
+    init_mst_matrix(mst, vertex_count);
+    for (int v = 0; v < vertex_count; v++) parent[v] = -1;
+    visited[0] = 1;
+    relax_tree_edges(graph, 0, visited, key, parent);
+  }
+  for (int e = 0; status == 0 && e < vertex_count - 1; e++) {
+    const int dest = find_min_key_vertex(visited, key, parent, vertex_count);
+    if (dest == -1) {
+      status = 1;
+    } else {
+      mst[parent[dest]][dest] = key[dest];
+      mst[dest][parent[dest]] = key[dest];
+      visited[dest] = 1;
+      relax_tree_edges(graph, dest, visited, key, parent);
+    }
+  }
+  free(visited);
+  free(key);
+  free(parent);
+  return status;
+}
+
+/**
+ * Minimum Spanning Tree (Prim's algorithm) with scratch taken from an arena
+ * @brief finds the same tree as get_least_spanning_tree without heap
+ * allocation
+ * @param graph structure of the graph pointer
+ * @param mst result matrix of mst
+ * @param arena scratch memory, everything taken from it is released on return
+ * @return 0 = success 1 = error
+ */
+int get_least_spanning_tree_arena(graph_t* graph, int** mst, arena_t* arena) {
+  if (validate_mst_input(graph, mst) || !arena) {
+    return 1;
+  }
+  const int vertex_count = graph->adjacency->size;
+  const arena_mark_t mark = arena_mark(arena);
+  int* visited = (int*)arena_calloc(arena, (size_t)vertex_count, sizeof(int));
+  int status = visited ? 0 : 1;
+  if (status == 0) {
+    init_mst_matrix(mst, vertex_count);
+    visited[0] = 1;
+  }
+  for (int e = 0; status == 0 && e < vertex_count - 1; e++) {
+    int min_weight, src, dest;
+    find_min_edge(graph, visited, vertex_count, &min_weight, &src, &dest);
+    if (src == -1 || dest == -1) {
+      status = 1;
+    } else {
+      mst[src][dest] = min_weight;
+      mst[dest][src] = min_weight;
+      visited[dest] = 1;
+    }
+  }
+  arena_release(arena, mark);
+  return status;
+}
+
+/**
+ * @brief lowers the keys of the out-neighbours of a new tree vertex kept in
+ * the workspace, ties prefer the smaller parent like find_min_edge
+ */
+static void relax_workspace_edges(graph_workspace_t* workspace, int u) {
+  const int* row = matrix_row(workspace->graph->adjacency, u);
+  for (int v = 0; v < workspace->size; v++) {
+    const int weight = row[v];
+    if (weight == 0 || workspace_is_visited(workspace, v)) continue;
+    if (!workspace_is_reached(workspace, v) || weight < workspace->dist[v] ||
+        (weight == workspace->dist[v] && u < workspace->parent[v])) {
+      workspace_reach(workspace, v);
+      workspace->dist[v] = weight;
+      workspace->parent[v] = u;
+    }
+  }
+}
+
+/**
+ * Minimum Spanning Tree (Prim's algorithm) reusing the buffers of a workspace
+ * @brief finds the same tree as get_least_spanning_tree with per-vertex keys,
+ * O(V^2) instead of rescanning every tree vertex for each edge
+ * @param workspace workspace of the graph
+ * @param mst result matrix of mst
+ * @return 0 = success 1 = error
+ */
+int get_least_spanning_tree_with_workspace(graph_workspace_t* workspace,
+                                           int** mst) {
+  if (!graph_workspace_begin(workspace) ||
+      validate_mst_input(workspace->graph, mst)) {
+    return 1;
+  }
+  const int vertex_count = workspace->size;
+  init_mst_matrix(mst, vertex_count);
+  workspace_visit(workspace, 0);
+  relax_workspace_edges(workspace, 0);
+  int status = 0;
+  for (int e = 0; status == 0 && e < vertex_count - 1; e++) {
+    int dest = -1;
+    for (int v = 0; v < vertex_count; v++) {
+      if (workspace_is_visited(workspace, v) ||
+          !workspace_is_reached(workspace, v)) {
+        continue;
+      }
+      if (dest == -1 || workspace->dist[v] < workspace->dist[dest] ||
+          (workspace->dist[v] == workspace->dist[dest] &&
+           workspace->parent[v] < workspace->parent[dest])) {
+        dest = v;
+      }
+    }
+    if (dest == -1) {
+      status = 1;
+    } else {
+      const int src = workspace->parent[dest];
+      mst[src][dest] = workspace->dist[dest];
+      mst[dest][src] = workspace->dist[dest];
+      workspace_visit(workspace, dest);
+      relax_workspace_edges(workspace, dest);
+    }
+  }
+  return status;
+}
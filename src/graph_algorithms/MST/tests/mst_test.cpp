@@ -121,3 +121,28 @@ TEST(PrimAlgorithmTest, NegativeWeights) {
   ASSERT_EQ((int)result[2][3], 0);
   ASSERT_EQ(0, 0);
 }
+
+TEST(PrimAlgorithmTest, CsrMatchesMatrix) {
+  const char* kFiles[] = {
+      "../datasets/incidence_matrix_src/prim_basic.txt",
+      "../datasets/incidence_matrix_src/prim_complex.txt",
+      "../datasets/incidence_matrix_src/prim_equal_weights.txt",
+      "../datasets/incidence_matrix_src/prim_negative_weights.txt"};
+  GraphAlgorithmsWrapper algorithms;
+  for (const char* file : kFiles) {
+    GraphWrapper graph;
+    ASSERT_TRUE(graph.loadGraphFromFile(file));
+    ASSERT_EQ(algorithms.getLeastSpanningTreeCsr(graph),
+              algorithms.getLeastSpanningTree(graph))
+        << file;
+  }
+}
+
+TEST(PrimAlgorithmTest, CsrDisconnectedGraph) {
+  GraphWrapper graph;
+  graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt");
+
+  GraphAlgorithmsWrapper algorithms;
+  ASSERT_TRUE(algorithms.getLeastSpanningTreeCsr(graph).empty());
+}
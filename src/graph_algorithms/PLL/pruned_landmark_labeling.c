@@ -0,0 +1,529 @@
+#include "pruned_landmark_labeling.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../graph/binary/graph_binary.h"
+#include "../data_structures/indexed_heap/indexed_heap.h"
+
+_Static_assert(sizeof(pruned_landmark_labeling_header_t) == 64,
+               "pruned landmark labeling header must not contain padding");
+
+#define PRUNED_LANDMARK_LABELING_SECTIONS 7
+
+/**
+ * @brief label of one vertex while the index is built, hubs ascending
+ */
+typedef struct {
+  int *hubs;
+  int *dists;
+  int count;
+  int capacity;
+} label_list_t;
+
+/**
+ * @brief state of the preprocessing
+ * @param rank search order of every vertex
+ * @param out out labels found so far
+ * @param in in labels found so far
+ * @param dist distances of the current search, valid where stamp equals
+ * generation
+ * @param root_dist distance between the root and every hub of its label,
+ * indexed by hub rank, INT_MAX elsewhere
+ */
+typedef struct {
+  int size;
+  int *rank;
+  label_list_t *out;
+  label_list_t *in;
+  indexed_heap_t *heap;
+  int *dist;
+  unsigned *stamp;
+  unsigned generation;
+  int *root_dist;
+} labeling_builder_t;
+
+typedef struct {
+  int degree;
+  int vertex;
+} degree_key_t;
+
+static bool label_list_append(label_list_t *list, int hub, int dist) {
+  if (list->count == list->capacity) {
+    const int capacity = list->capacity > 0 ? list->capacity * 2 : 4;
+    int *hubs = (int *)realloc(list->hubs, (size_t)capacity * sizeof(int));
+    if (!hubs) return false;
+    list->hubs = hubs;
+    int *dists = (int *)realloc(list->dists, (size_t)capacity * sizeof(int));
+    if (!dists) return false;
+    list->dists = dists;
+    list->capacity = capacity;
+  }
+  list->hubs[list->count] = hub;
+  list->dists[list->count] = dist;
+  list->count++;
+  return true;
+}
+
+static void label_lists_free(label_list_t *lists, int size) {
+  if (lists) {
+    for (int v = 0; v < size; v++) {
+      free(lists[v].hubs);
+      free(lists[v].dists);
+    }
+    free(lists);
+  }
+}
+
+/**
+ * @brief allocates the offsets and one block holding the hubs and the dists,
+ * each section starting on a PRUNED_LANDMARK_LABELING_ALIGNMENT boundary
+ */
+static bool landmark_labels_alloc(landmark_labels_t *labels, int size,
+                                  int entry_count) {
+  const size_t alignment = PRUNED_LANDMARK_LABELING_ALIGNMENT;
+  const size_t section =
+      ((size_t)entry_count * sizeof(int) + alignment - 1) / alignment *
+      alignment;
+  labels->entry_count = entry_count;
+  labels->offsets = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  labels->block = malloc(2 * section + alignment);
+  if (labels->block) {
+    const uintptr_t aligned = ((uintptr_t)labels->block + alignment - 1) &
+                              ~(uintptr_t)(alignment - 1);
+    labels->hubs = (int *)((unsigned char *)labels->block +
+                           (aligned - (uintptr_t)labels->block));
+    labels->dists = (int *)((unsigned char *)labels->hubs + section);
+  }
+  return labels->offsets && labels->block;
+}
+
+static void landmark_labels_free(landmark_labels_t *labels) {
+  free(labels->offsets);
+  free(labels->block);
+}
+
+static int compare_degree_keys(const void *a, const void *b) {
+  const degree_key_t *left = (const degree_key_t *)a;
+  const degree_key_t *right = (const degree_key_t *)b;
+  if (left->degree != right->degree) {
+    return left->degree > right->degree ? -1 : 1;
+  }
+  return (left->vertex > right->vertex) - (left->vertex < right->vertex);
+}
+
+/**
+ * @brief search order: highest in + out degree first, hubs of many shortest
+ * paths are found early and prune the later searches the most
+ */
+static bool degree_order(const csr_graph_t *graph, const csr_graph_t *reverse,
+                         int *order, int *rank) {
+  degree_key_t *keys =
+      (degree_key_t *)malloc(((size_t)graph->size + 1) * sizeof(degree_key_t));
+  if (!keys) return false;
+  for (int v = 0; v < graph->size; v++) {
+    keys[v].degree = csr_degree(graph, v) + csr_degree(reverse, v);
+    keys[v].vertex = v;
+  }
+  qsort(keys, (size_t)graph->size, sizeof(degree_key_t), compare_degree_keys);
+  for (int r = 0; r < graph->size; r++) {
+    order[r] = keys[r].vertex;
+    rank[keys[r].vertex] = r;
+  }
+  free(keys);
+  return true;
+}
+
+/**
+ * @brief true if the labels found so far already give a path of at most
+ * dist between the root and the vertex whose label is given
+ */
+static bool label_covers(const labeling_builder_t *b,
+                         const label_list_t *label, int dist) {
+  for (int i = 0; i < label->count; i++) {
+    const int root_dist = b->root_dist[label->hubs[i]];
+    if (root_dist != INT_MAX && root_dist + label->dists[i] <= dist) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Dijkstra from the root over graph that adds the root as a hub to
+ * the labels of every vertex it settles, except where the labels found so
+ * far already cover the distance; such vertices are not expanded.
+ * Vertices of lower rank are skipped, their own searches covered them.
+ * @param root_label label of the root on the other side, loaded into
+ * root_dist for the cover checks
+ * @param labels labels on the reached side: in labels for a search over
+ * the graph, out labels for one over the transpose
+ */
+static bool pruned_search(labeling_builder_t *b, const csr_graph_t *graph,
+                          int root, const label_list_t *root_label,
+                          label_list_t *labels) {
+  const int root_rank = b->rank[root];
+  for (int i = 0; i < root_label->count; i++) {
+    b->root_dist[root_label->hubs[i]] = root_label->dists[i];
+  }
+  if (++b->generation == 0) {
+    memset(b->stamp, 0, (size_t)b->size * sizeof(unsigned));
+    b->generation = 1;
+  }
+  const unsigned generation = b->generation;
+  indexed_heap_clear(b->heap);
+  b->stamp[root] = generation;
+  b->dist[root] = 0;
+  indexed_heap_push(b->heap, root, 0);
+  bool success = true;
+  while (success && !indexed_heap_is_empty(b->heap)) {
+    const int u = indexed_heap_pop(b->heap);
+    const int dist = b->dist[u];
+    if (label_covers(b, &labels[u], dist)) continue;
+    success = label_list_append(&labels[u], root_rank, dist);
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+      const int v = graph->targets[e];
+      if (graph->weights[e] <= 0 || b->rank[v] < root_rank) continue;
+      const int new_dist = dist + graph->weights[e];
+      if (b->stamp[v] != generation) {
+        b->stamp[v] = generation;
+        b->dist[v] = new_dist;
+        indexed_heap_push(b->heap, v, new_dist);
+      } else if (new_dist < b->dist[v] && indexed_heap_contains(b->heap, v)) {
+        b->dist[v] = new_dist;
+        indexed_heap_decrease(b->heap, v, new_dist);
+      }
+    }
+  }
+  for (int i = 0; i < root_label->count; i++) {
+    b->root_dist[root_label->hubs[i]] = INT_MAX;
+  }
+  return success;
+}
+
+static bool builder_init(labeling_builder_t *b, int size) {
+  memset(b, 0, sizeof(*b));
+  b->size = size;
+  b->rank = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  b->out = (label_list_t *)calloc((size_t)size + 1, sizeof(label_list_t));
+  b->in = (label_list_t *)calloc((size_t)size + 1, sizeof(label_list_t));
+  b->heap = indexed_heap_create(size);
+  b->dist = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  b->stamp = (unsigned *)calloc((size_t)size + 1, sizeof(unsigned));
+  b->root_dist = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  if (b->root_dist) {
+    for (int r = 0; r < size; r++) b->root_dist[r] = INT_MAX;
+  }
+  return b->rank && b->out && b->in && b->heap && b->dist && b->stamp &&
+         b->root_dist;
+}
+
+static void builder_free(labeling_builder_t *b) {
+  free(b->rank);
+  label_lists_free(b->out, b->size);
+  label_lists_free(b->in, b->size);
+  indexed_heap_delete(b->heap);
+  free(b->dist);
+  free(b->stamp);
+  free(b->root_dist);
+}
+
+/**
+ * @brief copies the labels into flat arrays, closing each with a sentinel
+ */
+static bool flatten_labels(const label_list_t *lists, int size,
+                           landmark_labels_t *labels, int *max_label_size) {
+  size_t entry_count = 0;
+  for (int v = 0; v < size; v++) entry_count += (size_t)lists[v].count + 1;
+  if (entry_count > INT_MAX) return false;
+  if (!landmark_labels_alloc(labels, size, (int)entry_count)) return false;
+  int entry = 0;
+  for (int v = 0; v < size; v++) {
+    labels->offsets[v] = entry;
+    memcpy(labels->hubs + entry, lists[v].hubs,
+           (size_t)lists[v].count * sizeof(int));
+    memcpy(labels->dists + entry, lists[v].dists,
+           (size_t)lists[v].count * sizeof(int));
+    entry += lists[v].count;
+    labels->hubs[entry] = PRUNED_LANDMARK_LABELING_SENTINEL;
+    labels->dists[entry] = 0;
+    entry++;
+    if (lists[v].count > *max_label_size) *max_label_size = lists[v].count;
+  }
+  labels->offsets[size] = entry;
+  return true;
+}
+
+static pruned_landmark_labeling_t *labeling_alloc(int size) {
+  pruned_landmark_labeling_t *labeling =
+      (pruned_landmark_labeling_t *)calloc(1,
+                                           sizeof(pruned_landmark_labeling_t));
+  if (!labeling) return NULL;
+  labeling->size = size;
+  labeling->order = (int *)malloc(((size_t)size + 1) * sizeof(int));
+  if (!labeling->order) {
+    free(labeling);
+    labeling = NULL;
+  }
+  return labeling;
+}
+
+/**
+ * @brief builds the 2-hop labels with pruned Dijkstra searches in degree
+ * order, one over the graph and one over its transpose per vertex.
+ * @param graph csr graph pointer, only positive edges count (0 means no
+ * edge); see pruned_landmark_labeling_create_from_file for graph files
+ * @return labeling or NULL if error
+ */
+pruned_landmark_labeling_t *pruned_landmark_labeling_create(
+    const csr_graph_t *graph) {
+  if (!graph) return NULL;
+  pruned_landmark_labeling_t *labeling = labeling_alloc(graph->size);
+  csr_graph_t *reverse = csr_graph_transpose(graph);
+  labeling_builder_t builder;
+  bool success = builder_init(&builder, graph->size) && labeling && reverse &&
+                 degree_order(graph, reverse, labeling->order, builder.rank);
+  for (int r = 0; success && r < graph->size; r++) {
+    const int root = labeling->order[r];
+    success = pruned_search(&builder, graph, root, &builder.out[root],
+                            builder.in) &&
+              pruned_search(&builder, reverse, root, &builder.in[root],
+                            builder.out);
+  }
+  success = success &&
+            flatten_labels(builder.out, graph->size, &labeling->out,
+                           &labeling->max_label_size) &&
+            flatten_labels(builder.in, graph->size, &labeling->in,
+                           &labeling->max_label_size);
+  builder_free(&builder);
+  csr_graph_delete(reverse);
+  if (!success) {
+    pruned_landmark_labeling_delete(labeling);
+    labeling = NULL;
+  }
+  return labeling;
+}
+
+/**
+ * @brief loads a graph file the way the graph module does (binary
+ * containers are mapped, text files parsed) and labels it
+ * @param filename Name of graph file
+ * @return labeling or NULL if error
+ */
+pruned_landmark_labeling_t *pruned_landmark_labeling_create_from_file(
+    const char *filename) {
+  if (!filename) return NULL;
+  csr_graph_t *csr = NULL;
+  if (is_graph_binary_file(filename)) {
+    csr = map_csr_graph_from_binary_file(filename, true);
+  } else {
+    graph_t *graph = graph_create(0);
+    if (graph && load_graph_from_file(graph, filename)) {
+      csr = graph_to_csr(graph);
+    }
+    graph_delete(graph);
+  }
+  pruned_landmark_labeling_t *labeling =
+      csr ? pruned_landmark_labeling_create(csr) : NULL;
+  csr_graph_delete(csr);
+  return labeling;
+}
+
+/**
+ * @brief delete labeling
+ * @param labeling labeling pointer
+ */
+void pruned_landmark_labeling_delete(pruned_landmark_labeling_t *labeling) {
+  if (labeling) {
+    free(labeling->order);
+    landmark_labels_free(&labeling->out);
+    landmark_labels_free(&labeling->in);
+    free(labeling);
+  }
+}
+
+/**
+ * @brief shortest path length from the labels alone: one merge of the out
+ * label of vertex1 with the in label of vertex2, both ascending and closed
+ * by the sentinel, so the loop needs no bounds checks. Returns the same
+ * values as get_shortest_path_between_vertices. The labeling is only read,
+ * any number of threads may query it at once.
+ * @param labeling labeling pointer
+ * @return shortest path length (v1 x v2) or -1 if error
+ */
+int get_shortest_path_labeling(const pruned_landmark_labeling_t *labeling,
+                               int vertex1, int vertex2) {
+  if (!labeling || vertex1 < 0 || vertex1 >= labeling->size || vertex2 < 0 ||
+      vertex2 >= labeling->size) {
+    return -1;
+  }
+  if (vertex1 == vertex2) return 0;
+  const int first = labeling->out.offsets[vertex1];
+  const int second = labeling->in.offsets[vertex2];
+  const int *out_hubs = labeling->out.hubs + first;
+  const int *out_dists = labeling->out.dists + first;
+  const int *in_hubs = labeling->in.hubs + second;
+  const int *in_dists = labeling->in.dists + second;
+  int best = INT_MAX;
+  int i = 0, j = 0;
+  for (;;) {
+    const int out_hub = out_hubs[i], in_hub = in_hubs[j];
+    if (out_hub == in_hub) {
+      if (out_hub == PRUNED_LANDMARK_LABELING_SENTINEL) break;
+      const int dist = out_dists[i] + in_dists[j];
+      if (dist < best) best = dist;
+      i++;
+      j++;
+    } else if (out_hub < in_hub) {
+      i++;
+    } else {
+      j++;
+    }
+  }
+  return best < INT_MAX ? best : -1;
+}
+
+static void labeling_sections(const pruned_landmark_labeling_t *labeling,
+                              graph_binary_section_t *sections) {
+  const landmark_labels_t *sides[2] = {&labeling->out, &labeling->in};
+  sections[0] =
+      (graph_binary_section_t){labeling->order, (size_t)labeling->size};
+  for (int s = 0; s < 2; s++) {
+    const size_t entries = (size_t)sides[s]->entry_count;
+    sections[1 + 3 * s] = (graph_binary_section_t){
+        sides[s]->offsets, (size_t)labeling->size + 1};
+    sections[2 + 3 * s] = (graph_binary_section_t){sides[s]->hubs, entries};
+    sections[3 + 3 * s] = (graph_binary_section_t){sides[s]->dists, entries};
+  }
+}
+
+/**
+ * @brief save labeling, meant to be kept next to the graph file it was
+ * built from
+ * @param labeling labeling pointer
+ * @param filename Name of file
+ * @return true if success false if error
+ */
+bool save_pruned_landmark_labeling_to_file(
+    const pruned_landmark_labeling_t *labeling, const char *filename) {
+  if (!labeling || !filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return false;
+  }
+  graph_binary_section_t sections[PRUNED_LANDMARK_LABELING_SECTIONS];
+  labeling_sections(labeling, sections);
+  pruned_landmark_labeling_header_t header;
+  memset(&header, 0, sizeof(header));
+  graph_binary_section_prefix_init(&header.prefix,
+                                   PRUNED_LANDMARK_LABELING_MAGIC,
+                                   PRUNED_LANDMARK_LABELING_VERSION);
+  header.vertex_count = labeling->size;
+  header.out_entry_count = labeling->out.entry_count;
+  header.in_entry_count = labeling->in.entry_count;
+  header.max_label_size = labeling->max_label_size;
+  header.checksum = graph_binary_sections_checksum(
+      sections, PRUNED_LANDMARK_LABELING_SECTIONS);
+  return graph_binary_write_sections(filename, &header, sizeof(header),
+                                     sections,
+                                     PRUNED_LANDMARK_LABELING_SECTIONS);
+}
+
+static bool validate_labeling_header(
+    const pruned_landmark_labeling_header_t *header) {
+  return header->vertex_count >= 0 && header->vertex_count < INT_MAX &&
+         header->out_entry_count >= header->vertex_count &&
+         header->out_entry_count < INT_MAX &&
+         header->in_entry_count >= header->vertex_count &&
+         header->in_entry_count < INT_MAX && header->max_label_size >= 0 &&
+         header->max_label_size <= header->vertex_count;
+}
+
+/**
+ * @brief checks that every label of a loaded side is closed by the
+ * sentinel and holds ascending hub ranks in range, so a damaged file can not
+ * make a query read out of bounds or loop
+ */
+static bool validate_loaded_labels(const landmark_labels_t *labels, int size,
+                                   int max_label_size) {
+  bool valid = labels->offsets[0] == 0 &&
+               labels->offsets[size] == labels->entry_count;
+  for (int v = 0; valid && v < size; v++) {
+    const int begin = labels->offsets[v], end = labels->offsets[v + 1];
+    valid = begin < end && end - begin - 1 <= max_label_size &&
+            labels->hubs[end - 1] == PRUNED_LANDMARK_LABELING_SENTINEL;
+    for (int e = begin; valid && e < end - 1; e++) {
+      valid = labels->hubs[e] >= 0 && labels->hubs[e] < size &&
+              (e == begin || labels->hubs[e - 1] < labels->hubs[e]) &&
+              labels->dists[e] >= 0;
+    }
+  }
+  return valid;
+}
+
+static bool validate_loaded_order(const int *order, int size) {
+  bool *seen = (bool *)calloc((size_t)size + 1, sizeof(bool));
+  bool valid = seen != NULL;
+  for (int r = 0; valid && r < size; r++) {
+    valid = order[r] >= 0 && order[r] < size && !seen[order[r]];
+    if (valid) seen[order[r]] = true;
+  }
+  free(seen);
+  return valid;
+}
+
+/**
+ * @brief load labeling saved by save_pruned_landmark_labeling_to_file, the
+ * checksum is always verified
+ * @param filename Name of file
+ * @return labeling or NULL if error
+ */
+pruned_landmark_labeling_t *load_pruned_landmark_labeling_from_file(
+    const char *filename) {
+  if (!filename) {
+    fprintf(stderr, "Invalid input parameters\n");
+    return NULL;
+  }
+  FILE *file = fopen(filename, "rb");
+  if (!file) {
+    fprintf(stderr, "Failed to open file: %s\n", filename);
+    return NULL;
+  }
+  pruned_landmark_labeling_header_t header;
+  pruned_landmark_labeling_t *labeling = NULL;
+  bool success =
+      graph_binary_read_section_header(file, PRUNED_LANDMARK_LABELING_MAGIC,
+                                       PRUNED_LANDMARK_LABELING_VERSION,
+                                       &header, sizeof(header)) &&
+      validate_labeling_header(&header);
+  if (success) {
+    labeling = labeling_alloc((int)header.vertex_count);
+    success = labeling &&
+              landmark_labels_alloc(&labeling->out, labeling->size,
+                                    (int)header.out_entry_count) &&
+              landmark_labels_alloc(&labeling->in, labeling->size,
+                                    (int)header.in_entry_count);
+  }
+  graph_binary_section_t sections[PRUNED_LANDMARK_LABELING_SECTIONS];
+  if (success) {
+    labeling->max_label_size = (int)header.max_label_size;
+    labeling_sections(labeling, sections);
+  }
+  success = success && graph_binary_read_sections(
+                           file, sections, PRUNED_LANDMARK_LABELING_SECTIONS,
+                           header.checksum);
+  fclose(file);
+  success = success && validate_loaded_order(labeling->order, labeling->size) &&
+            validate_loaded_labels(&labeling->out, labeling->size,
+                                   labeling->max_label_size) &&
+            validate_loaded_labels(&labeling->in, labeling->size,
+                                   labeling->max_label_size);
+  if (!success) {
+    fprintf(stderr, "Invalid pruned landmark labeling file\n");
+    pruned_landmark_labeling_delete(labeling);
+    labeling = NULL;
+  }
+  return labeling;
+}
@@ -0,0 +1,107 @@
+#ifndef S21_PRUNED_LANDMARK_LABELING_H
+#define S21_PRUNED_LANDMARK_LABELING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../../graph/binary/graph_binary.h"
+#include "../../graph/s21_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pruned landmark labeling file:
+ * [header][order][out offsets, hubs, dists][in offsets, hubs, dists]
+ * All sections are native ints, the checksum covers every section.
+ */
+#define PRUNED_LANDMARK_LABELING_MAGIC "S21PLLAB"
+#define PRUNED_LANDMARK_LABELING_VERSION 1u
+
+/**
+ * @brief hub of the entry closing every label, larger than any rank
+ */
+#define PRUNED_LANDMARK_LABELING_SENTINEL INT32_MAX
+
+/**
+ * @brief alignment of the hub and distance arrays in bytes, one cache line
+ */
+#define PRUNED_LANDMARK_LABELING_ALIGNMENT 64
+
+/**
+ * @brief header of the pruned landmark labeling file
+ * @param prefix magic PRUNED_LANDMARK_LABELING_MAGIC, version
+ * PRUNED_LANDMARK_LABELING_VERSION
+ * @param vertex_count number of vertices
+ * @param out_entry_count entries of the out labels, sentinels included
+ * @param in_entry_count entries of the in labels, sentinels included
+ * @param max_label_size entries of the longest label without its sentinel
+ * @param checksum graph_binary_sections_checksum of the sections
+ */
+typedef struct {
+  graph_binary_section_prefix_t prefix;
+  int64_t vertex_count;
+  int64_t out_entry_count;
+  int64_t in_entry_count;
+  int64_t max_label_size;
+  uint64_t checksum;
+} pruned_landmark_labeling_header_t;
+
+/**
+ * @brief one side of the 2-hop labels in flat arrays: the label of vertex v
+ * is hubs[offsets[v] .. offsets[v + 1]) with the matching dists, hubs are
+ * ranks in ascending order and the last one is
+ * PRUNED_LANDMARK_LABELING_SENTINEL.
+ * @param offsets first entry of every label, size + 1 ints
+ * @param hubs hub ranks, aligned to PRUNED_LANDMARK_LABELING_ALIGNMENT
+ * @param dists distances to or from the hubs, aligned the same way
+ * @param entry_count entries in hubs and dists, sentinels included
+ * @param block allocation hubs and dists live in
+ */
+typedef struct {
+  int *offsets;
+  int *hubs;
+  int *dists;
+  int entry_count;
+  void *block;
+} landmark_labels_t;
+
+/**
+ * @brief 2-hop distance labeling built by pruned Dijkstra searches.
+ *
+ * Every pair (u, w) with a path has a hub h on one of its shortest paths
+ * with (h, d(u, h)) in the out label of u and (h, d(h, w)) in the in label
+ * of w, so a query merges two sorted arrays. Hubs are kept in the hubs
+ * array apart from their distances, the merge only streams hub ranks.
+ * @param size number of vertices
+ * @param order vertex of every rank, rank 0 is searched first
+ * @param out out labels, hubs reachable from the vertex
+ * @param in in labels, hubs that reach the vertex
+ * @param max_label_size entries of the longest label without its sentinel
+ */
+typedef struct {
+  int size;
+  int *order;
+  landmark_labels_t out;
+  landmark_labels_t in;
+  int max_label_size;
+} pruned_landmark_labeling_t;
+
+pruned_landmark_labeling_t *pruned_landmark_labeling_create(
+    const csr_graph_t *graph);
+pruned_landmark_labeling_t *pruned_landmark_labeling_create_from_file(
+    const char *filename);
+void pruned_landmark_labeling_delete(pruned_landmark_labeling_t *labeling);
+int get_shortest_path_labeling(const pruned_landmark_labeling_t *labeling,
+                               int vertex1, int vertex2);
+bool save_pruned_landmark_labeling_to_file(
+    const pruned_landmark_labeling_t *labeling, const char *filename);
+pruned_landmark_labeling_t *load_pruned_landmark_labeling_from_file(
+    const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_PRUNED_LANDMARK_LABELING_H
@@ -0,0 +1,157 @@
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../../test/main_test.h"
+#include "../../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+const std::string kLabelingFile = "../data-samples/weighted_graph.s21pll";
+const std::string kBinaryGraphFile = "../data-samples/labeling_graph.s21g";
+
+void ExpectAllPairsMatch(GraphWrapper& graph,
+                         const pruned_landmark_labeling_t* labeling) {
+  ExpectAllPairsMatchTree(graph, [labeling](int from, int to) {
+    return get_shortest_path_labeling(labeling, from, to);
+  });
+}
+
+void ExpectLabelsClosed(const landmark_labels_t* labels, int size,
+                        int max_label_size) {
+  ASSERT_EQ(labels->offsets[0], 0);
+  ASSERT_EQ(labels->offsets[size], labels->entry_count);
+  for (int v = 0; v < size; v++) {
+    const int begin = labels->offsets[v], end = labels->offsets[v + 1];
+    ASSERT_LT(begin, end) << "vertex " << v;
+    EXPECT_LE(end - begin - 1, max_label_size);
+    EXPECT_EQ(labels->hubs[end - 1], PRUNED_LANDMARK_LABELING_SENTINEL);
+    for (int e = begin; e < end - 1; e++) {
+      ASSERT_GE(labels->hubs[e], 0);
+      ASSERT_LT(labels->hubs[e], size);
+      if (e > begin) {
+        ASSERT_LT(labels->hubs[e - 1], labels->hubs[e]);
+      }
+      ASSERT_GE(labels->dists[e], 0);
+    }
+  }
+}
+
+/**
+ * @brief first vertex whose out label holds at least two hubs
+ */
+int VertexWithTwoHubs(const pruned_landmark_labeling_t* labeling) {
+  for (int v = 0; v < labeling->size; v++) {
+    if (labeling->out.offsets[v + 1] - labeling->out.offsets[v] >= 3) {
+      return v;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief saves a labeling damaged by damage, the checksum is computed over
+ * the damaged arrays, so only the label and order checks of the loader can
+ * reject it
+ */
+void ExpectDamagedLabelingRejected(
+    const std::function<void(pruned_landmark_labeling_t*)>& damage) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 40, 10, false, 7u);
+  pruned_landmark_labeling_t* labeling =
+      pruned_landmark_labeling_create(graph.getCsrGraph());
+  ASSERT_NE(labeling, nullptr);
+  ASSERT_GE(VertexWithTwoHubs(labeling), 0);
+  damage(labeling);
+  ASSERT_TRUE(
+      save_pruned_landmark_labeling_to_file(labeling, kLabelingFile.c_str()));
+  pruned_landmark_labeling_delete(labeling);
+  EXPECT_EQ(load_pruned_landmark_labeling_from_file(kLabelingFile.c_str()),
+            nullptr);
+  std::remove(kLabelingFile.c_str());
+}
+
+}  // namespace
+
+TEST(PrunedLandmarkLabelingTest, LabelsAreSortedAndClosed) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 150, 3, true, 17u);
+  pruned_landmark_labeling_t* labeling =
+      pruned_landmark_labeling_create(graph.getCsrGraph());
+  ASSERT_NE(labeling, nullptr);
+  EXPECT_LT(labeling->max_label_size, graph.getOrder());
+  ExpectLabelsClosed(&labeling->out, labeling->size,
+                     labeling->max_label_size);
+  ExpectLabelsClosed(&labeling->in, labeling->size, labeling->max_label_size);
+  std::vector<bool> seen(labeling->size, false);
+  for (int r = 0; r < labeling->size; r++) {
+    ASSERT_GE(labeling->order[r], 0);
+    ASSERT_LT(labeling->order[r], labeling->size);
+    ASSERT_FALSE(seen[labeling->order[r]]) << "rank " << r;
+    seen[labeling->order[r]] = true;
+  }
+  pruned_landmark_labeling_delete(labeling);
+}
+
+TEST(PrunedLandmarkLabelingTest, HubArraysAreAligned) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 90, 5, false, 31u);
+  pruned_landmark_labeling_t* labeling =
+      pruned_landmark_labeling_create(graph.getCsrGraph());
+  ASSERT_NE(labeling, nullptr);
+  for (const landmark_labels_t* labels : {&labeling->out, &labeling->in}) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(labels->hubs) %
+                  PRUNED_LANDMARK_LABELING_ALIGNMENT,
+              0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(labels->dists) %
+                  PRUNED_LANDMARK_LABELING_ALIGNMENT,
+              0u);
+  }
+  pruned_landmark_labeling_delete(labeling);
+}
+
+TEST(PrunedLandmarkLabelingTest, GraphFiles) {
+  const std::string text_file =
+      "../datasets/incidence_matrix_src/weighted_graph.txt";
+  GraphWrapper text_graph;
+  ASSERT_TRUE(text_graph.loadGraphFromFile(text_file));
+  pruned_landmark_labeling_t* labeling =
+      pruned_landmark_labeling_create_from_file(text_file.c_str());
+  ASSERT_NE(labeling, nullptr);
+  ExpectAllPairsMatch(text_graph, labeling);
+  pruned_landmark_labeling_delete(labeling);
+
+  GraphWrapper graph;
+  FillRandomGraph(graph, 60, 6, false, 23u);
+  ASSERT_TRUE(save_csr_graph_to_binary_file(graph.getCsrGraph(),
+                                            kBinaryGraphFile.c_str()));
+  labeling =
+      pruned_landmark_labeling_create_from_file(kBinaryGraphFile.c_str());
+  ASSERT_NE(labeling, nullptr);
+  ExpectAllPairsMatch(graph, labeling);
+  pruned_landmark_labeling_delete(labeling);
+  std::remove(kBinaryGraphFile.c_str());
+  EXPECT_EQ(pruned_landmark_labeling_create_from_file("missing.txt"),
+            nullptr);
+}
+
+TEST(PrunedLandmarkLabelingTest, CraftedFileWithValidChecksumIsRejected) {
+  ExpectDamagedLabelingRejected([](pruned_landmark_labeling_t* labeling) {
+    // the merge of a query would run past the label
+    const int v = VertexWithTwoHubs(labeling);
+    labeling->out.hubs[labeling->out.offsets[v + 1] - 1] = 0;
+  });
+  ExpectDamagedLabelingRejected([](pruned_landmark_labeling_t* labeling) {
+    const int begin = labeling->out.offsets[VertexWithTwoHubs(labeling)];
+    std::swap(labeling->out.hubs[begin], labeling->out.hubs[begin + 1]);
+  });
+  ExpectDamagedLabelingRejected([](pruned_landmark_labeling_t* labeling) {
+    labeling->in.hubs[labeling->in.offsets[0]] = labeling->size;
+  });
+  ExpectDamagedLabelingRejected([](pruned_landmark_labeling_t* labeling) {
+    labeling->order[1] = labeling->order[0];
+  });
+}
@@ -0,0 +1,162 @@
+#include "arena.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief overflow block header, the data follows it aligned
+ * @param next older overflow block
+ * @param size bytes accounted to this block
+ */
+struct arena_block {
+  arena_block_t *next;
+  size_t size;
+};
+
+static size_t align_up(size_t size) {
+  return (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+static char *align_pointer(void *block) {
+  const uintptr_t aligned =
+      ((uintptr_t)block + ARENA_ALIGNMENT - 1) &
+      ~(uintptr_t)(ARENA_ALIGNMENT - 1);
+  return (char *)block + (aligned - (uintptr_t)block);
+}
+
+/**
+ * @brief allocates the main region of the arena
+ * @return false if out of memory, the arena then has no region
+ */
+static bool allocate_region(arena_t *arena, size_t capacity) {
+  arena->capacity = align_up(capacity);
+  arena->block = malloc(arena->capacity + ARENA_ALIGNMENT);
+  arena->base = arena->block ? align_pointer(arena->block) : NULL;
+  if (!arena->block) arena->capacity = 0;
+  return arena->block != NULL;
+}
+
+/**
+ * @brief frees overflow blocks newer than stop
+ */
+static void free_overflow(arena_t *arena, arena_block_t *stop) {
+  while (arena->overflow != stop) {
+    arena_block_t *next = arena->overflow->next;
+    arena->overflow_bytes -= arena->overflow->size;
+    free(arena->overflow);
+    arena->overflow = next;
+  }
+}
+
+/**
+ * @brief creates an arena
+ * @param capacity initial region size in bytes, it grows on reset as needed
+ * @return arena pointer or NULL if error
+ */
+arena_t *arena_create(size_t capacity) {
+  arena_t *arena = (arena_t *)calloc(1, sizeof(arena_t));
+  if (arena && !allocate_region(arena, capacity ? capacity : 1)) {
+    free(arena);
+    arena = NULL;
+  }
+  return arena;
+}
+
+/**
+ * @brief deletes the arena and everything allocated from it
+ */
+void arena_delete(arena_t *arena) {
+  if (!arena) return;
+  free_overflow(arena, NULL);
+  free(arena->block);
+  free(arena);
+}
+
+/**
+ * @brief allocates size bytes aligned to ARENA_ALIGNMENT
+ * @param arena arena pointer
+ * @param size bytes to allocate
+ * @return uninitialized memory or NULL if error
+ */
+void *arena_alloc(arena_t *arena, size_t size) {
+  if (!arena || size > SIZE_MAX - 2 * ARENA_ALIGNMENT) return NULL;
+  size = align_up(size ? size : 1);
+  void *memory = NULL;
+  if (arena->capacity - arena->used >= size) {
+    memory = arena->base + arena->used;
+    arena->used += size;
+  } else {
+    const size_t header = align_up(sizeof(arena_block_t));
+    arena_block_t *block =
+        (arena_block_t *)malloc(header + size + ARENA_ALIGNMENT);
+    if (block) {
+      block->next = arena->overflow;
+      block->size = size;
+      arena->overflow = block;
+      arena->overflow_bytes += size;
+      memory = align_pointer((char *)block + header);
+    }
+  }
+  if (arena->used + arena->overflow_bytes > arena->peak) {
+    arena->peak = arena->used + arena->overflow_bytes;
+  }
+  return memory;
+}
+
+/**
+ * @brief allocates a zeroed array
+ * @return memory or NULL if error or count * size overflows
+ */
+void *arena_calloc(arena_t *arena, size_t count, size_t size) {
+  if (size != 0 && count > SIZE_MAX / size) return NULL;
+  void *memory = arena_alloc(arena, count * size);
+  if (memory) memset(memory, 0, count * size);
+  return memory;
+}
+
+/**
+ * @brief remembers the current state, see arena_release
+ */
+arena_mark_t arena_mark(const arena_t *arena) {
+  arena_mark_t mark = {arena->used, arena->overflow, arena->overflow_bytes};
+  return mark;
+}
+
+/**
+ * @brief frees everything allocated after mark was taken, algorithms use it
+ * to give back their scratch while keeping the caller's allocations
+ */
+void arena_release(arena_t *arena, arena_mark_t mark) {
+  free_overflow(arena, mark.overflow);
+  arena->used = mark.used;
+}
+
+/**
+ * @brief frees everything allocated from the arena.
+ *
+ * O(1) unless overflow blocks were needed since the previous reset; then
+ * they are freed and the region is reallocated at the peak size.
+ * @return false if the grown region could not be allocated, the arena keeps
+ * its previous region then
+ */
+bool arena_reset(arena_t *arena) {
+  bool success = true;
+  if (arena->overflow) {
+    free_overflow(arena, NULL);
+    void *old_block = arena->block;
+    char *old_base = arena->base;
+    const size_t old_capacity = arena->capacity;
+    if (allocate_region(arena, arena->peak)) {
+      free(old_block);
+    } else {
+      arena->block = old_block;
+      arena->base = old_base;
+      arena->capacity = old_capacity;
+      success = false;
+    }
+  }
+  arena->used = 0;
+  arena->peak = 0;
+  return success;
+}
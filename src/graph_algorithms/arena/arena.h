@@ -0,0 +1,67 @@
+#ifndef S21_ARENA_H
+#define S21_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief alignment of every arena allocation, one cache line
+ */
+#define ARENA_ALIGNMENT 64
+
+/**
+ * @brief block allocated when the main region was full
+ */
+typedef struct arena_block arena_block_t;
+
+/**
+ * @brief bump allocator for per-query scratch and result objects.
+ *
+ * Allocations are carved from one region; nothing is freed individually.
+ * arena_reset drops everything in O(1). When a query did not fit, the extra
+ * memory comes from overflow blocks and the next reset grows the region to
+ * the peak usage, so a steady query load performs no heap allocations.
+ * @param block allocation holding the region
+ * @param base first byte of the region, aligned to ARENA_ALIGNMENT
+ * @param capacity region size in bytes
+ * @param used bytes of the region in use
+ * @param overflow overflow blocks, newest first
+ * @param overflow_bytes bytes in overflow blocks
+ * @param peak largest used + overflow_bytes since the last reset
+ */
+typedef struct {
+  void *block;
+  char *base;
+  size_t capacity;
+  size_t used;
+  arena_block_t *overflow;
+  size_t overflow_bytes;
+  size_t peak;
+} arena_t;
+
+/**
+ * @brief arena state to return to with arena_release
+ */
+typedef struct {
+  size_t used;
+  arena_block_t *overflow;
+  size_t overflow_bytes;
+} arena_mark_t;
+
+arena_t *arena_create(size_t capacity);
+void arena_delete(arena_t *arena);
+void *arena_alloc(arena_t *arena, size_t size);
+void *arena_calloc(arena_t *arena, size_t count, size_t size);
+arena_mark_t arena_mark(const arena_t *arena);
+void arena_release(arena_t *arena, arena_mark_t mark);
+bool arena_reset(arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_ARENA_H
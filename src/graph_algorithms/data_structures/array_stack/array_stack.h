@@ -0,0 +1,69 @@
+#ifndef S21_ARRAY_STACK_H
+#define S21_ARRAY_STACK_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief fixed-capacity LIFO of ints in one allocation, header only so the
+ * algorithms' inner loops inline every operation.
+ *
+ * Nothing is checked: pushing onto a full stack, or reading an empty one, is
+ * undefined. Size it to the number of vertices when each vertex is pushed at
+ * most once.
+ * @param capacity number of slots
+ * @param count number of stored elements
+ * @param data slots stored right after the struct, the top is
+ * data[count - 1]
+ */
+typedef struct {
+  int capacity;
+  int count;
+  int *data;
+} array_stack_t;
+
+/**
+ * @brief creates an empty stack of capacity slots
+ * @return stack pointer or NULL if error
+ */
+static inline array_stack_t *array_stack_create(int capacity) {
+  if (capacity < 0) return NULL;
+  array_stack_t *s = (array_stack_t *)malloc(sizeof(array_stack_t) +
+                                             (size_t)capacity * sizeof(int));
+  if (s) {
+    s->data = (int *)(s + 1);
+    s->capacity = capacity;
+    s->count = 0;
+  }
+  return s;
+}
+
+static inline void array_stack_delete(array_stack_t *s) { free(s); }
+
+static inline void array_stack_push(array_stack_t *s, int value) {
+  s->data[s->count++] = value;
+}
+
+static inline void array_stack_pop(array_stack_t *s) { s->count--; }
+
+static inline int array_stack_top(const array_stack_t *s) {
+  return s->data[s->count - 1];
+}
+
+static inline bool array_stack_is_empty(const array_stack_t *s) {
+  return s->count == 0;
+}
+
+static inline int array_stack_size(const array_stack_t *s) { return s->count; }
+
+static inline void array_stack_clear(array_stack_t *s) { s->count = 0; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_ARRAY_STACK_H
@@ -0,0 +1,139 @@
+#ifndef S21_INDEXED_HEAP_H
+#define S21_INDEXED_HEAP_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief children per node, a 4-ary heap is half as deep as a binary one and
+ * the four children of a node share a cache line
+ */
+#define INDEXED_HEAP_ARITY 4
+
+/**
+ * @brief min-heap of the ids [0, capacity) keyed by int, with decrease-key.
+ * Header only so the shortest-path inner loops inline every operation.
+ *
+ * Nothing is checked: pushing an id already in the heap, decreasing to a
+ * larger key or popping an empty heap is undefined.
+ * @param capacity number of ids
+ * @param count number of ids in the heap
+ * @param heap ids in heap order
+ * @param position slot of every id in heap, -1 if the id is not in the heap
+ * @param key key of every id, valid while the id is in the heap
+ */
+typedef struct {
+  int capacity;
+  int count;
+  int *heap;
+  int *position;
+  int *key;
+} indexed_heap_t;
+
+/**
+ * @brief creates an empty heap for the ids [0, capacity)
+ * @return heap pointer or NULL if error
+ */
+static inline indexed_heap_t *indexed_heap_create(int capacity) {
+  if (capacity < 0) return NULL;
+  indexed_heap_t *h = (indexed_heap_t *)malloc(
+      sizeof(indexed_heap_t) + 3 * (size_t)capacity * sizeof(int));
+  if (h) {
+    h->heap = (int *)(h + 1);
+    h->position = h->heap + capacity;
+    h->key = h->position + capacity;
+    h->capacity = capacity;
+    h->count = 0;
+    for (int i = 0; i < capacity; i++) h->position[i] = -1;
+  }
+  return h;
+}
+
+static inline void indexed_heap_delete(indexed_heap_t *h) { free(h); }
+
+static inline bool indexed_heap_is_empty(const indexed_heap_t *h) {
+  return h->count == 0;
+}
+
+static inline bool indexed_heap_contains(const indexed_heap_t *h, int id) {
+  return h->position[id] >= 0;
+}
+
+static inline int indexed_heap_min_key(const indexed_heap_t *h) {
+  return h->key[h->heap[0]];
+}
+
+static inline void indexed_heap_place(indexed_heap_t *h, int slot, int id) {
+  h->heap[slot] = id;
+  h->position[id] = slot;
+}
+
+static inline void indexed_heap_sift_up(indexed_heap_t *h, int slot, int id) {
+  const int key = h->key[id];
+  while (slot > 0) {
+    const int parent = (slot - 1) / INDEXED_HEAP_ARITY;
+    if (h->key[h->heap[parent]] <= key) break;
+    indexed_heap_place(h, slot, h->heap[parent]);
+    slot = parent;
+  }
+  indexed_heap_place(h, slot, id);
+}
+
+static inline void indexed_heap_sift_down(indexed_heap_t *h, int slot,
+                                          int id) {
+  const int key = h->key[id];
+  for (;;) {
+    const int first = slot * INDEXED_HEAP_ARITY + 1;
+    if (first >= h->count) break;
+    const int last = first + INDEXED_HEAP_ARITY < h->count
+                         ? first + INDEXED_HEAP_ARITY
+                         : h->count;
+    int best = first;
+    for (int c = first + 1; c < last; c++) {
+      if (h->key[h->heap[c]] < h->key[h->heap[best]]) best = c;
+    }
+    if (h->key[h->heap[best]] >= key) break;
+    indexed_heap_place(h, slot, h->heap[best]);
+    slot = best;
+  }
+  indexed_heap_place(h, slot, id);
+}
+
+static inline void indexed_heap_push(indexed_heap_t *h, int id, int key) {
+  h->key[id] = key;
+  indexed_heap_sift_up(h, h->count++, id);
+}
+
+static inline void indexed_heap_decrease(indexed_heap_t *h, int id, int key) {
+  h->key[id] = key;
+  indexed_heap_sift_up(h, h->position[id], id);
+}
+
+/**
+ * @brief removes the id of smallest key
+ * @return the removed id
+ */
+static inline int indexed_heap_pop(indexed_heap_t *h) {
+  const int top = h->heap[0];
+  h->position[top] = -1;
+  if (--h->count > 0) indexed_heap_sift_down(h, 0, h->heap[h->count]);
+  return top;
+}
+
+/**
+ * @brief empties the heap in O(count), ready for the next search
+ */
+static inline void indexed_heap_clear(indexed_heap_t *h) {
+  for (int i = 0; i < h->count; i++) h->position[h->heap[i]] = -1;
+  h->count = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_INDEXED_HEAP_H
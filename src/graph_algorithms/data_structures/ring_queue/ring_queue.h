@@ -0,0 +1,80 @@
+#ifndef S21_RING_QUEUE_H
+#define S21_RING_QUEUE_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief fixed-capacity FIFO of ints in one allocation, header only so the
+ * algorithms' inner loops inline every operation.
+ *
+ * Nothing is checked: pushing into a full queue, or reading an empty one, is
+ * undefined. Size it to the number of vertices when each vertex is pushed at
+ * most once.
+ * @param capacity number of slots
+ * @param head index of the front element
+ * @param count number of stored elements
+ * @param data slots, stored right after the struct
+ */
+typedef struct {
+  int capacity;
+  int head;
+  int count;
+  int *data;
+} ring_queue_t;
+
+/**
+ * @brief creates an empty queue of capacity slots
+ * @return queue pointer or NULL if error
+ */
+static inline ring_queue_t *ring_queue_create(int capacity) {
+  if (capacity < 0) return NULL;
+  ring_queue_t *q = (ring_queue_t *)malloc(sizeof(ring_queue_t) +
+                                           (size_t)capacity * sizeof(int));
+  if (q) {
+    q->data = (int *)(q + 1);
+    q->capacity = capacity;
+    q->head = 0;
+    q->count = 0;
+  }
+  return q;
+}
+
+static inline void ring_queue_delete(ring_queue_t *q) { free(q); }
+
+static inline void ring_queue_push(ring_queue_t *q, int value) {
+  int tail = q->head + q->count;
+  if (tail >= q->capacity) tail -= q->capacity;
+  q->data[tail] = value;
+  q->count++;
+}
+
+static inline void ring_queue_pop(ring_queue_t *q) {
+  if (++q->head == q->capacity) q->head = 0;
+  q->count--;
+}
+
+static inline int ring_queue_front(const ring_queue_t *q) {
+  return q->data[q->head];
+}
+
+static inline bool ring_queue_is_empty(const ring_queue_t *q) {
+  return q->count == 0;
+}
+
+static inline int ring_queue_size(const ring_queue_t *q) { return q->count; }
+
+static inline void ring_queue_clear(ring_queue_t *q) {
+  q->head = 0;
+  q->count = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_RING_QUEUE_H
@@ -11,11 +11,48 @@
 #include <limits.h>
 
 #include "ACO/ant_colony_optimization_public.h"
+#include "ALT/alt_landmarks.h"
+#include "CH/contraction_hierarchy.h"
+#include "PLL/pruned_landmark_labeling.h"
+#include "arena/arena.h"
+#include "thread_pool/thread_pool.h"
+#include "workspace/workspace.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief sources traversed together by multi_source_breadth_first_search,
+ * one bit of a 64-bit word each
+ */
+#define MULTI_SOURCE_BFS_BATCH 64
+
+/**
+ * @brief largest edge weight for which SHORTEST_PATH_ENGINE_AUTO picks
+ * Dial's buckets, heavier graphs get the radix heap
+ */
+#define SHORTEST_PATH_DIAL_MAX_WEIGHT 64
+
+/**
+ * @brief most buckets Dial's engine allocates (max_weight + 1 of them), an
+ * explicit SHORTEST_PATH_ENGINE_DIAL on heavier graphs runs the radix heap
+ */
+#define SHORTEST_PATH_DIAL_MAX_BUCKETS (1 << 20)
+
+/**
+ * @brief priority queue behind the csr shortest-path searches.
+ * AUTO picks DIAL when the graph's max_weight is at most
+ * SHORTEST_PATH_DIAL_MAX_WEIGHT and RADIX otherwise; DIAL itself runs RADIX
+ * when max_weight + 1 exceeds SHORTEST_PATH_DIAL_MAX_BUCKETS.
+ */
+typedef enum {
+  SHORTEST_PATH_ENGINE_AUTO,
+  SHORTEST_PATH_ENGINE_HEAP,
+  SHORTEST_PATH_ENGINE_DIAL,
+  SHORTEST_PATH_ENGINE_RADIX
+} shortest_path_engine_t;
+
 /**
  * @brief result structure for graph algorithms BFS and DFS.
  * @param visited_vertices array of visited vertices(path).
@@ -26,8 +63,73 @@ typedef struct {
   int size;
 } graph_traversal_result_t;
 
+/**
+ * @brief per-vertex result of traversals that build a BFS tree.
+ * @param levels hop distance from the start vertex, -1 if not reached.
+ * @param parents parent in the BFS tree, -1 for the start vertex and for
+ * vertices that were not reached.
+ * @param order reached vertices in visiting order, order[0, reached) lists
+ * exactly the vertices whose level is not -1.
+ * @param size number of vertices (and length of the arrays).
+ * @param reached number of reached vertices.
+ */
+typedef struct {
+  int *levels;
+  int *parents;
+  int *order;
+  int size;
+  int reached;
+} graph_levels_result_t;
+
+/**
+ * @brief stop conditions of the bounded traversals.
+ * @param target_vertex stop once this vertex is visited, -1 for none.
+ * @param max_visited stop once this many vertices are visited, 0 for no
+ * limit.
+ */
+typedef struct {
+  int target_vertex;
+  int max_visited;
+} traversal_limits_t;
+
+/**
+ * @brief shortest-path tree of one source.
+ * @param dist distance from the source, -1 if unreachable.
+ * @param pred previous vertex on a shortest path, -1 for the source and for
+ * unreachable vertices.
+ * @param size number of vertices (and length of both arrays).
+ * @param source vertex the tree was grown from.
+ */
+typedef struct {
+  int *dist;
+  int *pred;
+  int size;
+  int source;
+} shortest_path_tree_t;
+
+/**
+ * @brief one query of get_shortest_paths_batch.
+ * @param source start vertex.
+ * @param target end vertex.
+ */
+typedef struct {
+  int source;
+  int target;
+} shortest_path_query_t;
+
 graph_traversal_result_t *traversal_result_create(int size);
 void traversal_result_delete(graph_traversal_result_t *result);
+graph_levels_result_t *levels_result_create(int size);
+void levels_result_delete(graph_levels_result_t *result);
+void levels_result_reset(graph_levels_result_t *result);
+int levels_result_path(const graph_levels_result_t *result, int target,
+                       int *path);
+bool traversal_limits_reached(const traversal_limits_t *limits, int vertex,
+                              int visited);
+shortest_path_tree_t *shortest_path_tree_create(int size);
+void shortest_path_tree_delete(shortest_path_tree_t *tree);
+int shortest_path_tree_path(const shortest_path_tree_t *tree, int target,
+                            int *path);
 void depth_first_search(graph_t *graph, int start_vertex,
                         graph_traversal_result_t *result);
 void breadth_first_search(graph_t *graph, int start_vertex,
@@ -36,6 +138,79 @@ int get_shortest_path_between_vertices(graph_t *graph, int vertex1,
                                        int vertex2);
 int get_shortest_paths_between_all_vertices(graph_t *graph, int **dist);
 int get_least_spanning_tree(graph_t *graph, int **mst);
+void depth_first_search_csr(const csr_graph_t *graph, int start_vertex,
+                            graph_traversal_result_t *result);
+void breadth_first_search_csr(const csr_graph_t *graph, int start_vertex,
+                              graph_traversal_result_t *result);
+void depth_first_search_bits(const bit_matrix_t *graph, int start_vertex,
+                             graph_traversal_result_t *result);
+void breadth_first_search_bits(const bit_matrix_t *graph, int start_vertex,
+                               graph_traversal_result_t *result);
+int get_shortest_path_between_vertices_csr(const csr_graph_t *graph,
+                                           int vertex1, int vertex2);
+int get_least_spanning_tree_csr(const csr_graph_t *graph, int **mst);
+graph_traversal_result_t *traversal_result_create_arena(int size,
+                                                        arena_t *arena);
+void depth_first_search_arena(graph_t *graph, int start_vertex,
+                              graph_traversal_result_t *result,
+                              arena_t *arena);
+void breadth_first_search_arena(graph_t *graph, int start_vertex,
+                                graph_traversal_result_t *result,
+                                arena_t *arena);
+int get_shortest_path_between_vertices_arena(graph_t *graph, int vertex1,
+                                             int vertex2, arena_t *arena);
+int get_least_spanning_tree_arena(graph_t *graph, int **mst, arena_t *arena);
+void depth_first_search_with_workspace(graph_workspace_t *workspace,
+                                       int start_vertex,
+                                       graph_traversal_result_t *result);
+void breadth_first_search_with_workspace(graph_workspace_t *workspace,
+                                         int start_vertex,
+                                         graph_traversal_result_t *result);
+int get_shortest_path_between_vertices_with_workspace(
+    graph_workspace_t *workspace, int vertex1, int vertex2);
+int get_least_spanning_tree_with_workspace(graph_workspace_t *workspace,
+                                           int **mst);
+void breadth_first_search_direction_optimizing(const csr_graph_t *graph,
+                                               const csr_graph_t *reverse,
+                                               int start_vertex,
+                                               graph_levels_result_t *result);
+void breadth_first_search_parallel(const csr_graph_t *graph, int start_vertex,
+                                   thread_pool_t *pool,
+                                   graph_traversal_result_t *result,
+                                   graph_levels_result_t *levels);
+bool multi_source_breadth_first_search(const csr_graph_t *graph,
+                                       const int *sources, int source_count,
+                                       int *distances);
+void breadth_first_search_levels(graph_t *graph, int start_vertex,
+                                 const traversal_limits_t *limits,
+                                 graph_levels_result_t *result);
+void depth_first_search_levels(graph_t *graph, int start_vertex,
+                               const traversal_limits_t *limits,
+                               graph_levels_result_t *result);
+void breadth_first_search_levels_csr(const csr_graph_t *graph,
+                                     int start_vertex,
+                                     const traversal_limits_t *limits,
+                                     graph_levels_result_t *result);
+int get_shortest_path_between_vertices_engine(const csr_graph_t *graph,
+                                              int vertex1, int vertex2,
+                                              shortest_path_engine_t engine);
+bool shortest_paths_delta_stepping(const csr_graph_t *graph, int source,
+                                   int delta, thread_pool_t *pool,
+                                   int *dist);
+bool get_shortest_path_tree(graph_t *graph, int source,
+                            shortest_path_tree_t *tree);
+bool get_shortest_path_tree_csr(const csr_graph_t *graph, int source,
+                                shortest_path_tree_t *tree);
+bool get_shortest_path_tree_engine(const csr_graph_t *graph, int source,
+                                   shortest_path_engine_t engine,
+                                   shortest_path_tree_t *tree);
+bool get_shortest_paths_batch(const csr_graph_t *graph,
+                              const shortest_path_query_t *queries,
+                              int query_count, thread_pool_t *pool,
+                              int *results);
+int get_shortest_path_bidirectional(const csr_graph_t *graph,
+                                    const csr_graph_t *reverse, int vertex1,
+                                    int vertex2);
 void solve_traveling_salesman_problem(tsm_result_t *result,
                                       const graph_t *graph,
                                       const aco_params_t *params);
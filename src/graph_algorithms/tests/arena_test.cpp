@@ -0,0 +1,112 @@
+#include <cstdint>
+#include <vector>
+
+#include "../../test/main_test.h"
+#include "../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+std::vector<int> ToVector(const graph_traversal_result_t* result) {
+  return std::vector<int>(result->visited_vertices,
+                          result->visited_vertices + result->size);
+}
+
+}  // namespace
+
+TEST(ArenaTest, AllocationsAreAlignedAndDistinct) {
+  arena_t* arena = arena_create(256);
+  ASSERT_NE(arena, nullptr);
+  char* first = static_cast<char*>(arena_alloc(arena, 3));
+  char* second = static_cast<char*>(arena_alloc(arena, 100));
+  int* zeros = static_cast<int*>(arena_calloc(arena, 1000, sizeof(int)));
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  ASSERT_NE(zeros, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % ARENA_ALIGNMENT, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % ARENA_ALIGNMENT, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(zeros) % ARENA_ALIGNMENT, 0u);
+  EXPECT_GE(second - first, 3);
+  for (int i = 0; i < 1000; i++) ASSERT_EQ(zeros[i], 0);
+  arena_delete(arena);
+}
+
+TEST(ArenaTest, ResetGrowsRegionToPeak) {
+  arena_t* arena = arena_create(128);
+  ASSERT_NE(arena, nullptr);
+  ASSERT_NE(arena_alloc(arena, 10000), nullptr);
+  EXPECT_NE(arena->overflow, nullptr);
+  EXPECT_TRUE(arena_reset(arena));
+  EXPECT_EQ(arena->overflow, nullptr);
+  EXPECT_GE(arena->capacity, 10000u);
+
+  ASSERT_NE(arena_alloc(arena, 10000), nullptr);
+  EXPECT_EQ(arena->overflow, nullptr);
+  arena_delete(arena);
+}
+
+TEST(ArenaTest, ReleaseReturnsToMark) {
+  arena_t* arena = arena_create(1024);
+  ASSERT_NE(arena, nullptr);
+  void* kept = arena_alloc(arena, 64);
+  const arena_mark_t mark = arena_mark(arena);
+  void* scratch = arena_alloc(arena, 128);
+  ASSERT_NE(arena_alloc(arena, 4096), nullptr);
+  arena_release(arena, mark);
+  EXPECT_EQ(arena->overflow, nullptr);
+  EXPECT_EQ(arena_alloc(arena, 128), scratch);
+  EXPECT_NE(kept, scratch);
+  arena_delete(arena);
+}
+
+TEST(ArenaTest, AlgorithmsMatchHeapVersions) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 90, 25, true, 777u, 20);
+  GraphAlgorithmsWrapper algorithms;
+  graph_t* c_graph = graph.getGraph();
+  const int size = graph.getOrder();
+  // too small on purpose, the first queries spill into overflow blocks
+  arena_t* arena = arena_create(64);
+  ASSERT_NE(arena, nullptr);
+
+  for (int start = 0; start < size; start += 11) {
+    graph_traversal_result_t* bfs = traversal_result_create_arena(size, arena);
+    graph_traversal_result_t* dfs = traversal_result_create_arena(size, arena);
+    ASSERT_NE(bfs, nullptr);
+    ASSERT_NE(dfs, nullptr);
+    breadth_first_search_arena(c_graph, start, bfs, arena);
+    depth_first_search_arena(c_graph, start, dfs, arena);
+    EXPECT_EQ(ToVector(bfs), algorithms.breadthFirstSearch(graph, start));
+    EXPECT_EQ(ToVector(dfs), algorithms.depthFirstSearch(graph, start));
+    for (int target = 0; target < size; target += 13) {
+      EXPECT_EQ(
+          get_shortest_path_between_vertices_arena(c_graph, start, target,
+                                                   arena),
+          algorithms.getShortestPathBetweenVertices(graph, start, target));
+    }
+    EXPECT_TRUE(arena_reset(arena));
+  }
+  EXPECT_EQ(arena->overflow, nullptr);
+
+  std::vector<std::vector<int>> mst(size, std::vector<int>(size, -1));
+  std::vector<int*> rows;
+  for (auto& row : mst) rows.push_back(row.data());
+  ASSERT_EQ(get_least_spanning_tree_arena(c_graph, rows.data(), arena), 0);
+  EXPECT_EQ(mst, algorithms.getLeastSpanningTree(graph));
+  arena_delete(arena);
+}
+
+TEST(ArenaTest, InvalidInput) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 5, 25, true, 1u, 20);
+  arena_t* arena = arena_create(1024);
+  ASSERT_NE(arena, nullptr);
+  EXPECT_EQ(get_shortest_path_between_vertices_arena(graph.getGraph(), 0, 9,
+                                                     arena),
+            -1);
+  EXPECT_EQ(get_shortest_path_between_vertices_arena(graph.getGraph(), 0, 1,
+                                                     nullptr),
+            -1);
+  EXPECT_EQ(traversal_result_create_arena(-1, arena), nullptr);
+  EXPECT_EQ(arena->used, 0u);
+  arena_delete(arena);
+}
@@ -0,0 +1,169 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../../test/main_test.h"
+#include "../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+/**
+ * Every point-to-point index is described by a traits struct: Index,
+ * Create(csr), Delete(index) and Query(index, from, to). Indexes with a file
+ * format add Header, kFile, Save(index, filename) and Load(filename).
+ */
+struct ContractionHierarchyEngine {
+  using Index = contraction_hierarchy_t;
+  using Header = contraction_hierarchy_header_t;
+  static constexpr const char* kFile = "../data-samples/weighted_graph.s21ch";
+  static Index* Create(const csr_graph_t* graph) {
+    return contraction_hierarchy_create(graph);
+  }
+  static void Delete(Index* index) { contraction_hierarchy_delete(index); }
+  static int Query(Index* index, int from, int to) {
+    return get_shortest_path_contraction_hierarchy(index, from, to);
+  }
+  static bool Save(const Index* index, const char* filename) {
+    return save_contraction_hierarchy_to_file(index, filename);
+  }
+  static Index* Load(const char* filename) {
+    return load_contraction_hierarchy_from_file(filename);
+  }
+};
+
+struct AltLandmarksEngine {
+  using Index = alt_landmarks_t;
+  static Index* Create(const csr_graph_t* graph) {
+    return alt_landmarks_create(graph, ALT_DEFAULT_LANDMARKS);
+  }
+  static void Delete(Index* index) { alt_landmarks_delete(index); }
+  static int Query(Index* index, int from, int to) {
+    return get_shortest_path_alt(index, from, to);
+  }
+};
+
+struct PrunedLandmarkLabelingEngine {
+  using Index = pruned_landmark_labeling_t;
+  using Header = pruned_landmark_labeling_header_t;
+  static constexpr const char* kFile =
+      "../data-samples/weighted_graph.s21pll";
+  static Index* Create(const csr_graph_t* graph) {
+    return pruned_landmark_labeling_create(graph);
+  }
+  static void Delete(Index* index) { pruned_landmark_labeling_delete(index); }
+  static int Query(Index* index, int from, int to) {
+    return get_shortest_path_labeling(index, from, to);
+  }
+  static bool Save(const Index* index, const char* filename) {
+    return save_pruned_landmark_labeling_to_file(index, filename);
+  }
+  static Index* Load(const char* filename) {
+    return load_pruned_landmark_labeling_from_file(filename);
+  }
+};
+
+template <typename Engine>
+class PointToPointTest : public ::testing::Test {
+ protected:
+  static void ExpectAllPairsMatch(GraphWrapper& graph,
+                                  typename Engine::Index* index) {
+    ExpectAllPairsMatchTree(graph, [index](int from, int to) {
+      return Engine::Query(index, from, to);
+    });
+  }
+
+  static void ExpectIndexMatches(GraphWrapper& graph) {
+    typename Engine::Index* index = Engine::Create(graph.getCsrGraph());
+    ASSERT_NE(index, nullptr);
+    ExpectAllPairsMatch(graph, index);
+    Engine::Delete(index);
+  }
+};
+
+template <typename Engine>
+class PointToPointFileTest : public PointToPointTest<Engine> {};
+
+using PointToPointEngines =
+    ::testing::Types<ContractionHierarchyEngine, AltLandmarksEngine,
+                     PrunedLandmarkLabelingEngine>;
+using PointToPointFileEngines =
+    ::testing::Types<ContractionHierarchyEngine, PrunedLandmarkLabelingEngine>;
+
+}  // namespace
+
+TYPED_TEST_SUITE(PointToPointTest, PointToPointEngines);
+TYPED_TEST_SUITE(PointToPointFileTest, PointToPointFileEngines);
+
+TYPED_TEST(PointToPointTest, DirectedGraphMatchesDijkstra) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 120, 4, false, 5u);
+  this->ExpectIndexMatches(graph);
+}
+
+TYPED_TEST(PointToPointTest, SymmetricGraphMatchesDijkstra) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 150, 3, true, 17u);
+  this->ExpectIndexMatches(graph);
+}
+
+TYPED_TEST(PointToPointTest, DatasetsMatchDijkstra) {
+  for (const char* name : {"weighted_graph.txt", "disconnected_graph.txt",
+                           "graph_examples.txt"}) {
+    SCOPED_TRACE(name);
+    GraphWrapper graph;
+    ASSERT_TRUE(graph.loadGraphFromFile(
+        std::string("../datasets/incidence_matrix_src/") + name));
+    this->ExpectIndexMatches(graph);
+  }
+}
+
+TYPED_TEST(PointToPointTest, InvalidInput) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/disconnected_graph.txt"));
+  typename TypeParam::Index* index = TypeParam::Create(graph.getCsrGraph());
+  ASSERT_NE(index, nullptr);
+  EXPECT_EQ(TypeParam::Query(index, 4, 4), 0);
+  EXPECT_EQ(TypeParam::Query(index, -1, 2), -1);
+  EXPECT_EQ(TypeParam::Query(index, 0, 99), -1);
+  EXPECT_EQ(TypeParam::Query(nullptr, 0, 1), -1);
+  EXPECT_EQ(TypeParam::Create(nullptr), nullptr);
+  TypeParam::Delete(index);
+}
+
+TYPED_TEST(PointToPointFileTest, FileRoundTrip) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 90, 5, false, 31u);
+  typename TypeParam::Index* built = TypeParam::Create(graph.getCsrGraph());
+  ASSERT_NE(built, nullptr);
+  ASSERT_TRUE(TypeParam::Save(built, TypeParam::kFile));
+  typename TypeParam::Index* loaded = TypeParam::Load(TypeParam::kFile);
+  ASSERT_NE(loaded, nullptr);
+  this->ExpectAllPairsMatch(graph, loaded);
+  TypeParam::Delete(loaded);
+  TypeParam::Delete(built);
+  std::remove(TypeParam::kFile);
+  EXPECT_FALSE(TypeParam::Save(nullptr, "unused"));
+}
+
+TYPED_TEST(PointToPointFileTest, DamagedFileIsRejected) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/weighted_graph.txt"));
+  typename TypeParam::Index* index = TypeParam::Create(graph.getCsrGraph());
+  ASSERT_NE(index, nullptr);
+  ASSERT_TRUE(TypeParam::Save(index, TypeParam::kFile));
+  TypeParam::Delete(index);
+  {
+    std::fstream file(TypeParam::kFile,
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(sizeof(typename TypeParam::Header) + 4);
+    const int kValue = 12345;
+    file.write(reinterpret_cast<const char*>(&kValue), sizeof(kValue));
+  }
+  EXPECT_EQ(TypeParam::Load(TypeParam::kFile), nullptr);
+  std::remove(TypeParam::kFile);
+  EXPECT_EQ(
+      TypeParam::Load("../datasets/incidence_matrix_src/weighted_graph.txt"),
+      nullptr);
+}
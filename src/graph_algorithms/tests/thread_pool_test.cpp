@@ -0,0 +1,48 @@
+#include <atomic>
+#include <vector>
+
+#include "../../test/main_test.h"
+#include "../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+struct CountTask {
+  std::atomic<int> calls{0};
+  std::vector<int> per_thread;
+};
+
+void Count(void* arg, int thread_index) {
+  CountTask* task = static_cast<CountTask*>(arg);
+  task->calls++;
+  task->per_thread[thread_index]++;
+}
+
+}  // namespace
+
+TEST(ThreadPoolTest, RunsTaskOnEveryThread) {
+  thread_pool_t* pool = thread_pool_create(4);
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(thread_pool_size(pool), 4);
+  CountTask task;
+  task.per_thread.assign(4, 0);
+  for (int round = 0; round < 100; round++) {
+    thread_pool_run(pool, Count, &task);
+    ASSERT_EQ(task.calls.load(), 4 * (round + 1));
+  }
+  for (int count : task.per_thread) EXPECT_EQ(count, 100);
+  thread_pool_delete(pool);
+}
+
+TEST(ThreadPoolTest, NullPoolRunsOnCaller) {
+  CountTask task;
+  task.per_thread.assign(1, 0);
+  EXPECT_EQ(thread_pool_size(nullptr), 1);
+  thread_pool_run(nullptr, Count, &task);
+  EXPECT_EQ(task.per_thread[0], 1);
+
+  thread_pool_t* pool = thread_pool_create(0);
+  ASSERT_NE(pool, nullptr);
+  EXPECT_GE(thread_pool_size(pool), 1);
+  thread_pool_delete(pool);
+  EXPECT_EQ(thread_pool_create(-1), nullptr);
+}
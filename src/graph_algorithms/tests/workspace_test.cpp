@@ -0,0 +1,100 @@
+#include <climits>
+#include <vector>
+
+#include "../../test/main_test.h"
+#include "../wrapper_for_gtest/graph_algorithms_wrapper.h"
+
+namespace {
+
+std::vector<int> Traverse(graph_workspace_t* workspace, int start, bool bfs) {
+  graph_traversal_result_t* result = traversal_result_create(workspace->size);
+  if (bfs) {
+    breadth_first_search_with_workspace(workspace, start, result);
+  } else {
+    depth_first_search_with_workspace(workspace, start, result);
+  }
+  std::vector<int> vertices(result->visited_vertices,
+                            result->visited_vertices + result->size);
+  traversal_result_delete(result);
+  return vertices;
+}
+
+}  // namespace
+
+TEST(WorkspaceTest, RepeatedQueriesMatchPlainVersions) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 70, 6, true, 99u, 9);
+  GraphAlgorithmsWrapper algorithms;
+  graph_workspace_t* workspace = graph_workspace_create(graph.getGraph());
+  ASSERT_NE(workspace, nullptr);
+
+  for (int start = 0; start < graph.getOrder(); start++) {
+    ASSERT_EQ(Traverse(workspace, start, true),
+              algorithms.breadthFirstSearch(graph, start));
+    ASSERT_EQ(Traverse(workspace, start, false),
+              algorithms.depthFirstSearch(graph, start));
+    for (int target = 0; target < graph.getOrder(); target += 3) {
+      ASSERT_EQ(get_shortest_path_between_vertices_with_workspace(
+                    workspace, start, target),
+                algorithms.getShortestPathBetweenVertices(graph, start,
+                                                          target));
+    }
+  }
+  graph_workspace_delete(workspace);
+}
+
+TEST(WorkspaceTest, LeastSpanningTreeMatchesPlainVersion) {
+  GraphWrapper graph;
+  ASSERT_TRUE(graph.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/graph_examples.txt"));
+  GraphAlgorithmsWrapper algorithms;
+  graph_workspace_t* workspace = graph_workspace_create(graph.getGraph());
+  ASSERT_NE(workspace, nullptr);
+  const int size = graph.getOrder();
+  std::vector<std::vector<int>> mst(size, std::vector<int>(size, -1));
+  std::vector<int*> rows;
+  for (auto& row : mst) rows.push_back(row.data());
+
+  for (int repeat = 0; repeat < 2; repeat++) {
+    ASSERT_EQ(get_least_spanning_tree_with_workspace(workspace, rows.data()),
+              0);
+    EXPECT_EQ(mst, algorithms.getLeastSpanningTree(graph));
+  }
+  graph_workspace_delete(workspace);
+}
+
+TEST(WorkspaceTest, GenerationWrapClearsStamps) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 30, 10, true, 5u, 9);
+  GraphAlgorithmsWrapper algorithms;
+  graph_workspace_t* workspace = graph_workspace_create(graph.getGraph());
+  ASSERT_NE(workspace, nullptr);
+  const std::vector<int> expected = algorithms.breadthFirstSearch(graph, 0);
+  EXPECT_EQ(Traverse(workspace, 0, true), expected);
+
+  workspace->generation = UINT_MAX - 1;
+  for (int repeat = 0; repeat < 4; repeat++) {
+    EXPECT_EQ(Traverse(workspace, 0, true), expected);
+  }
+  EXPECT_EQ(workspace->generation, 3u);
+  graph_workspace_delete(workspace);
+}
+
+TEST(WorkspaceTest, RejectsResizedGraph) {
+  GraphWrapper graph;
+  FillRandomGraph(graph, 10, 50, true, 3u, 9);
+  graph_workspace_t* workspace = graph_workspace_create(graph.getGraph());
+  ASSERT_NE(workspace, nullptr);
+  EXPECT_EQ(get_shortest_path_between_vertices_with_workspace(workspace, 0, 0),
+            0);
+  EXPECT_EQ(get_shortest_path_between_vertices_with_workspace(workspace, 0, 10),
+            -1);
+
+  workspace->size = 11;
+  EXPECT_FALSE(graph_workspace_begin(workspace));
+  EXPECT_EQ(get_shortest_path_between_vertices_with_workspace(workspace, 0, 1),
+            -1);
+  workspace->size = 10;
+  EXPECT_EQ(graph_workspace_create(nullptr), nullptr);
+  graph_workspace_delete(workspace);
+}
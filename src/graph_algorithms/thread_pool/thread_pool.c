@@ -0,0 +1,173 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "thread_pool.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/**
+ * @brief pool state, guarded by mutex
+ * @param generation incremented for every task, workers wait for a change
+ * @param pending workers still running the current task
+ */
+struct thread_pool {
+  pthread_t *threads;
+  int thread_count;
+  pthread_mutex_t mutex;
+  pthread_cond_t task_ready;
+  pthread_cond_t task_done;
+  thread_pool_task_t task;
+  void *arg;
+  unsigned long long generation;
+  int pending;
+  bool stopping;
+};
+
+/**
+ * @brief argument of a worker, its pool and index
+ */
+typedef struct {
+  thread_pool_t *pool;
+  int index;
+} worker_t;
+
+static void *worker_main(void *arg) {
+  worker_t *worker = (worker_t *)arg;
+  thread_pool_t *pool = worker->pool;
+  const int index = worker->index;
+  free(worker);
+  unsigned long long seen = 0;
+  pthread_mutex_lock(&pool->mutex);
+  for (;;) {
+    while (!pool->stopping && pool->generation == seen) {
+      pthread_cond_wait(&pool->task_ready, &pool->mutex);
+    }
+    if (pool->stopping) break;
+    seen = pool->generation;
+    thread_pool_task_t task = pool->task;
+    void *task_arg = pool->arg;
+    pthread_mutex_unlock(&pool->mutex);
+    task(task_arg, index);
+    pthread_mutex_lock(&pool->mutex);
+    if (--pool->pending == 0) pthread_cond_signal(&pool->task_done);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return NULL;
+}
+
+static void stop_workers(thread_pool_t *pool, int started) {
+  pthread_mutex_lock(&pool->mutex);
+  pool->stopping = true;
+  pthread_cond_broadcast(&pool->task_ready);
+  pthread_mutex_unlock(&pool->mutex);
+  for (int i = 1; i < started; i++) pthread_join(pool->threads[i], NULL);
+}
+
+static bool start_workers(thread_pool_t *pool) {
+  int started = 1;
+  while (started < pool->thread_count) {
+    worker_t *worker = (worker_t *)malloc(sizeof(worker_t));
+    if (!worker) break;
+    worker->pool = pool;
+    worker->index = started;
+    if (pthread_create(&pool->threads[started], NULL, worker_main, worker)) {
+      free(worker);
+      break;
+    }
+    started++;
+  }
+  if (started < pool->thread_count) {
+    stop_workers(pool, started);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief creates a pool and starts its worker threads
+ * @param thread_count threads including the caller, 0 means one per core
+ * @return pool pointer or NULL if error
+ */
+thread_pool_t *thread_pool_create(int thread_count) {
+  if (thread_count < 0) return NULL;
+  if (thread_count == 0) {
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    thread_count = cores > 0 ? (int)cores : 1;
+  }
+  thread_pool_t *pool = (thread_pool_t *)calloc(1, sizeof(thread_pool_t));
+  if (!pool) return NULL;
+  pool->thread_count = thread_count;
+  pool->threads = (pthread_t *)malloc((size_t)thread_count * sizeof(pthread_t));
+  bool success = pool->threads != NULL;
+  success = success && pthread_mutex_init(&pool->mutex, NULL) == 0;
+  if (success && pthread_cond_init(&pool->task_ready, NULL) != 0) {
+    pthread_mutex_destroy(&pool->mutex);
+    success = false;
+  }
+  if (success && pthread_cond_init(&pool->task_done, NULL) != 0) {
+    pthread_cond_destroy(&pool->task_ready);
+    pthread_mutex_destroy(&pool->mutex);
+    success = false;
+  }
+  if (success && !start_workers(pool)) {
+    pthread_cond_destroy(&pool->task_done);
+    pthread_cond_destroy(&pool->task_ready);
+    pthread_mutex_destroy(&pool->mutex);
+    success = false;
+  }
+  if (!success) {
+    free(pool->threads);
+    free(pool);
+    pool = NULL;
+  }
+  return pool;
+}
+
+/**
+ * @brief stops and joins the workers, frees the pool
+ */
+void thread_pool_delete(thread_pool_t *pool) {
+  if (!pool) return;
+  stop_workers(pool, pool->thread_count);
+  pthread_cond_destroy(&pool->task_done);
+  pthread_cond_destroy(&pool->task_ready);
+  pthread_mutex_destroy(&pool->mutex);
+  free(pool->threads);
+  free(pool);
+}
+
+/**
+ * @brief number of threads running every task, 1 for a NULL pool
+ */
+int thread_pool_size(const thread_pool_t *pool) {
+  return pool ? pool->thread_count : 1;
+}
+
+/**
+ * @brief runs task on every thread of the pool and waits for all of them.
+ *
+ * Writes made by the task are visible to the caller when this returns.
+ * A NULL pool runs the task once on the calling thread.
+ * @param pool pool pointer or NULL
+ * @param task function to run
+ * @param arg its argument
+ */
+void thread_pool_run(thread_pool_t *pool, thread_pool_task_t task, void *arg) {
+  if (!pool || pool->thread_count == 1) {
+    task(arg, 0);
+    return;
+  }
+  pthread_mutex_lock(&pool->mutex);
+  pool->task = task;
+  pool->arg = arg;
+  pool->pending = pool->thread_count - 1;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->task_ready);
+  pthread_mutex_unlock(&pool->mutex);
+  task(arg, 0);
+  pthread_mutex_lock(&pool->mutex);
+  while (pool->pending > 0) pthread_cond_wait(&pool->task_done, &pool->mutex);
+  pthread_mutex_unlock(&pool->mutex);
+}
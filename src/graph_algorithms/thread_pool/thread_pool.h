@@ -0,0 +1,30 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief fixed set of worker threads that run one task at a time on every
+ * thread, the caller taking part as thread 0
+ */
+typedef struct thread_pool thread_pool_t;
+
+/**
+ * @brief task run by every thread of the pool
+ * @param arg argument given to thread_pool_run
+ * @param thread_index 0 for the calling thread, 1..count-1 for the workers
+ */
+typedef void (*thread_pool_task_t)(void *arg, int thread_index);
+
+thread_pool_t *thread_pool_create(int thread_count);
+void thread_pool_delete(thread_pool_t *pool);
+int thread_pool_size(const thread_pool_t *pool);
+void thread_pool_run(thread_pool_t *pool, thread_pool_task_t task, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_THREAD_POOL_H
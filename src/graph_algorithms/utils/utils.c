@@ -23,6 +23,183 @@ graph_traversal_result_t* traversal_result_create(int size) {
   return result;
 }
 
+/**
+ * @brief Creates a levels result for traversals that build a search tree,
+ * every vertex starts unreached.
+ * @param size The number of vertices of the graph.
+ * @return A pointer to the created structure, or NULL if memory allocation
+ * failed.
+ */
+graph_levels_result_t* levels_result_create(int size) {
+  if (size < 0) return NULL;
+  graph_levels_result_t* result =
+      (graph_levels_result_t*)malloc(sizeof(graph_levels_result_t));
+  if (result != NULL) {
+    result->levels = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    result->parents = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    result->order = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    result->size = size;
+    result->reached = 0;
+    if (result->levels == NULL || result->parents == NULL ||
+        result->order == NULL) {
+      levels_result_delete(result);
+      result = NULL;
+    }
+  }
+  for (int v = 0; result != NULL && v < size; v++) {
+    result->levels[v] = -1;
+    result->parents[v] = -1;
+  }
+  return result;
+}
+
+/**
+ * @brief Deletes a levels result.
+ * @param result Pointer to the structure to be deleted.
+ */
+void levels_result_delete(graph_levels_result_t* result) {
+  if (result != NULL) {
+    free(result->levels);
+    free(result->parents);
+    free(result->order);
+    free(result);
+  }
+}
+
+/**
+ * @brief Marks every vertex unreached again, O(reached) instead of O(V)
+ * because only the vertices listed in order were touched.
+ * @param result Pointer to the structure to reset.
+ */
+void levels_result_reset(graph_levels_result_t* result) {
+  for (int i = 0; i < result->reached; i++) {
+    result->levels[result->order[i]] = -1;
+    result->parents[result->order[i]] = -1;
+  }
+  result->reached = 0;
+}
+
+/**
+ * @brief Writes the tree path from the start vertex to target.
+ * @param result Result of a traversal.
+ * @param target Last vertex of the path.
+ * @param path Receives levels[target] + 1 vertices, start vertex first.
+ * @return Number of vertices in the path, or -1 if target was not reached.
+ */
+int levels_result_path(const graph_levels_result_t* result, int target,
+                       int* path) {
+  if (result == NULL || path == NULL || target < 0 || target >= result->size ||
+      result->levels[target] < 0) {
+    return -1;
+  }
+  const int length = result->levels[target] + 1;
+  int vertex = target;
+  for (int i = length - 1; i >= 0; i--) {
+    path[i] = vertex;
+    vertex = result->parents[vertex];
+  }
+  return length;
+}
+
+/**
+ * @brief Checks the stop conditions of a bounded traversal.
+ * @param limits Stop conditions, NULL for an unbounded traversal.
+ * @param vertex The vertex that was just visited.
+ * @param visited The number of vertices visited so far.
+ * @return true if the traversal has to stop.
+ */
+bool traversal_limits_reached(const traversal_limits_t* limits, int vertex,
+                              int visited) {
+  return limits != NULL &&
+         (vertex == limits->target_vertex ||
+          (limits->max_visited > 0 && visited >= limits->max_visited));
+}
+
+/**
+ * @brief Creates a shortest-path tree, every vertex starts unreachable.
+ * @param size The number of vertices of the graph.
+ * @return A pointer to the created structure, or NULL if memory allocation
+ * failed.
+ */
+shortest_path_tree_t* shortest_path_tree_create(int size) {
+  if (size < 0) return NULL;
+  shortest_path_tree_t* tree =
+      (shortest_path_tree_t*)malloc(sizeof(shortest_path_tree_t));
+  if (tree != NULL) {
+    tree->dist = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    tree->pred = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    tree->size = size;
+    tree->source = -1;
+    if (tree->dist == NULL || tree->pred == NULL) {
+      shortest_path_tree_delete(tree);
+      tree = NULL;
+    }
+  }
+  for (int v = 0; tree != NULL && v < size; v++) {
+    tree->dist[v] = -1;
+    tree->pred[v] = -1;
+  }
+  return tree;
+}
+
+/**
+ * @brief Deletes a shortest-path tree.
+ * @param tree Pointer to the structure to be deleted.
+ */
+void shortest_path_tree_delete(shortest_path_tree_t* tree) {
+  if (tree != NULL) {
+    free(tree->dist);
+    free(tree->pred);
+    free(tree);
+  }
+}
+
+/**
+ * @brief Writes a shortest path from the source of the tree to target in
+ * O(path length).
+ * @param tree Result of a single-source search.
+ * @param target Last vertex of the path.
+ * @param path Receives the vertices of the path, source first, room for
+ * tree->size vertices.
+ * @return Number of vertices in the path, or -1 if target is unreachable.
+ */
+int shortest_path_tree_path(const shortest_path_tree_t* tree, int target,
+                            int* path) {
+  if (tree == NULL || path == NULL || target < 0 || target >= tree->size ||
+      tree->dist[target] < 0) {
+    return -1;
+  }
+  int length = 0;
+  for (int v = target; v >= 0; v = tree->pred[v]) length++;
+  int vertex = target;
+  for (int i = length - 1; i >= 0; i--) {
+    path[i] = vertex;
+    vertex = tree->pred[vertex];
+  }
+  return length;
+}
+
+/**
+ * @brief Creates a graph traversal result inside an arena.
+ * @param size The size of the result structure.
+ * @param arena Arena the structure and its array are taken from, they are
+ * freed by arena_reset, never by traversal_result_delete.
+ * @return A pointer to the created structure, or NULL if allocation failed.
+ */
+graph_traversal_result_t* traversal_result_create_arena(int size,
+                                                        arena_t* arena) {
+  if (size < 0) return NULL;
+  graph_traversal_result_t* result = (graph_traversal_result_t*)arena_alloc(
+      arena, sizeof(graph_traversal_result_t));
+  if (result != NULL) {
+    result->visited_vertices =
+        (int*)arena_alloc(arena, (size_t)size * sizeof(int));
+    result->size = 0;
+    if (result->visited_vertices == NULL) result = NULL;
+  }
+  return result;
+}
+
 /**
  * @brief Deletes a graph traversal result.
  *
@@ -0,0 +1,68 @@
+#include "workspace.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief creates a workspace for the queries on graph
+ * @param graph graph the workspace is bound to, it must outlive the workspace
+ * @return workspace pointer or NULL if error
+ */
+graph_workspace_t *graph_workspace_create(graph_t *graph) {
+  if (!graph || !graph->adjacency || !graph->adjacency->data ||
+      graph->adjacency->size <= 0) {
+    return NULL;
+  }
+  const size_t size = (size_t)graph->adjacency->size;
+  graph_workspace_t *workspace =
+      (graph_workspace_t *)calloc(1, sizeof(graph_workspace_t));
+  if (!workspace) return NULL;
+  workspace->graph = graph;
+  workspace->size = graph->adjacency->size;
+  workspace->visited = (unsigned *)calloc(size, sizeof(unsigned));
+  workspace->reached = (unsigned *)calloc(size, sizeof(unsigned));
+  workspace->dist = (int *)malloc(size * sizeof(int));
+  workspace->parent = (int *)malloc(size * sizeof(int));
+  workspace->buffer = (int *)malloc(size * sizeof(int));
+  if (!workspace->visited || !workspace->reached || !workspace->dist ||
+      !workspace->parent || !workspace->buffer) {
+    graph_workspace_delete(workspace);
+    workspace = NULL;
+  }
+  return workspace;
+}
+
+/**
+ * @brief frees the workspace, the graph is not touched
+ */
+void graph_workspace_delete(graph_workspace_t *workspace) {
+  if (!workspace) return;
+  free(workspace->visited);
+  free(workspace->reached);
+  free(workspace->dist);
+  free(workspace->parent);
+  free(workspace->buffer);
+  free(workspace);
+}
+
+/**
+ * @brief starts a query: every vertex becomes unvisited and unreached.
+ *
+ * O(1) except once every 2^32 queries, when the stamps wrap around and are
+ * cleared.
+ * @return false if the workspace is NULL or the graph was resized since the
+ * workspace was created
+ */
+bool graph_workspace_begin(graph_workspace_t *workspace) {
+  if (!workspace || !workspace->graph->adjacency ||
+      !workspace->graph->adjacency->data ||
+      workspace->graph->adjacency->size != workspace->size) {
+    return false;
+  }
+  if (++workspace->generation == 0) {
+    memset(workspace->visited, 0, (size_t)workspace->size * sizeof(unsigned));
+    memset(workspace->reached, 0, (size_t)workspace->size * sizeof(unsigned));
+    workspace->generation = 1;
+  }
+  return true;
+}
@@ -0,0 +1,72 @@
+#ifndef S21_WORKSPACE_H
+#define S21_WORKSPACE_H
+
+#include <stdbool.h>
+
+#include "../../graph/s21_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief scratch buffers of the algorithms, bound to one graph and reused by
+ * every query on it.
+ *
+ * A vertex is visited (or reached) in the current query when its stamp
+ * equals generation, so starting a query is a counter increment instead of
+ * clearing O(V) arrays. dist and parent are only meaningful for reached
+ * vertices.
+ * @param graph graph the buffers are sized for
+ * @param size number of vertices the buffers hold
+ * @param generation stamp of the current query
+ * @param visited stamps of visited (settled, in-tree) vertices
+ * @param reached stamps of vertices whose dist and parent are set
+ * @param dist distances of dijkstra, keys of prim
+ * @param parent tree parents of prim
+ * @param buffer queue, stack or frontier, size vertices
+ */
+typedef struct {
+  graph_t *graph;
+  int size;
+  unsigned generation;
+  unsigned *visited;
+  unsigned *reached;
+  int *dist;
+  int *parent;
+  int *buffer;
+} graph_workspace_t;
+
+graph_workspace_t *graph_workspace_create(graph_t *graph);
+void graph_workspace_delete(graph_workspace_t *workspace);
+bool graph_workspace_begin(graph_workspace_t *workspace);
+
+/**
+ * @brief true if vertex was visited since the last graph_workspace_begin
+ */
+static inline bool workspace_is_visited(const graph_workspace_t *workspace,
+                                        int vertex) {
+  return workspace->visited[vertex] == workspace->generation;
+}
+
+static inline void workspace_visit(graph_workspace_t *workspace, int vertex) {
+  workspace->visited[vertex] = workspace->generation;
+}
+
+/**
+ * @brief true if dist and parent of vertex were set in the current query
+ */
+static inline bool workspace_is_reached(const graph_workspace_t *workspace,
+                                        int vertex) {
+  return workspace->reached[vertex] == workspace->generation;
+}
+
+static inline void workspace_reach(graph_workspace_t *workspace, int vertex) {
+  workspace->reached[vertex] = workspace->generation;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // S21_WORKSPACE_H
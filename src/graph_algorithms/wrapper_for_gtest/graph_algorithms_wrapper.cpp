@@ -1,5 +1,11 @@
 #include "graph_algorithms_wrapper.h"
 
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <queue>
+#include <utility>
+
 GraphAlgorithmsWrapper::~GraphAlgorithmsWrapper() {}
 
 std::vector<int> GraphAlgorithmsWrapper::depthFirstSearch(GraphWrapper& graph,
@@ -26,6 +32,46 @@ std::vector<int> GraphAlgorithmsWrapper::breadthFirstSearch(GraphWrapper& graph,
   return bfs_result;
 }
 
+std::vector<int> GraphAlgorithmsWrapper::depthFirstSearchCsr(
+    GraphWrapper& graph, int startVertex) {
+  csr_graph_t* csr = graph.getCsrGraph();
+  graph_traversal_result_t* result = traversal_result_create(csr->size);
+  depth_first_search_csr(csr, startVertex, result);
+  std::vector<int> traversalResult = traversalResultToVector(result);
+  traversal_result_delete(result);
+  return traversalResult;
+}
+
+std::vector<int> GraphAlgorithmsWrapper::breadthFirstSearchCsr(
+    GraphWrapper& graph, int startVertex) {
+  csr_graph_t* csr = graph.getCsrGraph();
+  graph_traversal_result_t* result = traversal_result_create(csr->size);
+  breadth_first_search_csr(csr, startVertex, result);
+  std::vector<int> traversalResult = traversalResultToVector(result);
+  traversal_result_delete(result);
+  return traversalResult;
+}
+
+std::vector<int> GraphAlgorithmsWrapper::depthFirstSearchBits(
+    GraphWrapper& graph, int startVertex) {
+  bit_matrix_t* bits = graph.getBitMatrix();
+  graph_traversal_result_t* result = traversal_result_create(bits->size);
+  depth_first_search_bits(bits, startVertex, result);
+  std::vector<int> traversalResult = traversalResultToVector(result);
+  traversal_result_delete(result);
+  return traversalResult;
+}
+
+std::vector<int> GraphAlgorithmsWrapper::breadthFirstSearchBits(
+    GraphWrapper& graph, int startVertex) {
+  bit_matrix_t* bits = graph.getBitMatrix();
+  graph_traversal_result_t* result = traversal_result_create(bits->size);
+  breadth_first_search_bits(bits, startVertex, result);
+  std::vector<int> traversalResult = traversalResultToVector(result);
+  traversal_result_delete(result);
+  return traversalResult;
+}
+
 std::vector<int> GraphAlgorithmsWrapper::traversalResultToVector(
     graph_traversal_result_t* result) {
   std::vector<int> traversalResult;
@@ -43,6 +89,12 @@ int GraphAlgorithmsWrapper::getShortestPathBetweenVertices(GraphWrapper& graph,
   return get_shortest_path_between_vertices(graph.getGraph(), vertex1, vertex2);
 }
 
+int GraphAlgorithmsWrapper::getShortestPathBetweenVerticesCsr(
+    GraphWrapper& graph, int vertex1, int vertex2) {
+  return get_shortest_path_between_vertices_csr(graph.getCsrGraph(), vertex1,
+                                                vertex2);
+}
+
 std::vector<std::vector<int>>
 GraphAlgorithmsWrapper::getShortestPathsBetweenAllVertices(
     GraphWrapper& graph) {
@@ -83,6 +135,27 @@ std::vector<std::vector<int>> GraphAlgorithmsWrapper::getLeastSpanningTree(
   return result;
 }
 
+std::vector<std::vector<int>> GraphAlgorithmsWrapper::getLeastSpanningTreeCsr(
+    GraphWrapper& graph) {
+  csr_graph_t* csr = graph.getCsrGraph();
+  if (csr->size == 0) {
+    return {};
+  }
+  const int size = csr->size;
+  int** mst = allocate_matrix(size);
+  if (!mst) {
+    return {};
+  }
+  std::vector<std::vector<int>> result;
+  if (get_least_spanning_tree_csr(csr, mst) == 0) {
+    for (int i = 0; i < size; ++i) {
+      result.emplace_back(mst[i], mst[i] + size);
+    }
+  }
+  free_matrix(mst, size);
+  return result;
+}
+
 GraphAlgorithmsWrapper::TsmResult
 GraphAlgorithmsWrapper::solveTravelingSalesmanProblem(
     const GraphWrapper& graph) {
@@ -135,3 +208,91 @@ GraphAlgorithmsWrapper::solveTravelingSalesmanProblem(
   tsm_result_delete(result);
   return tsmResult;
 }
+
+void FillRandomGraph(GraphWrapper& graph, int size, int percent,
+                     bool symmetric, unsigned seed, int max_weight) {
+  graph.createGraph(size);
+  unsigned state = seed;
+  for (int i = 0; i < size; i++) {
+    for (int j = symmetric ? i + 1 : 0; j < size; j++) {
+      state = state * 1103515245u + 12345u;
+      const int weight =
+          i != j && (int)((state >> 16) % 100) < percent
+              ? 1 + (int)((state >> 4) % (unsigned)max_weight)
+              : 0;
+      matrix_row(graph.getGraph()->adjacency, i)[j] = weight;
+      if (symmetric) matrix_row(graph.getGraph()->adjacency, j)[i] = weight;
+    }
+  }
+}
+
+void ExpectAllPairsMatchTree(GraphWrapper& graph,
+                             const std::function<int(int, int)>& query) {
+  shortest_path_tree_t* tree = shortest_path_tree_create(graph.getOrder());
+  ASSERT_NE(tree, nullptr);
+  for (int from = 0; from < graph.getOrder(); from++) {
+    ASSERT_TRUE(get_shortest_path_tree(graph.getGraph(), from, tree));
+    for (int to = 0; to < graph.getOrder(); to++) {
+      ASSERT_EQ(query(from, to), tree->dist[to]) << from << " -> " << to;
+    }
+  }
+  shortest_path_tree_delete(tree);
+}
+
+csr_graph_t* RandomCsrGraph(int size, int edges, int max_weight,
+                            unsigned seed) {
+  std::vector<int> sources, targets, weights;
+  unsigned state = seed;
+  for (int i = 0; i < edges; i++) {
+    state = state * 1103515245u + 12345u;
+    sources.push_back((state >> 4) % size);
+    state = state * 1103515245u + 12345u;
+    targets.push_back((state >> 4) % size);
+    state = state * 1103515245u + 12345u;
+    weights.push_back(1 + (int)((state >> 4) % (unsigned)max_weight));
+  }
+  return csr_graph_from_edges(size, edges, sources.data(), targets.data(),
+                              weights.data());
+}
+
+std::vector<int> ReferenceBfsLevels(const csr_graph_t* graph, int start) {
+  std::vector<int> levels(graph->size, -1);
+  std::queue<int> queue;
+  levels[start] = 0;
+  queue.push(start);
+  while (!queue.empty()) {
+    const int u = queue.front();
+    queue.pop();
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+      if (levels[graph->targets[e]] < 0) {
+        levels[graph->targets[e]] = levels[u] + 1;
+        queue.push(graph->targets[e]);
+      }
+    }
+  }
+  return levels;
+}
+
+std::vector<int> ReferenceDijkstraDistances(const csr_graph_t* graph,
+                                            int source) {
+  std::vector<int> dist(graph->size, INT_MAX);
+  std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>,
+                      std::greater<std::pair<int, int>>>
+      queue;
+  dist[source] = 0;
+  queue.push({0, source});
+  while (!queue.empty()) {
+    const auto [d, u] = queue.top();
+    queue.pop();
+    if (d != dist[u]) continue;
+    for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+      const int v = graph->targets[e];
+      if (graph->weights[e] > 0 && d + graph->weights[e] < dist[v]) {
+        dist[v] = d + graph->weights[e];
+        queue.push({dist[v], v});
+      }
+    }
+  }
+  for (int& d : dist) d = d == INT_MAX ? -1 : d;
+  return dist;
+}
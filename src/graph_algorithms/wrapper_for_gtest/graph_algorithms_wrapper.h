@@ -2,6 +2,7 @@
 #define GRAPH_ALGORITHMS_WRAPPER_H
 
 #include <climits>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -32,11 +33,19 @@ class GraphAlgorithmsWrapper {
 
   std::vector<int> depthFirstSearch(GraphWrapper& graph, int startVertex);
   std::vector<int> breadthFirstSearch(GraphWrapper& graph, int startVertex);
+  std::vector<int> depthFirstSearchCsr(GraphWrapper& graph, int startVertex);
+  std::vector<int> breadthFirstSearchCsr(GraphWrapper& graph, int startVertex);
+  std::vector<int> depthFirstSearchBits(GraphWrapper& graph, int startVertex);
+  std::vector<int> breadthFirstSearchBits(GraphWrapper& graph,
+                                         int startVertex);
   int getShortestPathBetweenVertices(GraphWrapper& graph, int vertex1,
                                      int vertex2);
   std::vector<std::vector<int>> getShortestPathsBetweenAllVertices(
       GraphWrapper& graph);
+  int getShortestPathBetweenVerticesCsr(GraphWrapper& graph, int vertex1,
+                                        int vertex2);
   std::vector<std::vector<int>> getLeastSpanningTree(GraphWrapper& graph);
+  std::vector<std::vector<int>> getLeastSpanningTreeCsr(GraphWrapper& graph);
   TsmResult solveTravelingSalesmanProblem(const GraphWrapper& graph);
   TsmResult solveTravelingSalesmanProblem(const GraphWrapper& graph,
                                           aco_params_t* params);
@@ -58,4 +67,52 @@ class GraphAlgorithmsWrapper {
   static constexpr int max_iterations_k_ = 1000;
 };
 
+/**
+ * @brief fills a graph with random weights from a linear congruential
+ * generator, the same seed always gives the same graph
+ * @param graph graph to (re)create
+ * @param size number of vertices
+ * @param percent chance of an edge in percent
+ * @param symmetric mirror every edge, an undirected graph
+ * @param seed generator seed
+ * @param max_weight weights are drawn from [1, max_weight]
+ */
+void FillRandomGraph(GraphWrapper& graph, int size, int percent,
+                     bool symmetric, unsigned seed, int max_weight = 40);
+
+/**
+ * @brief checks query(from, to) for every pair of vertices against one
+ * get_shortest_path_tree per source
+ * @param graph graph the query answers for
+ * @param query distance or -1 if unreachable
+ */
+void ExpectAllPairsMatchTree(GraphWrapper& graph,
+                             const std::function<int(int, int)>& query);
+
+/**
+ * @brief csr graph of random edges from a linear congruential generator,
+ * parallel edges and loops may occur
+ * @param size number of vertices
+ * @param edges number of drawn edges
+ * @param max_weight weights are drawn from [1, max_weight]
+ * @param seed generator seed
+ * @return graph owned by the caller, csr_graph_delete
+ */
+csr_graph_t* RandomCsrGraph(int size, int edges, int max_weight,
+                            unsigned seed);
+
+/**
+ * @brief plain queue BFS, the reference for the bfs variants
+ * @return level of every vertex, -1 if unreachable
+ */
+std::vector<int> ReferenceBfsLevels(const csr_graph_t* graph, int start);
+
+/**
+ * @brief binary heap Dijkstra on std::priority_queue, the reference for
+ * the csr shortest-path engines
+ * @return distance of every vertex, -1 if unreachable
+ */
+std::vector<int> ReferenceDijkstraDistances(const csr_graph_t* graph,
+                                            int source);
+
 #endif  // GRAPH_ALGORITHMS_WRAPPER_H
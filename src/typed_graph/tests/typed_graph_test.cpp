@@ -0,0 +1,134 @@
+#include <climits>
+#include <stdexcept>
+
+#include "../../graph_algorithms/wrapper_for_gtest/graph_algorithms_wrapper.h"
+#include "../../test/main_test.h"
+#include "../typed_algorithms.h"
+
+namespace {
+
+const char* const kDatasets[] = {
+    "../datasets/incidence_matrix_src/graph_examples.txt",
+    "../datasets/incidence_matrix_src/weighted_graph.txt",
+    "../datasets/incidence_matrix_src/disconnected_graph.txt",
+    "../datasets/incidence_matrix_src/prim_basic.txt",
+    "../datasets/incidence_matrix_src/prim_equal_weights.txt",
+    "../datasets/incidence_matrix_src/tsp_asymmetric.txt",
+};
+
+template <typename Pair>
+class TypedGraphTest : public ::testing::Test {};
+
+template <typename W, typename I>
+struct TypePair {
+  using Weight = W;
+  using Index = I;
+};
+
+using TypePairs =
+    ::testing::Types<TypePair<uint8_t, uint32_t>, TypePair<uint16_t, uint64_t>,
+                     TypePair<int32_t, uint32_t>, TypePair<float, uint64_t>,
+                     TypePair<double, uint32_t>>;
+
+}  // namespace
+
+TYPED_TEST_SUITE(TypedGraphTest, TypePairs);
+
+TYPED_TEST(TypedGraphTest, AlgorithmsMatchIntGraph) {
+  using Weight = typename TypeParam::Weight;
+  using Index = typename TypeParam::Index;
+  using Graph = s21::TypedGraph<Weight, Index>;
+  GraphAlgorithmsWrapper algorithms;
+  for (const char* filename : kDatasets) {
+    SCOPED_TRACE(filename);
+    GraphWrapper reference;
+    ASSERT_TRUE(reference.loadGraphFromFile(filename));
+    const Graph graph = Graph::LoadFromFile(filename);
+    const int size = reference.getOrder();
+    ASSERT_EQ(graph.Size(), static_cast<Index>(size));
+
+    for (int start = 0; start < size; start++) {
+      const std::vector<int> dfs =
+          algorithms.depthFirstSearch(reference, start);
+      const std::vector<int> bfs =
+          algorithms.breadthFirstSearch(reference, start);
+      EXPECT_EQ(s21::DepthFirstSearch(graph, static_cast<Index>(start)),
+                std::vector<Index>(dfs.begin(), dfs.end()));
+      EXPECT_EQ(s21::BreadthFirstSearch(graph, static_cast<Index>(start)),
+                std::vector<Index>(bfs.begin(), bfs.end()));
+      for (int target = 0; target < size; target++) {
+        EXPECT_EQ(s21::GetShortestPathBetweenVertices(
+                      graph, static_cast<Index>(start),
+                      static_cast<Index>(target)),
+                  algorithms.getShortestPathBetweenVertices(reference, start,
+                                                            target));
+      }
+    }
+
+    const auto all_pairs = s21::GetShortestPathsBetweenAllVertices(graph);
+    const auto expected =
+        algorithms.getShortestPathsBetweenAllVertices(reference);
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        const auto distance = all_pairs[static_cast<size_t>(i) * size + j];
+        if (expected[i][j] == INT_MAX) {
+          EXPECT_EQ(distance, s21::kNoPath<Weight>);
+        } else {
+          EXPECT_EQ(distance, expected[i][j]);
+        }
+      }
+    }
+
+    Graph mst;
+    const auto expected_mst = algorithms.getLeastSpanningTree(reference);
+    ASSERT_EQ(s21::GetLeastSpanningTree(graph, &mst), !expected_mst.empty());
+    for (size_t i = 0; i < expected_mst.size(); i++) {
+      for (size_t j = 0; j < expected_mst.size(); j++) {
+        EXPECT_EQ(mst.At(static_cast<Index>(i), static_cast<Index>(j)),
+                  static_cast<Weight>(expected_mst[i][j]));
+      }
+    }
+  }
+}
+
+TEST(TypedGraphCoreTest, NarrowWeightsUseLessMemory) {
+  GraphWrapper reference;
+  ASSERT_TRUE(reference.loadGraphFromFile(
+      "../datasets/incidence_matrix_src/graph_examples.txt"));
+  const auto narrow =
+      s21::TypedGraph<uint8_t, uint32_t>::FromGraph(reference.getGraph());
+  const auto wide =
+      s21::TypedGraph<int32_t, uint64_t>::FromGraph(reference.getGraph());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(narrow.Row(0)) % MATRIX_ALIGNMENT, 0u);
+  EXPECT_EQ(narrow.Stride() * sizeof(uint8_t) % MATRIX_ALIGNMENT, 0u);
+  const s21::TypedGraph<uint8_t, uint32_t> narrow_large(1024);
+  const s21::TypedGraph<int32_t, uint64_t> wide_large(1024);
+  EXPECT_EQ(narrow_large.Bytes() * 4, wide_large.Bytes());
+  for (int i = 0; i < reference.getOrder(); i++) {
+    for (int j = 0; j < reference.getOrder(); j++) {
+      EXPECT_EQ(narrow.At(i, j), reference.getMatrixValue(i, j));
+      EXPECT_EQ(wide.At(i, j), reference.getMatrixValue(i, j));
+    }
+  }
+}
+
+TEST(TypedGraphCoreTest, WeightOutOfRangeThrows) {
+  const char* filename =
+      "../datasets/incidence_matrix_src/"
+      "weighted_graph_with_negative_vertices.txt";
+  EXPECT_THROW((s21::TypedGraph<uint8_t, uint32_t>::LoadFromFile(filename)),
+               std::out_of_range);
+  EXPECT_NO_THROW((s21::TypedGraph<int32_t, uint32_t>::LoadFromFile(filename)));
+  EXPECT_THROW((s21::TypedGraph<uint8_t, uint32_t>::LoadFromFile(
+                   "../datasets/incidence_matrix_src/missing.txt")),
+               std::runtime_error);
+}
+
+TEST(TypedGraphCoreTest, HugeSizeIsRejectedBeforeAllocation) {
+  // 2^40 vertices: the cell count 2^80 does not fit size_t
+  EXPECT_THROW((s21::TypedGraph<uint8_t, uint64_t>(uint64_t{1} << 40)),
+               std::length_error);
+  const s21::TypedGraph<uint8_t, uint64_t> empty;
+  EXPECT_EQ(empty.Bytes(), 0u);
+  EXPECT_TRUE(s21::BreadthFirstSearch(empty, uint64_t{0}).empty());
+}
@@ -0,0 +1,213 @@
+#include "typed_algorithms.h"
+
+#include <utility>
+
+namespace s21 {
+
+namespace {
+
+template <typename Index>
+constexpr Index kNoVertex = std::numeric_limits<Index>::max();
+
+}  // namespace
+
+/**
+ * Depth first search algorithm
+ * @brief same visiting order as depth_first_search: a vertex is marked on
+ * push and neighbours are pushed in descending order
+ * @param graph typed graph
+ * @param start_vertex start vertex
+ * @return visited vertices, empty if start_vertex is out of range
+ */
+template <typename Weight, typename Index>
+std::vector<Index> DepthFirstSearch(const TypedGraph<Weight, Index>& graph,
+                                    Index start_vertex) {
+  std::vector<Index> result;
+  const Index size = graph.Size();
+  if (start_vertex >= size) return result;
+  std::vector<uint8_t> visited(size, 0);
+  std::vector<Index> stack{start_vertex};
+  visited[start_vertex] = 1;
+  while (!stack.empty()) {
+    const Index current = stack.back();
+    stack.pop_back();
+    result.push_back(current);
+    const Weight* row = graph.Row(current);
+    for (Index n = size; n-- > 0;) {
+      if (row[n] != Weight(0) && !visited[n]) {
+        stack.push_back(n);
+        visited[n] = 1;
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief breadth first search (BFS), the result doubles as the queue
+ * @param graph typed graph
+ * @param start_vertex start vertex
+ * @return visited vertices, empty if start_vertex is out of range
+ */
+template <typename Weight, typename Index>
+std::vector<Index> BreadthFirstSearch(const TypedGraph<Weight, Index>& graph,
+                                      Index start_vertex) {
+  std::vector<Index> result;
+  const Index size = graph.Size();
+  if (start_vertex >= size) return result;
+  std::vector<uint8_t> visited(size, 0);
+  result.push_back(start_vertex);
+  visited[start_vertex] = 1;
+  for (std::size_t head = 0; head < result.size(); head++) {
+    const Weight* row = graph.Row(result[head]);
+    for (Index n = 0; n < size; n++) {
+      if (row[n] != Weight(0) && !visited[n]) {
+        result.push_back(n);
+        visited[n] = 1;
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * Dijkstra’s algorithm, only with positive edges of the graph
+ * @brief finds the shortest path between two vertices
+ * @param graph typed graph
+ * @return shortest path length (v1 x v2) or -1 if error or no path
+ */
+template <typename Weight, typename Index>
+Distance<Weight> GetShortestPathBetweenVertices(
+    const TypedGraph<Weight, Index>& graph, Index vertex1, Index vertex2) {
+  using Dist = Distance<Weight>;
+  const Index size = graph.Size();
+  if (vertex1 >= size || vertex2 >= size) return Dist(-1);
+  if (vertex1 == vertex2) return Dist(0);
+  std::vector<Dist> dist(size, kNoPath<Weight>);
+  std::vector<uint8_t> visited(size, 0);
+  dist[vertex1] = 0;
+  for (Index i = 0; i + 1 < size; i++) {
+    Index u = kNoVertex<Index>;
+    for (Index v = 0; v < size; v++) {
+      if (!visited[v] && dist[v] < kNoPath<Weight> &&
+          (u == kNoVertex<Index> || dist[v] < dist[u])) {
+        u = v;
+      }
+    }
+    if (u == kNoVertex<Index> || u == vertex2) break;
+    visited[u] = 1;
+    const Weight* row = graph.Row(u);
+    for (Index v = 0; v < size; v++) {
+      if (!visited[v] && row[v] > Weight(0)) {
+        const Dist candidate = dist[u] + static_cast<Dist>(row[v]);
+        if (candidate < dist[v]) dist[v] = candidate;
+      }
+    }
+  }
+  return dist[vertex2] == kNoPath<Weight> ? Dist(-1) : dist[vertex2];
+}
+
+/**
+ * @brief Floyd–Warshall over every non-zero edge
+ * @param graph typed graph
+ * @return row-major size x size distance matrix, kNoPath for unreachable
+ * pairs
+ */
+template <typename Weight, typename Index>
+std::vector<Distance<Weight>> GetShortestPathsBetweenAllVertices(
+    const TypedGraph<Weight, Index>& graph) {
+  using Dist = Distance<Weight>;
+  const std::size_t size = graph.Size();
+  std::vector<Dist> dist(size * size, kNoPath<Weight>);
+  for (std::size_t i = 0; i < size; i++) {
+    const Weight* row = graph.Row(static_cast<Index>(i));
+    for (std::size_t j = 0; j < size; j++) {
+      if (i == j) {
+        dist[i * size + j] = 0;
+      } else if (row[j] != Weight(0)) {
+        dist[i * size + j] = static_cast<Dist>(row[j]);
+      }
+    }
+  }
+  for (std::size_t k = 0; k < size; k++) {
+    const Dist* through = &dist[k * size];
+    for (std::size_t i = 0; i < size; i++) {
+      Dist* from = &dist[i * size];
+      const Dist to_k = from[k];
+      if (to_k == kNoPath<Weight>) continue;
+      for (std::size_t j = 0; j < size; j++) {
+        if (through[j] != kNoPath<Weight> && to_k + through[j] < from[j]) {
+          from[j] = to_k + through[j];
+        }
+      }
+    }
+  }
+  return dist;
+}
+
+/**
+ * Minimum Spanning Tree (Prim's algorithm)
+ * @brief finds the same tree as get_least_spanning_tree: ties are broken by
+ * (weight, source, target)
+ * @param graph typed graph
+ * @param mst receives the tree as a symmetric matrix
+ * @return true on success, false if the graph is empty or disconnected
+ */
+template <typename Weight, typename Index>
+bool GetLeastSpanningTree(const TypedGraph<Weight, Index>& graph,
+                          TypedGraph<Weight, Index>* mst) {
+  const Index size = graph.Size();
+  if (!mst || size == 0) return false;
+  TypedGraph<Weight, Index> tree(size);
+  std::vector<uint8_t> visited(size, 0);
+  std::vector<Weight> key(size, Weight(0));
+  std::vector<Index> parent(size, kNoVertex<Index>);
+  bool success = true;
+  for (Index e = 0; success && e < size; e++) {
+    Index current = 0;
+    if (e > 0) {
+      current = kNoVertex<Index>;
+      for (Index v = 0; v < size; v++) {
+        if (!visited[v] && parent[v] != kNoVertex<Index> &&
+            (current == kNoVertex<Index> || key[v] < key[current] ||
+             (key[v] == key[current] && parent[v] < parent[current]))) {
+          current = v;
+        }
+      }
+      success = current != kNoVertex<Index>;
+    }
+    if (success) {
+      if (e > 0) {
+        tree.Set(parent[current], current, key[current]);
+        tree.Set(current, parent[current], key[current]);
+      }
+      visited[current] = 1;
+      const Weight* row = graph.Row(current);
+      for (Index v = 0; v < size; v++) {
+        const Weight weight = row[v];
+        if (!visited[v] && weight != Weight(0) &&
+            (parent[v] == kNoVertex<Index> || weight < key[v] ||
+             (weight == key[v] && current < parent[v]))) {
+          key[v] = weight;
+          parent[v] = current;
+        }
+      }
+    }
+  }
+  if (success) *mst = std::move(tree);
+  return success;
+}
+
+#define S21_TYPED_ALGORITHMS_INSTANTIATE(W, I)                             \
+  template std::vector<I> DepthFirstSearch(const TypedGraph<W, I>&, I);   \
+  template std::vector<I> BreadthFirstSearch(const TypedGraph<W, I>&, I); \
+  template Distance<W> GetShortestPathBetweenVertices(                    \
+      const TypedGraph<W, I>&, I, I);                                     \
+  template std::vector<Distance<W>> GetShortestPathsBetweenAllVertices(   \
+      const TypedGraph<W, I>&);                                           \
+  template bool GetLeastSpanningTree(const TypedGraph<W, I>&,             \
+                                     TypedGraph<W, I>*);
+S21_TYPED_GRAPH_INSTANTIATIONS(S21_TYPED_ALGORITHMS_INSTANTIATE)
+#undef S21_TYPED_ALGORITHMS_INSTANTIATE
+
+}  // namespace s21
@@ -0,0 +1,64 @@
+#ifndef S21_TYPED_ALGORITHMS_H
+#define S21_TYPED_ALGORITHMS_H
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "typed_graph.h"
+
+namespace s21 {
+
+/**
+ * @brief type of path lengths: sums of integer weights never overflow it,
+ * floating weights are summed in double
+ */
+template <typename Weight>
+using Distance =
+    std::conditional_t<std::is_floating_point_v<Weight>, double, int64_t>;
+
+/**
+ * @brief all pairs distance of two vertices without a path between them
+ */
+template <typename Weight>
+inline constexpr Distance<Weight> kNoPath =
+    std::numeric_limits<Distance<Weight>>::max();
+
+template <typename Weight, typename Index>
+std::vector<Index> DepthFirstSearch(const TypedGraph<Weight, Index>& graph,
+                                    Index start_vertex);
+
+template <typename Weight, typename Index>
+std::vector<Index> BreadthFirstSearch(const TypedGraph<Weight, Index>& graph,
+                                      Index start_vertex);
+
+template <typename Weight, typename Index>
+Distance<Weight> GetShortestPathBetweenVertices(
+    const TypedGraph<Weight, Index>& graph, Index vertex1, Index vertex2);
+
+template <typename Weight, typename Index>
+std::vector<Distance<Weight>> GetShortestPathsBetweenAllVertices(
+    const TypedGraph<Weight, Index>& graph);
+
+template <typename Weight, typename Index>
+bool GetLeastSpanningTree(const TypedGraph<Weight, Index>& graph,
+                          TypedGraph<Weight, Index>* mst);
+
+#define S21_TYPED_ALGORITHMS_EXTERN(W, I)                                   \
+  extern template std::vector<I> DepthFirstSearch(const TypedGraph<W, I>&, \
+                                                  I);                       \
+  extern template std::vector<I> BreadthFirstSearch(                        \
+      const TypedGraph<W, I>&, I);                                          \
+  extern template Distance<W> GetShortestPathBetweenVertices(               \
+      const TypedGraph<W, I>&, I, I);                                       \
+  extern template std::vector<Distance<W>>                                  \
+  GetShortestPathsBetweenAllVertices(const TypedGraph<W, I>&);              \
+  extern template bool GetLeastSpanningTree(const TypedGraph<W, I>&,        \
+                                            TypedGraph<W, I>*);
+S21_TYPED_GRAPH_INSTANTIATIONS(S21_TYPED_ALGORITHMS_EXTERN)
+#undef S21_TYPED_ALGORITHMS_EXTERN
+
+}  // namespace s21
+
+#endif  // S21_TYPED_ALGORITHMS_H
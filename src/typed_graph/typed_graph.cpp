@@ -0,0 +1,147 @@
+#include "typed_graph.h"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../graph/parser/text_scanner.h"
+
+namespace s21 {
+
+namespace {
+
+/**
+ * @brief row length rounded up to a whole cache line of cells
+ * @throw std::length_error if the matrix does not fit the address space
+ */
+template <typename Weight>
+std::size_t RowStride(std::size_t size) {
+  constexpr std::size_t kCellsPerLine = MATRIX_ALIGNMENT / sizeof(Weight);
+  constexpr std::size_t kMaxCells =
+      std::numeric_limits<std::size_t>::max() / sizeof(Weight);
+  if (size > kMaxCells - (kCellsPerLine - 1)) {
+    throw std::length_error("Graph size exceeds the address space");
+  }
+  const std::size_t stride =
+      (size + kCellsPerLine - 1) / kCellsPerLine * kCellsPerLine;
+  if (size != 0 && stride > kMaxCells / size) {
+    throw std::length_error("Graph size exceeds the address space");
+  }
+  return stride;
+}
+
+/**
+ * @brief closes the scanner when loading leaves the scope, also on throw
+ */
+struct ScannerClose {
+  void operator()(text_scanner_t* scanner) const noexcept {
+    text_scanner_close(scanner);
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief creates a graph without edges
+ * @param size number of vertices
+ * @throw std::length_error if the matrix does not fit the address space,
+ * std::bad_alloc if it cannot be allocated
+ */
+template <typename Weight, typename Index>
+TypedGraph<Weight, Index>::TypedGraph(Index size)
+    : size_(size), stride_(RowStride<Weight>(size)) {
+  const std::size_t bytes = Bytes();
+  if (bytes != 0) {
+    cells_.reset(static_cast<Weight*>(
+        ::operator new(bytes, std::align_val_t(MATRIX_ALIGNMENT))));
+    std::memset(static_cast<void*>(cells_.get()), 0, bytes);
+  }
+}
+
+/**
+ * @brief checks that an int weight is representable without loss of range
+ * @param weight weight read from a graph_t or a file
+ * @return true if the weight fits Weight
+ */
+template <typename Weight, typename Index>
+bool TypedGraph<Weight, Index>::Fits(long long weight) noexcept {
+  if constexpr (std::is_floating_point_v<Weight>) {
+    return true;
+  } else {
+    using Limits = std::numeric_limits<Weight>;
+    return weight >= static_cast<long long>(Limits::min()) &&
+           weight <= static_cast<long long>(Limits::max());
+  }
+}
+
+/**
+ * @brief converts an int graph to the typed layout
+ * @param graph graph structure pointer
+ * @return typed copy of the adjacency matrix
+ * @throw std::invalid_argument if the graph is empty, std::out_of_range if a
+ * weight does not fit Weight
+ */
+template <typename Weight, typename Index>
+TypedGraph<Weight, Index> TypedGraph<Weight, Index>::FromGraph(
+    const graph_t* graph) {
+  if (!graph || !graph->adjacency || !graph->adjacency->cells) {
+    throw std::invalid_argument("Graph is empty");
+  }
+  const matrix_t* adjacency = graph->adjacency;
+  TypedGraph result(static_cast<Index>(adjacency->size));
+  for (int i = 0; i < adjacency->size; i++) {
+    const int* source = matrix_row(adjacency, i);
+    Weight* target = result.Row(static_cast<Index>(i));
+    for (int j = 0; j < adjacency->size; j++) {
+      if (!Fits(source[j])) {
+        throw std::out_of_range("Edge weight does not fit the weight type");
+      }
+      target[j] = static_cast<Weight>(source[j]);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief reads an adjacency matrix in the load_graph_from_file format
+ * straight into the typed layout, only one int row is held at a time
+ * @param filename path to the file
+ * @return loaded graph
+ * @throw std::runtime_error if the file cannot be read or is malformed,
+ * std::out_of_range if a weight does not fit Weight
+ */
+template <typename Weight, typename Index>
+TypedGraph<Weight, Index> TypedGraph<Weight, Index>::LoadFromFile(
+    const std::string& filename) {
+  std::unique_ptr<text_scanner_t, ScannerClose> scanner(
+      text_scanner_open(filename.c_str()));
+  if (!scanner) throw std::runtime_error("Failed to open file: " + filename);
+  int size = 0;
+  if (text_scanner_next_int(scanner.get(), &size) != TEXT_SCAN_OK ||
+      size <= 0) {
+    throw std::runtime_error("Invalid graph size in file");
+  }
+  TypedGraph result(static_cast<Index>(size));
+  std::vector<int> row(static_cast<std::size_t>(size));
+  for (int i = 0; i < size; i++) {
+    if (text_scanner_read_ints(scanner.get(), row.data(), row.size()) !=
+        row.size()) {
+      throw std::runtime_error("Error reading matrix data from file");
+    }
+    Weight* target = result.Row(static_cast<Index>(i));
+    for (int j = 0; j < size; j++) {
+      if (!Fits(row[j])) {
+        throw std::out_of_range("Edge weight does not fit the weight type");
+      }
+      target[j] = static_cast<Weight>(row[j]);
+    }
+  }
+  return result;
+}
+
+#define S21_TYPED_GRAPH_INSTANTIATE(W, I) template class TypedGraph<W, I>;
+S21_TYPED_GRAPH_INSTANTIATIONS(S21_TYPED_GRAPH_INSTANTIATE)
+#undef S21_TYPED_GRAPH_INSTANTIATE
+
+}  // namespace s21
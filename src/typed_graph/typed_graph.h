@@ -0,0 +1,97 @@
+#ifndef S21_TYPED_GRAPH_H
+#define S21_TYPED_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include "../graph/s21_graph.h"
+
+/**
+ * @brief every (weight, index) pair the typed graph core is compiled for, the
+ * argument is a macro taking the two types
+ */
+#define S21_TYPED_GRAPH_INSTANTIATIONS(X) \
+  X(uint8_t, uint32_t)                    \
+  X(uint8_t, uint64_t)                    \
+  X(uint16_t, uint32_t)                   \
+  X(uint16_t, uint64_t)                   \
+  X(int32_t, uint32_t)                    \
+  X(int32_t, uint64_t)                    \
+  X(float, uint32_t)                      \
+  X(float, uint64_t)                      \
+  X(double, uint32_t)                     \
+  X(double, uint64_t)
+
+namespace s21 {
+
+/**
+ * @brief dense adjacency matrix with a chosen weight and vertex index type.
+ *
+ * Same layout as matrix_t: one block aligned to MATRIX_ALIGNMENT, rows padded
+ * to a whole cache line. Cell offsets are computed in size_t, so the matrix
+ * may hold more than 2^31 cells when Index is 64-bit. A weight of 0 means no
+ * edge, as in graph_t.
+ * @tparam Weight uint8_t, uint16_t, int32_t, float or double
+ * @tparam Index uint32_t or uint64_t
+ */
+template <typename Weight, typename Index>
+class TypedGraph {
+  static_assert(std::is_arithmetic_v<Weight>, "weight must be arithmetic");
+  static_assert(std::is_integral_v<Index> && std::is_unsigned_v<Index>,
+                "index must be an unsigned integer");
+
+ public:
+  using weight_type = Weight;
+  using index_type = Index;
+
+  explicit TypedGraph(Index size = 0);
+  TypedGraph(const TypedGraph&) = delete;
+  TypedGraph& operator=(const TypedGraph&) = delete;
+  TypedGraph(TypedGraph&&) noexcept = default;
+  TypedGraph& operator=(TypedGraph&&) noexcept = default;
+  ~TypedGraph() = default;
+
+  static TypedGraph FromGraph(const graph_t* graph);
+  static TypedGraph LoadFromFile(const std::string& filename);
+  static bool Fits(long long weight) noexcept;
+
+  Index Size() const noexcept { return size_; }
+  std::size_t Stride() const noexcept { return stride_; }
+  std::size_t Bytes() const noexcept {
+    return static_cast<std::size_t>(size_) * stride_ * sizeof(Weight);
+  }
+
+  Weight* Row(Index row) noexcept {
+    return cells_.get() + static_cast<std::size_t>(row) * stride_;
+  }
+  const Weight* Row(Index row) const noexcept {
+    return cells_.get() + static_cast<std::size_t>(row) * stride_;
+  }
+  Weight At(Index row, Index column) const noexcept { return Row(row)[column]; }
+  void Set(Index row, Index column, Weight weight) noexcept {
+    Row(row)[column] = weight;
+  }
+
+ private:
+  struct AlignedDelete {
+    void operator()(Weight* cells) const noexcept {
+      ::operator delete(cells, std::align_val_t(MATRIX_ALIGNMENT));
+    }
+  };
+
+  Index size_;
+  std::size_t stride_;
+  std::unique_ptr<Weight, AlignedDelete> cells_;
+};
+
+#define S21_TYPED_GRAPH_EXTERN(W, I) extern template class TypedGraph<W, I>;
+S21_TYPED_GRAPH_INSTANTIATIONS(S21_TYPED_GRAPH_EXTERN)
+#undef S21_TYPED_GRAPH_EXTERN
+
+}  // namespace s21
+
+#endif  // S21_TYPED_GRAPH_H